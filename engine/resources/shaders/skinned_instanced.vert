@@ -0,0 +1,76 @@
+#version 330 core
+
+layout(location = 0) in vec3 aPos;
+layout(location = 1) in vec3 aNormal;
+layout(location = 2) in vec2 aTexCoord;
+layout(location = 3) in ivec4 aBoneIds;
+layout(location = 4) in vec4 aWeights;
+
+// Per-instance data (see SkinnedInstance in SkinnedMesh.h)
+layout(location = 5) in mat4 aInstanceModel;
+layout(location = 9) in vec4 aInstanceAnimation; // x = clip id, y = playback time in seconds
+layout(location = 10) in mat3 aInstanceNormalMatrix; // inverse transpose of the model's upper 3x3
+
+out vec3 Normal;
+out vec3 FragPos;
+out vec2 TexCoords;
+out float vHasWeights;
+
+uniform mat4 uView;
+uniform mat4 uProjection;
+
+const int MAX_CLIPS = 16;
+uniform sampler2D uBoneTexture;  // 3 texels per bone, one row per sampled frame
+uniform vec4 uClipInfo[MAX_CLIPS]; // x = first frame, y = frame count, z = duration (s), w = loop
+uniform float uSampleRate;
+uniform int uBoneCount;
+
+mat4 fetchBone(int bone, int frame)
+{
+    int x = bone * 3;
+    vec4 row0 = texelFetch(uBoneTexture, ivec2(x, frame), 0);
+    vec4 row1 = texelFetch(uBoneTexture, ivec2(x + 1, frame), 0);
+    vec4 row2 = texelFetch(uBoneTexture, ivec2(x + 2, frame), 0);
+    return transpose(mat4(row0, row1, row2, vec4(0.0, 0.0, 0.0, 1.0)));
+}
+
+mat4 blendBone(int bone, int frame0, int frame1, float factor)
+{
+    return mix(fetchBone(bone, frame0), fetchBone(bone, frame1), factor);
+}
+
+void main()
+{
+    vec4 clip = uClipInfo[clamp(int(aInstanceAnimation.x), 0, MAX_CLIPS - 1)];
+    float duration = max(clip.z, 0.0001);
+    float time = clip.w > 0.5 ? mod(aInstanceAnimation.y, duration) : clamp(aInstanceAnimation.y, 0.0, duration);
+
+    float framePosition = time * uSampleRate;
+    int lastFrame = int(clip.y) - 1;
+    int localFrame0 = min(int(floor(framePosition)), lastFrame);
+    int localFrame1 = min(localFrame0 + 1, lastFrame);
+    float factor = framePosition - float(localFrame0);
+    int frame0 = int(clip.x) + localFrame0;
+    int frame1 = int(clip.x) + localFrame1;
+
+    ivec4 boneIds = clamp(aBoneIds, 0, uBoneCount - 1);
+    mat4 skinMatrix = blendBone(boneIds[0], frame0, frame1, factor) * aWeights[0]
+                    + blendBone(boneIds[1], frame0, frame1, factor) * aWeights[1]
+                    + blendBone(boneIds[2], frame0, frame1, factor) * aWeights[2]
+                    + blendBone(boneIds[3], frame0, frame1, factor) * aWeights[3];
+
+    vHasWeights = 1.0;
+    if (aWeights.x + aWeights.y + aWeights.z + aWeights.w == 0.0) {
+        skinMatrix = mat4(1.0);
+        vHasWeights = 0.0;
+    }
+
+    vec4 skinnedPosition = skinMatrix * vec4(aPos, 1.0);
+    vec3 skinnedNormal = mat3(skinMatrix) * aNormal;
+
+    FragPos = vec3(aInstanceModel * skinnedPosition);
+    Normal = aInstanceNormalMatrix * skinnedNormal;
+    TexCoords = aTexCoord;
+
+    gl_Position = uProjection * uView * vec4(FragPos, 1.0);
+}
@@ -0,0 +1,60 @@
+/**
+ * @file    AllocationCounter.cpp
+ * @brief   Implementation of the AllocationCounter class.
+ * @details Replaces the global operator new and operator delete when CBIT_COUNT_ALLOCATIONS is set. The array and
+ *          nothrow forms forward to these, so they are counted too.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    std::atomic<std::uint64_t> sTotal{0};
+    std::atomic<std::uint64_t> sFrameStart{0};
+    std::atomic<std::uint64_t> sLastFrame{0};
+}
+
+#if CBIT_COUNT_ALLOCATIONS
+void *operator new(std::size_t size) {
+    sTotal.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) {
+        size = 1;
+    }
+    while (true) {
+        if (void *pointer = std::malloc(size)) {
+            return pointer;
+        }
+        const std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void operator delete(void *pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+#endif
+
+std::uint64_t cbit::AllocationCounter::getTotal() {
+    return sTotal.load(std::memory_order_relaxed);
+}
+
+void cbit::AllocationCounter::endFrame() {
+    const std::uint64_t total = sTotal.load(std::memory_order_relaxed);
+    sLastFrame.store(total - sFrameStart.exchange(total, std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+std::uint64_t cbit::AllocationCounter::getLastFrame() {
+    return sLastFrame.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,56 @@
+/**
+ * @file    AllocationCounter.h
+ * @brief   Header file for the AllocationCounter class.
+ * @details Counts global heap allocations in debug builds so frames that still allocate show up in the performance
+ *          overlay and the log. Release builds leave operator new alone and report nothing.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_ALLOCATIONCOUNTER_H
+#define CBIT_ALLOCATIONCOUNTER_H
+
+#include <cstdint>
+
+#ifndef CBIT_COUNT_ALLOCATIONS
+#ifdef NDEBUG
+#define CBIT_COUNT_ALLOCATIONS 0
+#else
+#define CBIT_COUNT_ALLOCATIONS 1
+#endif
+#endif
+
+namespace cbit {
+    /**
+     * @class AllocationCounter
+     * @brief Counts calls to the global operator new on every thread.
+     * @details Over-aligned allocations go through the library's aligned operator new and are not counted.
+     */
+    class AllocationCounter {
+    public:
+        /**
+         * Check whether allocations are being counted in this build.
+         * @return true if the global operator new is replaced by the counting one.
+         */
+        static constexpr bool isEnabled() { return CBIT_COUNT_ALLOCATIONS != 0; }
+
+        /**
+         * Get the number of allocations since the program started.
+         * @return Total allocation count, or 0 if counting is disabled.
+         */
+        static std::uint64_t getTotal();
+
+        /**
+         * Close the current frame's count. Called by Application once per frame.
+         */
+        static void endFrame();
+
+        /**
+         * Get the number of allocations made during the last completed frame.
+         * @return Allocations in the last frame, or 0 if counting is disabled.
+         */
+        static std::uint64_t getLastFrame();
+    };
+}
+
+#endif //CBIT_ALLOCATIONCOUNTER_H
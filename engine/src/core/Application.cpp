@@ -8,79 +8,220 @@
 
 #include "Application.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include "AllocationCounter.h"
+#include "FrameArena.h"
 #include "Input.h"
+#include "Profiler.h"
+#include "graphics/meshes/PrimitiveRegistry.h"
+#include "graphics/renderers/GLThread.h"
+#include "graphics/renderers/RenderStats.h"
 
-cbit::Application::Application(const WindowConfig &windowConfig) : _window(windowConfig),
+namespace {
+    constexpr float kDefaultTickRate = 60.0f;
+    constexpr int kDefaultMaxTicksPerFrame = 5;
+
+    // Longest frame time fed to the accumulator; longer hitches (breakpoints, window drags) are dropped.
+    constexpr float kMaxFrameTime = 0.25f;
+
+    // Frames after startup before heap allocations count as unexpected.
+    constexpr std::uint64_t kAllocationWarmupFrames = 120;
+
+    // One worker per hardware thread besides the main thread.
+    unsigned int defaultWorkerCount() {
+        return std::max(1u, std::thread::hardware_concurrency()) - 1;
+    }
+}
+
+cbit::Application::Application(const WindowConfig &windowConfig) : _jobSystem(defaultWorkerCount()),
+                                                                   _window(windowConfig),
                                                                    _wireframe(false),
                                                                    _fullscreen(windowConfig.fullscreen),
                                                                    _windowedWidth(windowConfig.width),
-                                                                   _windowedHeight(windowConfig.height) {
+                                                                   _windowedHeight(windowConfig.height),
+                                                                   _fixedDeltaTime(1.0f / kDefaultTickRate),
+                                                                   _maxTicksPerFrame(kDefaultMaxTicksPerFrame),
+                                                                   _renderThreadEnabled(false),
+                                                                   _frame(0) {
     Logger::log()->info("Welcome to Fantasy Tactics!");
+    Profiler::setThreadName("Main");
+    _jobSystem.makeCurrent();
+    GLThread::makeCurrent();
     _initialize();
 }
 
 #include "utilities/Logger.h"
 
-cbit::Application::~Application() = default;
+cbit::Application::~Application() {
+    // Shared geometry must go while the window, and with it the GL context, still exists.
+    PrimitiveRegistry::clear();
+}
 
 void cbit::Application::run() {
-    auto lastTime = std::chrono::high_resolution_clock::now();
+    if (_renderThreadEnabled) {
+        _renderThread = std::make_unique<RenderThread>(_window.getHandle());
+    } else if (!_sceneRenderer) {
+        _sceneRenderer = std::make_unique<SceneRenderer>();
+    }
+
+    if (!_inputReplayPath.empty()) {
+        Input::startReplay(_inputReplayPath, _fixedDeltaTime);
+    } else if (!_inputRecordPath.empty()) {
+        Input::startRecording(_inputRecordPath, _fixedDeltaTime);
+    }
+
+    auto lastTime = std::chrono::steady_clock::now();
+    float accumulator = 0.0f;
 
     while (!_window.shouldClose()) {
-        auto currentTime = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<float> elapsed = currentTime - lastTime;
-        const float deltaTime = elapsed.count();
+        Profiler::beginFrame(_frame);
+
+        const auto currentTime = std::chrono::steady_clock::now();
+        const std::chrono::duration<float> elapsed = currentTime - lastTime;
+        const float frameTime = std::min(elapsed.count(), kMaxFrameTime);
         lastTime = currentTime;
+        accumulator += frameTime;
+        if (_frame > 0) {
+            RenderStats::recordFrameTime(elapsed.count());
+        }
+
+        // Main-thread work queued by jobs during the previous frame.
+        {
+            CBIT_PROFILE_SCOPE("JobSystem::executeMainThreadJobs");
+            _jobSystem.executeMainThreadJobs();
+        }
 
-        int framebufferWidth, framebufferHeight;
+        // Read once per frame; the simulation sees it through the registry context, the renderer through the
+        // snapshot.
+        int framebufferWidth = 0, framebufferHeight = 0;
         glfwGetFramebufferSize(_window.getHandle(), &framebufferWidth, &framebufferHeight);
-        glViewport(0, 0, framebufferWidth, framebufferHeight);
+        _scenesManager.setViewportSize(framebufferWidth, framebufferHeight);
+
+        // Simulation runs in fixed steps regardless of the display rate; input is sampled once per step so
+        // pressed/released edges are seen by exactly one tick.
+        int ticks = 0;
+        while (accumulator >= _fixedDeltaTime && ticks < _maxTicksPerFrame) {
+            CBIT_PROFILE_SCOPE("Tick");
+            Input::update();
+            _processInput();
+            _scenesManager.update(_fixedDeltaTime);
+            accumulator -= _fixedDeltaTime;
+            ++ticks;
+
+            if (Input::isReplayFinished()) {
+                glfwSetWindowShouldClose(_window.getHandle(), true);
+                break;
+            }
+        }
+        if (accumulator >= _fixedDeltaTime) {
+            // Out of tick budget: drop the backlog instead of carrying it into ever longer frames.
+            accumulator = std::fmod(accumulator, _fixedDeltaTime);
+        }
 
-        _scenesManager.update(deltaTime);
+        // Extract the frame; with a render thread this waits only if the previous frame is still being drawn.
+        RenderSnapshot &snapshot = _renderThread ? _renderThread->acquire() : _snapshot;
+        {
+            CBIT_PROFILE_SCOPE("Extract");
+            snapshot.clear();
+            snapshot.frame = _frame++;
+            snapshot.framebufferWidth = framebufferWidth;
+            snapshot.framebufferHeight = framebufferHeight;
+            snapshot.interpolationAlpha = accumulator / _fixedDeltaTime;
+            snapshot.wireframe = _wireframe;
+            // Primitives requested by this frame's ticks, so new entities draw from their first frame.
+            PrimitiveRegistry::uploadPending();
+            _scenesManager.extract(snapshot);
+        }
 
-        // Clear the screen
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        if (_renderThread) {
+            _renderThread->publish();
+        } else {
+            GLThread::framePublished();
+            GLThread::executePending();
+            _sceneRenderer->submit(snapshot);
+            _scenesManager.render();
+            GLThread::frameSubmitted();
+            CBIT_PROFILE_SCOPE("SwapBuffers");
+            _window.swapBuffers();
+        }
 
-        _scenesManager.render(framebufferWidth, framebufferHeight);
+        // Input callbacks fire here and queue events for the next tick.
+        {
+            CBIT_PROFILE_SCOPE("PollEvents");
+            _window.pollEvents();
+        }
 
-        _window.swapBuffers();
-        _window.pollEvents();
-        Input::update();
-        _processInput(deltaTime);
+        FrameArena::endFrame();
+        AllocationCounter::endFrame();
+        if (AllocationCounter::isEnabled() && _frame > kAllocationWarmupFrames &&
+            AllocationCounter::getLastFrame() > 0) {
+            CBIT_LOG_DEBUG_RATE_LIMITED(5.0, "Frame {} made {} heap allocations", _frame,
+                                        AllocationCounter::getLastFrame());
+        }
     }
+
+    Input::stopRecording();
+
+    // Hand the context back to the main thread for shutdown.
+    _renderThread.reset();
 }
 
 cbit::SceneManager *cbit::Application::getSceneManager() {
     return &_scenesManager;
 }
 
+cbit::JobSystem &cbit::Application::getJobSystem() {
+    return _jobSystem;
+}
+
+void cbit::Application::setFixedTickRate(const float ticksPerSecond) {
+    if (ticksPerSecond <= 0.0f) {
+        Logger::log()->error("Invalid fixed tick rate {}; keeping {} Hz.", ticksPerSecond, 1.0f / _fixedDeltaTime);
+        return;
+    }
+    _fixedDeltaTime = 1.0f / ticksPerSecond;
+}
+
+void cbit::Application::setMaxTicksPerFrame(const int maxTicks) {
+    _maxTicksPerFrame = std::max(1, maxTicks);
+}
+
+void cbit::Application::setRenderThreadEnabled(const bool enabled) {
+    _renderThreadEnabled = enabled;
+}
+
+void cbit::Application::setInputRecording(const std::string &path) {
+    _inputRecordPath = path;
+}
+
+void cbit::Application::setInputReplay(const std::string &path) {
+    _inputReplayPath = path;
+}
+
 void cbit::Application::_initialize() {
     // initialize scene manager
     _scenesManager.initialize(_window.getHandle());
     Input::setWindow(_window.getHandle());
 }
 
-void cbit::Application::_processInput(float deltaTime) {
+void cbit::Application::_processInput() {
     GLFWwindow *window = _window.getHandle();
 
     // Close the window if the Escape key is pressed
-    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+    if (Input::isKeyDown(Keyboard::Escape)) {
         glfwSetWindowShouldClose(window, true);
     }
 
-    // Toggle wireframe on F1 (edge-detect)
-    static bool f1Handled = false;
-    if (glfwGetKey(window, GLFW_KEY_F1) == GLFW_PRESS && !f1Handled) {
+    // Toggle wireframe on F1
+    if (Input::isKeyPressed(Keyboard::F1)) {
         _wireframe = !_wireframe;
-        glPolygonMode(GL_FRONT_AND_BACK, _wireframe ? GL_LINE : GL_FILL);
-        f1Handled = true;
-    }
-    if (glfwGetKey(window, GLFW_KEY_F1) == GLFW_RELEASE) {
-        f1Handled = false;
     }
+
     // Toggle fullscreen on F11
-    static bool f11Handled = false;
-    if (glfwGetKey(window, GLFW_KEY_F11) == GLFW_PRESS && !f11Handled) {
+    if (Input::isKeyPressed(Keyboard::F11)) {
         _fullscreen = !_fullscreen;
         if (_fullscreen) {
             GLFWmonitor *monitor = glfwGetPrimaryMonitor();
@@ -89,9 +230,10 @@ void cbit::Application::_processInput(float deltaTime) {
         } else {
             glfwSetWindowMonitor(window, nullptr, 100, 100, _windowedWidth, _windowedHeight, 0);
         }
-        f11Handled = true;
     }
-    if (glfwGetKey(window, GLFW_KEY_F11) == GLFW_RELEASE) {
-        f11Handled = false;
+
+    // Export the last profiled frames on F12
+    if (Input::isKeyPressed(Keyboard::F12)) {
+        Profiler::exportChromeTrace("logs/trace_" + std::to_string(_frame) + ".json");
     }
 }
@@ -9,8 +9,14 @@
 #ifndef CBIT_APPLICATION_H
 #define CBIT_APPLICATION_H
 
+#include <memory>
+#include <string>
+#include "JobSystem.h"
+#include "RenderThread.h"
 #include "Window.h"
 #include "SceneManager.h"
+#include "graphics/renderers/RenderSnapshot.h"
+#include "graphics/renderers/SceneRenderer.h"
 
 namespace cbit {
     /**
@@ -42,7 +48,48 @@ namespace cbit {
          */
         SceneManager *getSceneManager();
 
+        /**
+         * Get the job system shared by the engine systems.
+         * @return Reference to the JobSystem instance.
+         */
+        JobSystem &getJobSystem();
+
+        /**
+         * Set the rate at which scenes are updated.
+         * @param ticksPerSecond Number of fixed simulation steps per second; independent of the display rate.
+         */
+        void setFixedTickRate(float ticksPerSecond);
+
+        /**
+         * Limit how many simulation steps a single frame may run to catch up.
+         * @param maxTicks Upper bound; simulation time beyond it is dropped so a slow frame cannot snowball.
+         */
+        void setMaxTicksPerFrame(int maxTicks);
+
+        /**
+         * Choose whether a dedicated render thread owns the GL context.
+         * @param enabled If true, run() draws on a render thread while the main thread simulates the next frame.
+         *                Scene::render() and ISystem::render() hooks are not called in this mode.
+         * @details Takes effect at the next call to run(); off by default.
+         */
+        void setRenderThreadEnabled(bool enabled);
+
+        /**
+         * Record the input of every simulation tick to a file during run().
+         * @param path Output file; overwritten when run() starts.
+         */
+        void setInputRecording(const std::string &path);
+
+        /**
+         * Replay a recorded input file during run() instead of reading the keyboard, mouse and gamepad.
+         * @param path File written by a recording session. Its tick rate replaces the fixed tick rate, and the window
+         *             closes once every recorded tick has been replayed.
+         */
+        void setInputReplay(const std::string &path);
+
     private:
+        // Declared first so workers outlive the scenes whose systems schedule work on them.
+        JobSystem _jobSystem;
         Window _window;
         SceneManager _scenesManager;
 
@@ -50,6 +97,19 @@ namespace cbit {
         bool _fullscreen;
         int _windowedWidth, _windowedHeight;
 
+        float _fixedDeltaTime;
+        int _maxTicksPerFrame;
+
+        std::string _inputRecordPath;
+        std::string _inputReplayPath;
+
+        // Declared after the scenes so snapshots and GL state are released first, while the context still exists.
+        bool _renderThreadEnabled;
+        std::uint64_t _frame;
+        RenderSnapshot _snapshot;
+        std::unique_ptr<SceneRenderer> _sceneRenderer;
+        std::unique_ptr<RenderThread> _renderThread;
+
 
         /**
          * Initializes the application.
@@ -58,9 +118,9 @@ namespace cbit {
         void _initialize();
 
         /**
-         * Processes input from the user.
+         * Processes the application hotkeys. Runs once per simulation tick, after Input::update().
          */
-        void _processInput(float deltaTime);
+        void _processInput();
     };
 }
 
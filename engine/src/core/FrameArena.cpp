@@ -0,0 +1,115 @@
+/**
+ * @file    FrameArena.cpp
+ * @brief   Implementation of the FrameArena class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "FrameArena.h"
+
+#include <algorithm>
+#include <new>
+
+namespace {
+    std::atomic<std::size_t> sLastFrameBytes{0};
+
+    cbit::FrameArena &threadArena() {
+        thread_local cbit::FrameArena arena;
+        return arena;
+    }
+
+    std::byte *alignUp(std::byte *pointer, const std::size_t alignment) {
+        const auto address = reinterpret_cast<std::uintptr_t>(pointer);
+        return pointer + ((alignment - address % alignment) % alignment);
+    }
+}
+
+std::atomic<std::uint64_t> cbit::FrameArena::_frame{0};
+
+cbit::FrameArena &cbit::FrameArena::local() {
+    FrameArena &arena = threadArena();
+    const std::uint64_t frame = _frame.load(std::memory_order_relaxed);
+    if (arena._frameSeen != frame) {
+        arena.reset();
+        arena._frameSeen = frame;
+    }
+    return arena;
+}
+
+void cbit::FrameArena::endFrame() {
+    sLastFrameBytes.store(threadArena().getBytesUsed(), std::memory_order_relaxed);
+    _frame.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::size_t cbit::FrameArena::getLastFrameBytes() {
+    return sLastFrameBytes.load(std::memory_order_relaxed);
+}
+
+cbit::FrameArena::~FrameArena() {
+    _releaseBlocks();
+}
+
+void cbit::FrameArena::reset() {
+    _peak = std::max(_peak, _used);
+    _used = 0;
+    _lastAllocation = nullptr;
+
+    if (_block && _block->previous) {
+        // The frame spilled into extra blocks; replace them with one that holds it all.
+        const std::size_t capacity = _capacity;
+        _releaseBlocks();
+        _addBlock(capacity);
+    } else if (_block) {
+        _cursor = reinterpret_cast<std::byte *>(_block) + sizeof(Block);
+    }
+}
+
+void *cbit::FrameArena::do_allocate(const std::size_t bytes, const std::size_t alignment) {
+    std::byte *aligned = _cursor ? alignUp(_cursor, alignment) : nullptr;
+    if (!aligned || static_cast<std::size_t>(_end - aligned) < bytes) {
+        _addBlock(bytes + alignment);
+        aligned = alignUp(_cursor, alignment);
+    }
+
+    _used += static_cast<std::size_t>(aligned + bytes - _cursor);
+    _cursor = aligned + bytes;
+    _lastAllocation = aligned;
+    return aligned;
+}
+
+void cbit::FrameArena::do_deallocate(void *pointer, const std::size_t bytes, std::size_t) {
+    // Only the newest allocation can be handed back; everything else waits for the reset.
+    auto *allocation = static_cast<std::byte *>(pointer);
+    if (allocation == _lastAllocation && allocation + bytes == _cursor) {
+        _cursor = allocation;
+        _lastAllocation = nullptr;
+    }
+}
+
+bool cbit::FrameArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+    return this == &other;
+}
+
+void cbit::FrameArena::_addBlock(const std::size_t minimumSize) {
+    std::size_t size = std::max(kInitialBlockSize, minimumSize + sizeof(Block));
+    if (_block) {
+        size = std::max(size, _block->size * 2);
+    }
+
+    auto *memory = static_cast<std::byte *>(::operator new(size));
+    _block = new(memory) Block{_block, size};
+    _cursor = memory + sizeof(Block);
+    _end = memory + size;
+    _capacity += size;
+}
+
+void cbit::FrameArena::_releaseBlocks() {
+    while (_block) {
+        Block *previous = _block->previous;
+        ::operator delete(_block);
+        _block = previous;
+    }
+    _cursor = nullptr;
+    _end = nullptr;
+    _capacity = 0;
+}
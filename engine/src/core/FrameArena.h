@@ -0,0 +1,103 @@
+/**
+ * @file    FrameArena.h
+ * @brief   Header file for the FrameArena class.
+ * @details Per-thread bump allocator for containers that only live for one frame. It is exposed as a
+ *          std::pmr::memory_resource, so transient work uses std::pmr containers on FrameArena::local() instead of the
+ *          global heap.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_FRAMEARENA_H
+#define CBIT_FRAMEARENA_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace cbit {
+    /**
+     * @class FrameArena
+     * @brief Linear allocator that gives back all of its memory at the end of every frame.
+     * @details Allocation bumps a pointer inside the current block; deallocation is free and only reclaims the most
+     *          recent allocation, which is enough for a growing vector. When a frame outgrows the block, more blocks
+     *          are taken from the heap, and at the next reset they are merged into one block large enough for the
+     *          whole frame, so steady-state frames do not touch the heap.
+     *
+     *          Every thread has its own arena. Application ends the frame with endFrame(); each arena resets itself
+     *          the next time its thread calls local(). Memory from the arena must not be kept past the frame it was
+     *          allocated in.
+     */
+    class FrameArena final : public std::pmr::memory_resource {
+    public:
+        static constexpr std::size_t kInitialBlockSize = 64 * 1024;
+
+        /**
+         * Get the arena of the calling thread, reset first if a frame ended since its last use.
+         * @return Arena for frame-scoped allocations on this thread.
+         */
+        static FrameArena &local();
+
+        /**
+         * End the frame on every thread. Called by Application once per frame.
+         */
+        static void endFrame();
+
+        FrameArena() = default;
+        ~FrameArena() override;
+
+        FrameArena(const FrameArena &) = delete;
+        FrameArena &operator=(const FrameArena &) = delete;
+
+        /**
+         * Release this frame's allocations, keeping one block large enough for the largest frame seen.
+         */
+        void reset();
+
+        /**
+         * Get the bytes handed out since the last reset.
+         * @return Bytes allocated this frame, including alignment padding and memory already given back.
+         */
+        std::size_t getBytesUsed() const { return _used; }
+
+        /**
+         * Get the most bytes any single frame used on this arena.
+         * @return High-water mark in bytes.
+         */
+        std::size_t getPeakBytes() const { return _peak; }
+
+        /**
+         * Get how much of the main thread's arena the last frame used.
+         * @return Bytes used by the frame that ended with the last endFrame() call.
+         */
+        static std::size_t getLastFrameBytes();
+
+    protected:
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+    private:
+        struct Block {
+            Block *previous;
+            std::size_t size;
+        };
+
+        static std::atomic<std::uint64_t> _frame;
+
+        Block *_block = nullptr;
+        std::byte *_cursor = nullptr;
+        std::byte *_end = nullptr;
+        std::byte *_lastAllocation = nullptr;
+        std::size_t _used = 0;
+        std::size_t _capacity = 0;
+        std::size_t _peak = 0;
+        std::uint64_t _frameSeen = 0;
+
+        void _addBlock(std::size_t minimumSize);
+        void _releaseBlocks();
+    };
+}
+
+#endif //CBIT_FRAMEARENA_H
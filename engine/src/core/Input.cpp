@@ -10,23 +10,97 @@
 
 #include "Input.h"
 
+#include <cstring>
+#include <fstream>
+#include "Profiler.h"
+#include "utilities/Logger.h"
+
+namespace {
+    constexpr char kRecordingMagic[4] = {'C', 'B', 'I', 'R'};
+    constexpr std::uint32_t kRecordingVersion = 1;
+
+    enum class InputMode {
+        Live,
+        Recording,
+        Replaying
+    };
+
+    InputMode sMode = InputMode::Live;
+    std::ofstream sRecordFile;
+    std::ifstream sReplayFile;
+    std::uint32_t sTick = 0;
+    bool sReplayFinished = false;
+
+    // Recordings are written in host byte order; they are meant to be replayed on the machine that compares builds.
+    template<typename T>
+    void writeValue(std::ofstream &file, const T &value) {
+        file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool readValue(std::ifstream &file, T &value) {
+        return static_cast<bool>(file.read(reinterpret_cast<char *>(&value), sizeof(T)));
+    }
+
+    bool hasPosition(const cbit::InputEventType type) {
+        return type == cbit::InputEventType::Scroll || type == cbit::InputEventType::MouseButton;
+    }
+}
+
 GLFWwindow *cbit::Input::_window = nullptr;
-std::array<unsigned char, GLFW_KEY_LAST + 1> cbit::Input::_current = {};
-std::array<unsigned char, GLFW_KEY_LAST + 1> cbit::Input::_previous = {};
-std::array<unsigned char, GLFW_MOUSE_BUTTON_LAST + 1> cbit::Input::_mouseCurrent = {};
-std::array<unsigned char, GLFW_MOUSE_BUTTON_LAST + 1> cbit::Input::_mousePrevious = {};
+std::array<cbit::InputEvent, cbit::Input::kMaxEvents> cbit::Input::_ring = {};
+std::size_t cbit::Input::_ringStart = 0;
+std::size_t cbit::Input::_ringCount = 0;
+std::size_t cbit::Input::_droppedEvents = 0;
+cbit::Input::KeyBits cbit::Input::_keysHeld;
+cbit::Input::MouseBits cbit::Input::_mouseHeld;
+double cbit::Input::_cursorX = 0.0;
+double cbit::Input::_cursorY = 0.0;
+bool cbit::Input::_cursorKnown = false;
+std::vector<cbit::InputEvent> cbit::Input::_events;
+cbit::Input::KeyBits cbit::Input::_keysDown;
+cbit::Input::KeyBits cbit::Input::_keysPressed;
+cbit::Input::KeyBits cbit::Input::_keysReleased;
+cbit::Input::MouseBits cbit::Input::_mouseDown;
+cbit::Input::MouseBits cbit::Input::_mousePressed;
+cbit::Input::MouseBits cbit::Input::_mouseReleased;
 double cbit::Input::_mouseX = 0.0;
 double cbit::Input::_mouseY = 0.0;
 double cbit::Input::_mouseDeltaX = 0.0;
 double cbit::Input::_mouseDeltaY = 0.0;
+double cbit::Input::_scrollX = 0.0;
+double cbit::Input::_scrollY = 0.0;
 bool cbit::Input::_mouseInitialized = false;
 int cbit::Input::_gamepadId = GLFW_JOYSTICK_1;
 bool cbit::Input::_gamepadPresent = false;
 GLFWgamepadstate cbit::Input::_gamepadCurrent = {};
 GLFWgamepadstate cbit::Input::_gamepadPrevious = {};
+GLFWkeyfun cbit::Input::_previousKeyCallback = nullptr;
+GLFWmousebuttonfun cbit::Input::_previousMouseButtonCallback = nullptr;
+GLFWscrollfun cbit::Input::_previousScrollCallback = nullptr;
+GLFWcharfun cbit::Input::_previousCharCallback = nullptr;
+GLFWcursorposfun cbit::Input::_previousCursorPosCallback = nullptr;
 
 void cbit::Input::setWindow(GLFWwindow *window) {
     _window = window;
+    _ringStart = 0;
+    _ringCount = 0;
+    _keysHeld.reset();
+    _mouseHeld.reset();
+    _events.reserve(kMaxEvents);
+
+    if (!_window) {
+        return;
+    }
+
+    _previousKeyCallback = glfwSetKeyCallback(_window, _keyCallback);
+    _previousMouseButtonCallback = glfwSetMouseButtonCallback(_window, _mouseButtonCallback);
+    _previousScrollCallback = glfwSetScrollCallback(_window, _scrollCallback);
+    _previousCharCallback = glfwSetCharCallback(_window, _charCallback);
+    _previousCursorPosCallback = glfwSetCursorPosCallback(_window, _cursorPosCallback);
+
+    glfwGetCursorPos(_window, &_cursorX, &_cursorY);
+    _cursorKnown = true;
 }
 
 void cbit::Input::setGamepad(int gamepadId) {
@@ -34,36 +108,98 @@ void cbit::Input::setGamepad(int gamepadId) {
 }
 
 void cbit::Input::update() {
+    CBIT_PROFILE_SCOPE("Input::update");
     if (!_window) {
         return;
     }
 
-    _previous = _current;
-    for (int i = 0; i <= GLFW_KEY_LAST; i++) {
-        _current[i] = glfwGetKey(_window, i) == GLFW_PRESS;
+    _events.clear();
+    if (sMode == InputMode::Replaying) {
+        _readReplayTick();
+    } else {
+        _drainEvents();
+        _pollGamepad();
     }
 
-    _mousePrevious = _mouseCurrent;
-    for (int i = 0; i <= GLFW_MOUSE_BUTTON_LAST; i++) {
-        _mouseCurrent[i] = glfwGetMouseButton(_window, i) == GLFW_PRESS;
+    const KeyBits previousKeys = _keysDown;
+    const MouseBits previousMouse = _mouseDown;
+    _keysPressed.reset();
+    _keysReleased.reset();
+    _mousePressed.reset();
+    _mouseReleased.reset();
+    _scrollX = 0.0;
+    _scrollY = 0.0;
+
+    for (const auto &event: _events) {
+        switch (event.type) {
+            case InputEventType::Key:
+                if (event.code >= 0 && event.code <= GLFW_KEY_LAST) {
+                    if (event.action == GLFW_PRESS) {
+                        _keysPressed.set(event.code);
+                    } else if (event.action == GLFW_RELEASE) {
+                        _keysReleased.set(event.code);
+                    }
+                }
+                break;
+            case InputEventType::MouseButton:
+                if (event.code >= 0 && event.code <= GLFW_MOUSE_BUTTON_LAST) {
+                    if (event.action == GLFW_PRESS) {
+                        _mousePressed.set(event.code);
+                    } else if (event.action == GLFW_RELEASE) {
+                        _mouseReleased.set(event.code);
+                    }
+                }
+                break;
+            case InputEventType::Scroll:
+                _scrollX += event.x;
+                _scrollY += event.y;
+                break;
+            case InputEventType::Char:
+                break;
+        }
     }
 
-    double x = 0.0;
-    double y = 0.0;
-    glfwGetCursorPos(_window, &x, &y);
+    _keysDown = _keysHeld;
+    _mouseDown = _mouseHeld;
+
+    // State changes without a matching event (dropped on overflow) still produce their edge.
+    _keysPressed |= _keysDown & ~previousKeys;
+    _keysReleased |= previousKeys & ~_keysDown;
+    _mousePressed |= _mouseDown & ~previousMouse;
+    _mouseReleased |= previousMouse & ~_mouseDown;
+
     if (!_mouseInitialized) {
-        _mouseX = x;
-        _mouseY = y;
+        _mouseX = _cursorX;
+        _mouseY = _cursorY;
         _mouseDeltaX = 0.0;
         _mouseDeltaY = 0.0;
         _mouseInitialized = true;
     } else {
-        _mouseDeltaX = x - _mouseX;
-        _mouseDeltaY = y - _mouseY;
-        _mouseX = x;
-        _mouseY = y;
+        _mouseDeltaX = _cursorX - _mouseX;
+        _mouseDeltaY = _cursorY - _mouseY;
+        _mouseX = _cursorX;
+        _mouseY = _cursorY;
+    }
+
+    if (sMode == InputMode::Recording) {
+        _writeRecordedTick();
     }
+    ++sTick;
+}
 
+void cbit::Input::_drainEvents() {
+    for (std::size_t i = 0; i < _ringCount; ++i) {
+        _events.push_back(_ring[(_ringStart + i) % kMaxEvents]);
+    }
+    _ringStart = 0;
+    _ringCount = 0;
+    if (_droppedEvents > 0) {
+        CBIT_LOG_WARN_RATE_LIMITED(1.0, "Input event ring overflowed; dropped {} events.", _droppedEvents);
+        _droppedEvents = 0;
+    }
+}
+
+void cbit::Input::_pollGamepad() {
     _gamepadPresent = glfwJoystickIsGamepad(_gamepadId) == GLFW_TRUE;
     if (_gamepadPresent) {
         _gamepadPrevious = _gamepadCurrent;
@@ -74,30 +210,199 @@ void cbit::Input::update() {
     }
 }
 
+bool cbit::Input::startRecording(const std::string &path, const float fixedDeltaTime) {
+    stopRecording();
+
+    sRecordFile.open(path, std::ios::binary | std::ios::trunc);
+    if (!sRecordFile) {
+        Logger::log()->error("Unable to open input recording {}", path);
+        return false;
+    }
+
+    sRecordFile.write(kRecordingMagic, sizeof(kRecordingMagic));
+    writeValue(sRecordFile, kRecordingVersion);
+    writeValue(sRecordFile, fixedDeltaTime);
+    sMode = InputMode::Recording;
+    sTick = 0;
+    Logger::log()->info("Recording input to {}", path);
+    return true;
+}
+
+bool cbit::Input::startReplay(const std::string &path, float &fixedDeltaTime) {
+    stopRecording();
+
+    sReplayFile.open(path, std::ios::binary);
+    if (!sReplayFile) {
+        Logger::log()->error("Unable to open input recording {}", path);
+        return false;
+    }
+
+    char magic[sizeof(kRecordingMagic)] = {};
+    std::uint32_t version = 0;
+    float recordedDeltaTime = 0.0f;
+    sReplayFile.read(magic, sizeof(magic));
+    if (!sReplayFile || std::memcmp(magic, kRecordingMagic, sizeof(magic)) != 0 ||
+        !readValue(sReplayFile, version) || version != kRecordingVersion ||
+        !readValue(sReplayFile, recordedDeltaTime) || recordedDeltaTime <= 0.0f) {
+        Logger::log()->error("{} is not a version {} input recording", path, kRecordingVersion);
+        sReplayFile.close();
+        return false;
+    }
+
+    fixedDeltaTime = recordedDeltaTime;
+    sMode = InputMode::Replaying;
+    sTick = 0;
+    sReplayFinished = false;
+
+    // Replay starts from a clean slate, as the recording did.
+    _ringStart = 0;
+    _ringCount = 0;
+    _keysHeld.reset();
+    _mouseHeld.reset();
+    Logger::log()->info("Replaying input from {} at {} Hz", path, 1.0f / recordedDeltaTime);
+    return true;
+}
+
+void cbit::Input::stopRecording() {
+    if (sRecordFile.is_open()) {
+        sRecordFile.close();
+        Logger::log()->info("Input recording closed after {} ticks", sTick);
+    }
+    if (sReplayFile.is_open()) {
+        sReplayFile.close();
+    }
+    sMode = InputMode::Live;
+}
+
+bool cbit::Input::isReplaying() {
+    return sMode == InputMode::Replaying;
+}
+
+bool cbit::Input::isReplayFinished() {
+    return sReplayFinished;
+}
+
+void cbit::Input::_writeRecordedTick() {
+    // Per tick: tick index, cursor, events, then the gamepad state if one is connected.
+    writeValue(sRecordFile, sTick);
+    writeValue(sRecordFile, _cursorX);
+    writeValue(sRecordFile, _cursorY);
+    writeValue(sRecordFile, static_cast<std::uint16_t>(_events.size()));
+    for (const auto &event: _events) {
+        writeValue(sRecordFile, static_cast<std::uint8_t>(event.type));
+        writeValue(sRecordFile, static_cast<std::uint8_t>(event.action));
+        writeValue(sRecordFile, static_cast<std::uint8_t>(event.mods));
+        writeValue(sRecordFile, static_cast<std::int32_t>(event.code));
+        if (hasPosition(event.type)) {
+            writeValue(sRecordFile, event.x);
+            writeValue(sRecordFile, event.y);
+        }
+    }
+    writeValue(sRecordFile, static_cast<std::uint8_t>(_gamepadPresent ? 1 : 0));
+    if (_gamepadPresent) {
+        sRecordFile.write(reinterpret_cast<const char *>(_gamepadCurrent.buttons), sizeof(_gamepadCurrent.buttons));
+        sRecordFile.write(reinterpret_cast<const char *>(_gamepadCurrent.axes), sizeof(_gamepadCurrent.axes));
+    }
+
+    if (!sRecordFile) {
+        Logger::log()->error("Failed to write input recording at tick {}; recording stopped", sTick);
+        stopRecording();
+    }
+}
+
+void cbit::Input::_readReplayTick() {
+    // Live events are ignored while replaying.
+    _ringStart = 0;
+    _ringCount = 0;
+    _droppedEvents = 0;
+    if (sReplayFinished) {
+        return;
+    }
+
+    std::uint32_t tick = 0;
+    std::uint16_t eventCount = 0;
+    std::uint8_t gamepadPresent = 0;
+    const bool hasTick = readValue(sReplayFile, tick);
+    bool valid = hasTick && tick == sTick && readValue(sReplayFile, _cursorX) &&
+                 readValue(sReplayFile, _cursorY) && readValue(sReplayFile, eventCount);
+
+    for (std::uint16_t i = 0; valid && i < eventCount; ++i) {
+        std::uint8_t type = 0, action = 0, mods = 0;
+        std::int32_t code = 0;
+        InputEvent event;
+        valid = readValue(sReplayFile, type) && readValue(sReplayFile, action) && readValue(sReplayFile, mods) &&
+                readValue(sReplayFile, code);
+        event.type = static_cast<InputEventType>(type);
+        event.action = action;
+        event.mods = mods;
+        event.code = code;
+        if (valid && hasPosition(event.type)) {
+            valid = readValue(sReplayFile, event.x) && readValue(sReplayFile, event.y);
+        }
+        if (!valid) {
+            break;
+        }
+
+        // Held state is rebuilt from the events in the order they were received.
+        if (event.type == InputEventType::Key && event.code >= 0 && event.code <= GLFW_KEY_LAST &&
+            event.action != GLFW_REPEAT) {
+            _keysHeld.set(event.code, event.action == GLFW_PRESS);
+        } else if (event.type == InputEventType::MouseButton && event.code >= 0 &&
+                   event.code <= GLFW_MOUSE_BUTTON_LAST) {
+            _mouseHeld.set(event.code, event.action == GLFW_PRESS);
+        }
+        _events.push_back(event);
+    }
+
+    _gamepadPrevious = _gamepadCurrent;
+    valid = valid && readValue(sReplayFile, gamepadPresent);
+    _gamepadPresent = valid && gamepadPresent != 0;
+    if (_gamepadPresent) {
+        valid = static_cast<bool>(sReplayFile.read(reinterpret_cast<char *>(_gamepadCurrent.buttons),
+                                                   sizeof(_gamepadCurrent.buttons))) &&
+                static_cast<bool>(sReplayFile.read(reinterpret_cast<char *>(_gamepadCurrent.axes),
+                                                   sizeof(_gamepadCurrent.axes)));
+    } else {
+        _gamepadCurrent = {};
+    }
+
+    if (!valid) {
+        // End of file, or a truncated or out-of-sync tick: release everything and stop feeding input.
+        if (hasTick || sReplayFile.gcount() != 0) {
+            Logger::log()->error("Input recording is corrupt at tick {}", sTick);
+        }
+        Logger::log()->info("Input replay finished after {} ticks", sTick);
+        _events.clear();
+        _keysHeld.reset();
+        _mouseHeld.reset();
+        _gamepadPresent = false;
+        _gamepadCurrent = {};
+        sReplayFinished = true;
+    }
+}
+
 bool cbit::Input::isKeyDown(const Keyboard key) {
-    return _current[static_cast<int>(key)];
+    return _keysDown.test(static_cast<std::size_t>(key));
 }
 
 bool cbit::Input::isKeyPressed(const Keyboard key) {
-    return _current[static_cast<int>(key)] && !_previous[static_cast<int>(key)];
+    return _keysPressed.test(static_cast<std::size_t>(key));
 }
 
 bool cbit::Input::isKeyReleased(const Keyboard key) {
-    return !_current[static_cast<int>(key)] && _previous[static_cast<int>(key)];
+    return _keysReleased.test(static_cast<std::size_t>(key));
 }
 
 bool cbit::Input::isMouseDown(const MouseButton button) {
-    return _mouseCurrent[static_cast<int>(button)];
+    return _mouseDown.test(static_cast<std::size_t>(button));
 }
 
 bool cbit::Input::isMousePressed(const MouseButton button) {
-    const int index = static_cast<int>(button);
-    return _mouseCurrent[index] && !_mousePrevious[index];
+    return _mousePressed.test(static_cast<std::size_t>(button));
 }
 
 bool cbit::Input::isMouseReleased(const MouseButton button) {
-    const int index = static_cast<int>(button);
-    return !_mouseCurrent[index] && _mousePrevious[index];
+    return _mouseReleased.test(static_cast<std::size_t>(button));
 }
 
 void cbit::Input::getMousePosition(double &x, double &y) {
@@ -110,6 +415,15 @@ void cbit::Input::getMouseDelta(double &dx, double &dy) {
     dy = _mouseDeltaY;
 }
 
+void cbit::Input::getScrollDelta(double &dx, double &dy) {
+    dx = _scrollX;
+    dy = _scrollY;
+}
+
+const std::vector<cbit::InputEvent> &cbit::Input::getEvents() {
+    return _events;
+}
+
 bool cbit::Input::isGamepadPresent() {
     return _gamepadPresent;
 }
@@ -143,3 +457,81 @@ float cbit::Input::getGamepadAxis(const GamepadAxis axis) {
     }
     return _gamepadCurrent.axes[static_cast<int>(axis)];
 }
+
+void cbit::Input::_push(const InputEvent &event) {
+    if (_ringCount == kMaxEvents) {
+        // Keep the newest events; update() rebuilds lost edges from the held state.
+        _ringStart = (_ringStart + 1) % kMaxEvents;
+        --_ringCount;
+        ++_droppedEvents;
+    }
+    _ring[(_ringStart + _ringCount) % kMaxEvents] = event;
+    ++_ringCount;
+}
+
+void cbit::Input::_keyCallback(GLFWwindow *window, const int key, const int scancode, const int action,
+                               const int mods) {
+    if (sMode == InputMode::Replaying) {
+        if (_previousKeyCallback) {
+            _previousKeyCallback(window, key, scancode, action, mods);
+        }
+        return;
+    }
+    if (key >= 0 && key <= GLFW_KEY_LAST && action != GLFW_REPEAT) {
+        _keysHeld.set(key, action == GLFW_PRESS);
+    }
+    _push({InputEventType::Key, key, action, mods, 0.0, 0.0});
+
+    if (_previousKeyCallback) {
+        _previousKeyCallback(window, key, scancode, action, mods);
+    }
+}
+
+void cbit::Input::_mouseButtonCallback(GLFWwindow *window, const int button, const int action, const int mods) {
+    if (sMode == InputMode::Replaying) {
+        if (_previousMouseButtonCallback) {
+            _previousMouseButtonCallback(window, button, action, mods);
+        }
+        return;
+    }
+    if (button >= 0 && button <= GLFW_MOUSE_BUTTON_LAST) {
+        _mouseHeld.set(button, action == GLFW_PRESS);
+    }
+    _push({InputEventType::MouseButton, button, action, mods, _cursorX, _cursorY});
+
+    if (_previousMouseButtonCallback) {
+        _previousMouseButtonCallback(window, button, action, mods);
+    }
+}
+
+void cbit::Input::_scrollCallback(GLFWwindow *window, const double xOffset, const double yOffset) {
+    if (sMode != InputMode::Replaying) {
+        _push({InputEventType::Scroll, 0, 0, 0, xOffset, yOffset});
+    }
+
+    if (_previousScrollCallback) {
+        _previousScrollCallback(window, xOffset, yOffset);
+    }
+}
+
+void cbit::Input::_charCallback(GLFWwindow *window, const unsigned int codepoint) {
+    if (sMode != InputMode::Replaying) {
+        _push({InputEventType::Char, static_cast<int>(codepoint), 0, 0, 0.0, 0.0});
+    }
+
+    if (_previousCharCallback) {
+        _previousCharCallback(window, codepoint);
+    }
+}
+
+void cbit::Input::_cursorPosCallback(GLFWwindow *window, const double x, const double y) {
+    // Movement only updates the position; it would flood the ring and is summarized by getMouseDelta().
+    if (sMode != InputMode::Replaying) {
+        _cursorX = x;
+        _cursorY = y;
+    }
+
+    if (_previousCursorPosCallback) {
+        _previousCursorPosCallback(window, x, y);
+    }
+}
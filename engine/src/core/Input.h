@@ -12,20 +12,67 @@
 #define CBIT_INPUT_H
 
 #include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
 #include "Keyboard.h"
 #include "Mouse.h"
 #include "Gamepad.h"
 
 namespace cbit {
+    /**
+     * @enum  InputEventType
+     * @brief Kind of an InputEvent.
+     */
+    enum class InputEventType : std::uint8_t {
+        Key,
+        MouseButton,
+        Scroll,
+        Char
+    };
+
+    /**
+     * @struct InputEvent
+     * @brief  One keyboard, mouse button, scroll or text event, in the order GLFW reported it.
+     */
+    struct InputEvent {
+        InputEventType type = InputEventType::Key;
+        int code = 0; // GLFW key or mouse button; the Unicode code point for Char.
+        int action = 0; // GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT; unused for Scroll and Char.
+        int mods = 0;
+        double x = 0.0; // Scroll offset, or the cursor position of a mouse button event.
+        double y = 0.0;
+    };
+
     /**
      * @class Input
      * @brief  Input class for handling input in the game.
+     * @details Keyboard, mouse and text input arrive through GLFW callbacks, which update the held state and append
+     *          to a fixed-size event ring. update() drains the ring once per simulation tick, so the cost follows the
+     *          number of events rather than the size of the keyboard, and a press and release between two ticks
+     *          still shows up as both edges. Gamepads have no GLFW callbacks and are still polled.
+     *
+     *          Each tick's events, cursor position and gamepad state can be recorded to a binary file and replayed
+     *          in place of GLFW. With a fixed tick rate a replay drives the simulation through the same inputs on
+     *          the same ticks, so frame times of the same session can be compared between builds.
      */
     class Input {
     public:
+        // Events that fit between two ticks; older events beyond this are dropped and their edges rebuilt from state.
+        static constexpr std::size_t kMaxEvents = 256;
+
+        /**
+         * Install the input callbacks on a window.
+         * @param window Window to receive input from. Callbacks already installed on it are chained, not replaced.
+         */
         static void setWindow(GLFWwindow *window);
         static void setGamepad(int gamepadId);
 
+        /**
+         * Consume the events received since the previous update. Called once per simulation tick.
+         */
         static void update();
 
         static bool isKeyDown(Keyboard key);
@@ -37,6 +84,13 @@ namespace cbit {
         static bool isMouseReleased(MouseButton button);
         static void getMousePosition(double &x, double &y);
         static void getMouseDelta(double &dx, double &dy);
+        static void getScrollDelta(double &dx, double &dy);
+
+        /**
+         * Get the events consumed by the last update, oldest first.
+         * @return Events of the current tick; empty on ticks without input.
+         */
+        static const std::vector<InputEvent> &getEvents();
 
         static bool isGamepadPresent();
         static bool isGamepadButtonDown(GamepadButton button);
@@ -44,22 +98,90 @@ namespace cbit {
         static bool isGamepadButtonReleased(GamepadButton button);
         static float getGamepadAxis(GamepadAxis axis);
 
+        /**
+         * Record the input of every following tick to a file.
+         * @param path Output file; overwritten.
+         * @param fixedDeltaTime Simulation step the session runs at, stored so the replay can use the same step.
+         * @return false if the file could not be opened.
+         */
+        static bool startRecording(const std::string &path, float fixedDeltaTime);
+
+        /**
+         * Replay a recorded session instead of reading GLFW input.
+         * @param path File written by startRecording().
+         * @param fixedDeltaTime Set to the simulation step of the recording.
+         * @return false if the file could not be opened or is not an input recording.
+         */
+        static bool startReplay(const std::string &path, float &fixedDeltaTime);
+
+        /**
+         * Close the active recording or replay and go back to live input.
+         */
+        static void stopRecording();
+
+        static bool isReplaying();
+
+        /**
+         * Check whether a replay has run out of recorded ticks.
+         * @return true once every recorded tick has been consumed.
+         */
+        static bool isReplayFinished();
+
     private:
+        using KeyBits = std::bitset<GLFW_KEY_LAST + 1>;
+        using MouseBits = std::bitset<GLFW_MOUSE_BUTTON_LAST + 1>;
+
         static GLFWwindow *_window;
-        static std::array<unsigned char, GLFW_KEY_LAST + 1> _current;
-        static std::array<unsigned char, GLFW_KEY_LAST + 1> _previous;
-        static std::array<unsigned char, GLFW_MOUSE_BUTTON_LAST + 1> _mouseCurrent;
-        static std::array<unsigned char, GLFW_MOUSE_BUTTON_LAST + 1> _mousePrevious;
+
+        // Written by the callbacks.
+        static std::array<InputEvent, kMaxEvents> _ring;
+        static std::size_t _ringStart;
+        static std::size_t _ringCount;
+        static std::size_t _droppedEvents;
+        static KeyBits _keysHeld;
+        static MouseBits _mouseHeld;
+        static double _cursorX;
+        static double _cursorY;
+        static bool _cursorKnown;
+
+        // Per-tick state built by update().
+        static std::vector<InputEvent> _events;
+        static KeyBits _keysDown;
+        static KeyBits _keysPressed;
+        static KeyBits _keysReleased;
+        static MouseBits _mouseDown;
+        static MouseBits _mousePressed;
+        static MouseBits _mouseReleased;
         static double _mouseX;
         static double _mouseY;
         static double _mouseDeltaX;
         static double _mouseDeltaY;
+        static double _scrollX;
+        static double _scrollY;
         static bool _mouseInitialized;
 
         static int _gamepadId;
         static bool _gamepadPresent;
         static GLFWgamepadstate _gamepadCurrent;
         static GLFWgamepadstate _gamepadPrevious;
+
+        static GLFWkeyfun _previousKeyCallback;
+        static GLFWmousebuttonfun _previousMouseButtonCallback;
+        static GLFWscrollfun _previousScrollCallback;
+        static GLFWcharfun _previousCharCallback;
+        static GLFWcursorposfun _previousCursorPosCallback;
+
+        static void _push(const InputEvent &event);
+        static void _drainEvents();
+        static void _pollGamepad();
+        static void _readReplayTick();
+        static void _writeRecordedTick();
+
+        static void _keyCallback(GLFWwindow *window, int key, int scancode, int action, int mods);
+        static void _mouseButtonCallback(GLFWwindow *window, int button, int action, int mods);
+        static void _scrollCallback(GLFWwindow *window, double xOffset, double yOffset);
+        static void _charCallback(GLFWwindow *window, unsigned int codepoint);
+        static void _cursorPosCallback(GLFWwindow *window, double x, double y);
     };
 }
 
@@ -0,0 +1,343 @@
+/**
+ * @file    JobSystem.cpp
+ * @brief   Implementation of the JobSystem class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "JobSystem.h"
+
+#include <deque>
+#include <string>
+#include "Profiler.h"
+
+namespace {
+    // Index of the executing thread: 0 for the main thread, 1..N for workers; unbound threads share the last index.
+    constexpr unsigned int kUnboundThread = UINT32_MAX;
+    thread_local unsigned int tThreadIndex = kUnboundThread;
+
+    // parallelForEach scratch lists, one per nesting level on this thread; a deque keeps outer levels in place.
+    thread_local std::deque<std::vector<std::uint32_t> > tEntityScratch;
+    thread_local std::size_t tEntityScratchDepth = 0;
+
+    cbit::JobSystem *sCurrent = nullptr;
+
+    // Upper bound on chunks per thread for parallelFor; keeps job slot usage bounded for huge ranges.
+    constexpr std::size_t kChunksPerThread = 4;
+}
+
+cbit::JobSystem &cbit::JobSystem::get() {
+    if (sCurrent) {
+        return *sCurrent;
+    }
+    static JobSystem inlineSystem(0);
+    return inlineSystem;
+}
+
+cbit::JobSystem::JobSystem(const unsigned int workerCount)
+    : _jobs(new Job[kMaxJobs]),
+      _threadCount(workerCount + 2),
+      _queues(new WorkQueue[workerCount + 2]) {
+    _freeJobs.reserve(kMaxJobs);
+    for (std::size_t i = kMaxJobs; i > 0; --i) {
+        _freeJobs.push_back(static_cast<std::uint32_t>(i - 1));
+    }
+
+    _workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        _workers.emplace_back(&JobSystem::_workerLoop, this, i + 1);
+    }
+}
+
+cbit::JobSystem::~JobSystem() {
+    // Drain the queues so no continuation is left waiting on a job that never runs.
+    while (_runOne(_currentQueue())) {
+    }
+
+    {
+        std::lock_guard lock(_sleepMutex);
+        _stopping = true;
+    }
+    _workAvailable.notify_all();
+    for (auto &worker: _workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    if (sCurrent == this) {
+        sCurrent = nullptr;
+    }
+}
+
+unsigned int cbit::JobSystem::getCurrentThreadIndex() {
+    return get()._currentQueue();
+}
+
+void cbit::JobSystem::makeCurrent() {
+    sCurrent = this;
+    tThreadIndex = 0;
+}
+
+void cbit::JobSystem::wait(const JobHandle handle) {
+    const unsigned int threadIndex = _currentQueue();
+    while (!isFinished(handle)) {
+        if (!_runOne(threadIndex)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool cbit::JobSystem::isFinished(const JobHandle handle) const {
+    if (!handle.isValid()) {
+        return true;
+    }
+    Job &job = _jobs[handle.index];
+    if (job.generation.load() != handle.generation) {
+        return true;
+    }
+    std::lock_guard lock(job.mutex);
+    return job.finished || job.generation.load() != handle.generation;
+}
+
+void cbit::JobSystem::runOnMainThread(std::function<void()> function) {
+    std::lock_guard lock(_mainThreadMutex);
+    _mainThreadJobs.push_back(std::move(function));
+}
+
+void cbit::JobSystem::executeMainThreadJobs() {
+    {
+        std::lock_guard lock(_mainThreadMutex);
+        _mainThreadJobsRunning.swap(_mainThreadJobs);
+    }
+    // Jobs queued while these run are picked up next frame.
+    for (auto &function: _mainThreadJobsRunning) {
+        function();
+    }
+    _mainThreadJobsRunning.clear();
+}
+
+std::uint32_t cbit::JobSystem::_allocateJob() {
+    while (true) {
+        {
+            std::lock_guard lock(_freeMutex);
+            if (!_freeJobs.empty()) {
+                const std::uint32_t index = _freeJobs.back();
+                _freeJobs.pop_back();
+
+                Job &job = _jobs[index];
+                std::lock_guard jobLock(job.mutex);
+                job.generation.fetch_add(1);
+                job.finished = false;
+                job.continuationCount = 0;
+                return index;
+            }
+        }
+
+        // Pool exhausted: help drain the queues until a slot is released.
+        if (!_runOne(_currentQueue())) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void cbit::JobSystem::_releaseJob(const std::uint32_t index) {
+    std::lock_guard lock(_freeMutex);
+    _freeJobs.push_back(index);
+}
+
+cbit::JobHandle cbit::JobSystem::_submit(const std::uint32_t index,
+                                         const JobHandle *dependencies,
+                                         const std::size_t dependencyCount) {
+    Job &job = _jobs[index];
+    const JobHandle handle{index, job.generation.load()};
+
+    // One extra count keeps the job from starting while its dependencies are being registered.
+    job.pendingDependencies.store(1);
+    for (std::size_t i = 0; i < dependencyCount; ++i) {
+        const JobHandle dependency = dependencies[i];
+        if (!dependency.isValid()) {
+            continue;
+        }
+
+        Job &dependencyJob = _jobs[dependency.index];
+        bool registered = false;
+        bool full = false;
+        {
+            std::lock_guard lock(dependencyJob.mutex);
+            if (dependencyJob.generation.load() == dependency.generation && !dependencyJob.finished) {
+                if (dependencyJob.continuationCount < kMaxContinuations) {
+                    job.pendingDependencies.fetch_add(1);
+                    dependencyJob.continuations[dependencyJob.continuationCount++] = index;
+                    registered = true;
+                } else {
+                    full = true;
+                }
+            }
+        }
+
+        // Too many continuations on one job: fall back to waiting for it here.
+        if (!registered && full) {
+            wait(dependency);
+        }
+    }
+
+    _resolveDependency(index);
+    return handle;
+}
+
+void cbit::JobSystem::_resolveDependency(const std::uint32_t index) {
+    if (_jobs[index].pendingDependencies.fetch_sub(1) == 1) {
+        _push(index);
+    }
+}
+
+void cbit::JobSystem::_push(const std::uint32_t index) {
+    WorkQueue &queue = _queues[_currentQueue()];
+    {
+        std::lock_guard lock(queue.mutex);
+        queue.ring[(queue.head + queue.size) % kMaxJobs] = index;
+        ++queue.size;
+    }
+
+    _queuedJobs.fetch_add(1);
+    if (_threadCount > 2) {
+        std::lock_guard lock(_sleepMutex);
+        _workAvailable.notify_one();
+    }
+}
+
+bool cbit::JobSystem::_pop(const unsigned int queueIndex, std::uint32_t &index) {
+    WorkQueue &queue = _queues[queueIndex];
+    std::lock_guard lock(queue.mutex);
+    if (queue.size == 0) {
+        return false;
+    }
+    // Newest first: the owner keeps working on what it just produced while it is still in cache.
+    --queue.size;
+    index = queue.ring[(queue.head + queue.size) % kMaxJobs];
+    _queuedJobs.fetch_sub(1);
+    return true;
+}
+
+bool cbit::JobSystem::_steal(const unsigned int thiefIndex, std::uint32_t &index) {
+    const unsigned int queueCount = getThreadCount();
+    for (unsigned int offset = 1; offset < queueCount; ++offset) {
+        WorkQueue &queue = _queues[(thiefIndex + offset) % queueCount];
+        std::lock_guard lock(queue.mutex);
+        if (queue.size == 0) {
+            continue;
+        }
+        // Oldest first: these tend to be the largest remaining pieces of work.
+        index = queue.ring[queue.head];
+        queue.head = (queue.head + 1) % kMaxJobs;
+        --queue.size;
+        _queuedJobs.fetch_sub(1);
+        return true;
+    }
+    return false;
+}
+
+bool cbit::JobSystem::_runOne(const unsigned int threadIndex) {
+    std::uint32_t index = 0;
+    if (_pop(threadIndex, index) || _steal(threadIndex, index)) {
+        _execute(index, threadIndex);
+        return true;
+    }
+    return false;
+}
+
+void cbit::JobSystem::_execute(const std::uint32_t index, const unsigned int threadIndex) {
+    Job &job = _jobs[index];
+    job.invoke(job, threadIndex);
+
+    std::uint32_t continuations[kMaxContinuations];
+    std::size_t continuationCount = 0;
+    {
+        std::lock_guard lock(job.mutex);
+        job.finished = true;
+        continuationCount = job.continuationCount;
+        std::copy_n(job.continuations, continuationCount, continuations);
+    }
+
+    _releaseJob(index);
+    for (std::size_t i = 0; i < continuationCount; ++i) {
+        _resolveDependency(continuations[i]);
+    }
+}
+
+void cbit::JobSystem::_workerLoop(const unsigned int threadIndex) {
+    tThreadIndex = threadIndex;
+    Profiler::setThreadName("Worker " + std::to_string(threadIndex));
+
+    while (true) {
+        if (_runOne(threadIndex)) {
+            continue;
+        }
+
+        std::unique_lock lock(_sleepMutex);
+        _workAvailable.wait(lock, [this] { return _stopping || _queuedJobs.load() > 0; });
+        if (_stopping) {
+            return;
+        }
+    }
+}
+
+void cbit::JobSystem::_parallelFor(const std::size_t count,
+                                   std::size_t grainSize,
+                                   void *context,
+                                   const ChunkFunction function) {
+    if (count == 0) {
+        return;
+    }
+    grainSize = std::max<std::size_t>(1, grainSize);
+
+    const unsigned int threadIndex = _currentQueue();
+
+    // Without workers, or for a single chunk, there is nothing to distribute.
+    if (_threadCount == 2 || count <= grainSize) {
+        function(context, 0, count, threadIndex);
+        return;
+    }
+
+    // Only the workers and the caller run chunks; the shared slot is not an extra thread.
+    const std::size_t maxChunks = static_cast<std::size_t>(_threadCount - 1) * kChunksPerThread;
+    grainSize = std::max(grainSize, (count + maxChunks - 1) / maxChunks);
+    const std::size_t chunkCount = (count + grainSize - 1) / grainSize;
+
+    // The caller runs the first chunk itself; the rest are queued for other threads to steal.
+    std::atomic<std::size_t> remaining{chunkCount - 1};
+    for (std::size_t chunk = 1; chunk < chunkCount; ++chunk) {
+        const std::size_t begin = chunk * grainSize;
+        const std::size_t end = std::min(begin + grainSize, count);
+        schedule([context, function, begin, end, &remaining](const unsigned int threadIndex) {
+            function(context, begin, end, threadIndex);
+            remaining.fetch_sub(1);
+        });
+    }
+
+    function(context, 0, std::min(grainSize, count), threadIndex);
+
+    while (remaining.load() > 0) {
+        if (!_runOne(threadIndex)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+unsigned int cbit::JobSystem::_currentQueue() const {
+    return tThreadIndex < _threadCount - 1 ? tThreadIndex : _threadCount - 1;
+}
+
+std::vector<std::uint32_t> &cbit::JobSystem::_acquireEntityScratch() {
+    if (tEntityScratch.size() <= tEntityScratchDepth) {
+        tEntityScratch.emplace_back();
+    }
+    auto &entities = tEntityScratch[tEntityScratchDepth++];
+    entities.clear();
+    return entities;
+}
+
+void cbit::JobSystem::_releaseEntityScratch() {
+    --tEntityScratchDepth;
+}
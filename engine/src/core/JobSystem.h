@@ -0,0 +1,288 @@
+/**
+ * @file    JobSystem.h
+ * @brief   Header file for the JobSystem class.
+ * @details Task scheduler with work stealing, owned by the Application. Systems fan work out through parallelFor(),
+ *          parallelForEach() over entt views, or individual jobs with dependencies, instead of creating threads
+ *          of their own. Work that must stay on the main thread (GLFW calls) is queued with runOnMainThread();
+ *          OpenGL work goes through GLThread::run(), since a render thread may own the context.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_JOBSYSTEM_H
+#define CBIT_JOBSYSTEM_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cbit {
+    /**
+     * @struct JobHandle
+     * @brief  Reference to a scheduled job, used to wait on it or to express dependencies.
+     * @details Handles stay valid after the job finished; a finished job's slot may be reused without
+     *          affecting handles to it.
+     */
+    struct JobHandle {
+        std::uint32_t index = UINT32_MAX;
+        std::uint32_t generation = 0;
+
+        [[nodiscard]] bool isValid() const { return index != UINT32_MAX; }
+    };
+
+    /**
+     * @class JobSystem
+     * @brief Task scheduler with per-thread work-stealing queues.
+     * @details Each worker owns a queue; it pops its own newest jobs first and steals the oldest jobs of other
+     *          threads when it runs dry. Threads that wait on a job (including the main thread) execute queued jobs
+     *          while they wait, so nested parallelism cannot deadlock. Jobs live in a fixed pool of slots and small
+     *          callables are stored inline, so scheduling does not allocate.
+     *
+     *          The queues are ring buffers guarded by a mutex each, not lock-free Chase-Lev deques. Jobs are coarse
+     *          (a system update, a chunk of a parallelFor), so a queue is locked a few hundred times per frame and
+     *          contention stays low; a lock-free deque would add memory-ordering subtleties for no measured gain.
+     *
+     *          Thread indices: 0 is the main thread (the one that called makeCurrent()), 1..N are the workers, and
+     *          N + 1 is shared by every other thread, such as the render thread. Per-thread data indexed by
+     *          getCurrentThreadIndex(), like CommandBuffers, therefore needs getThreadCount() entries.
+     */
+    class JobSystem {
+    public:
+        static constexpr std::size_t kMaxJobs = 4096;
+        static constexpr std::size_t kJobPayloadSize = 64;
+
+        /**
+         * Get the job system of the running Application.
+         * @return The active job system, or a worker-less instance that runs everything inline on the caller if
+         *         no Application exists (e.g. in tools).
+         */
+        static JobSystem &get();
+
+        /**
+         * Constructor for the JobSystem class.
+         * @param workerCount Number of worker threads to spawn in addition to the main thread.
+         */
+        explicit JobSystem(unsigned int workerCount);
+
+        /**
+         * Destructor. Finishes queued jobs, then stops and joins all worker threads.
+         */
+        ~JobSystem();
+
+        JobSystem(const JobSystem &) = delete;
+        JobSystem &operator=(const JobSystem &) = delete;
+
+        /**
+         * Make this instance the one returned by get() and the calling thread its main thread.
+         */
+        void makeCurrent();
+
+        /**
+         * Get the index of the calling thread.
+         * @return 0 on the main thread, 1..N on worker threads and N + 1 on any other thread.
+         */
+        static unsigned int getCurrentThreadIndex();
+
+        /**
+         * Get the number of thread indices, including the main thread and the slot shared by other threads.
+         * @return Worker count plus two.
+         */
+        [[nodiscard]] unsigned int getThreadCount() const { return _threadCount; }
+
+        /**
+         * Schedule a job.
+         * @param function Callable invoked as function() or function(threadIndex); its size must not exceed
+         *                 kJobPayloadSize.
+         * @param dependencies Jobs that must finish before this one starts.
+         * @return Handle to the scheduled job.
+         */
+        template<typename Function>
+        JobHandle schedule(Function &&function, std::initializer_list<JobHandle> dependencies = {}) {
+            return schedule(std::forward<Function>(function), dependencies.begin(), dependencies.size());
+        }
+
+        /**
+         * Schedule a job with a runtime list of dependencies.
+         * @param function Callable, as for schedule().
+         * @param dependencies Array of jobs that must finish before this one starts.
+         * @param dependencyCount Number of entries in dependencies.
+         * @return Handle to the scheduled job.
+         */
+        template<typename Function>
+        JobHandle schedule(Function &&function, const JobHandle *dependencies, const std::size_t dependencyCount) {
+            using Callable = std::decay_t<Function>;
+            static_assert(sizeof(Callable) <= kJobPayloadSize, "Job callable is too large; capture by reference.");
+            static_assert(alignof(Callable) <= alignof(std::max_align_t), "Job callable is over-aligned.");
+
+            const std::uint32_t index = _allocateJob();
+            Job &job = _jobs[index];
+            new(job.payload) Callable(std::forward<Function>(function));
+            job.invoke = [](Job &target, const unsigned int threadIndex) {
+                auto &callable = *std::launder(reinterpret_cast<Callable *>(target.payload));
+                if constexpr (std::is_invocable_v<Callable &, unsigned int>) {
+                    callable(threadIndex);
+                } else {
+                    callable();
+                }
+                callable.~Callable();
+            };
+            return _submit(index, dependencies, dependencyCount);
+        }
+
+        /**
+         * Schedule a continuation that runs once a job has finished.
+         * @param dependency Job to wait for.
+         * @param function Callable, as for schedule().
+         * @return Handle to the continuation.
+         */
+        template<typename Function>
+        JobHandle then(const JobHandle dependency, Function &&function) {
+            return schedule(std::forward<Function>(function), {dependency});
+        }
+
+        /**
+         * Block until a job has finished, executing other jobs in the meantime.
+         * @param handle Job to wait for; invalid handles return immediately.
+         */
+        void wait(JobHandle handle);
+
+        /**
+         * Check whether a job has finished.
+         * @param handle Job to check.
+         * @return true if the job finished or the handle is invalid.
+         */
+        [[nodiscard]] bool isFinished(JobHandle handle) const;
+
+        /**
+         * Run a body over [0, count) in chunks of at least grainSize elements and wait for completion.
+         * @param count Number of elements.
+         * @param grainSize Minimum number of elements per chunk (values below 1 are treated as 1).
+         * @param body Callable invoked as body(begin, end, threadIndex).
+         * @details The calling thread executes chunks too. Calls from inside a job are fine: the waiting thread
+         *          keeps executing queued work.
+         */
+        template<typename Body>
+        void parallelFor(const std::size_t count, const std::size_t grainSize, Body &&body) {
+            _parallelFor(count, grainSize, &body, [](void *context, const std::size_t begin, const std::size_t end,
+                                                     const unsigned int threadIndex) {
+                (*static_cast<std::remove_reference_t<Body> *>(context))(begin, end, threadIndex);
+            });
+        }
+
+        /**
+         * Run a body for every entity of an entt view and wait for completion.
+         * @param view entt view (or any range of entities).
+         * @param grainSize Minimum number of entities per chunk.
+         * @param body Callable invoked as body(entity, threadIndex).
+         * @details The body may read and write the components of its entity; structural changes to the registry
+         *          are not allowed while the loop runs.
+         */
+        template<typename View, typename Body>
+        void parallelForEach(const View &view, const std::size_t grainSize, Body &&body) {
+            using Entity = std::decay_t<decltype(*view.begin())>;
+            static_assert(sizeof(Entity) <= sizeof(std::uint32_t), "parallelForEach expects 32-bit entities.");
+
+            auto &entities = _acquireEntityScratch();
+            for (const auto entity: view) {
+                entities.push_back(static_cast<std::uint32_t>(entity));
+            }
+
+            parallelFor(entities.size(), grainSize,
+                        [&entities, &body](const std::size_t begin, const std::size_t end,
+                                           const unsigned int threadIndex) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                body(static_cast<Entity>(entities[i]), threadIndex);
+                            }
+                        });
+            _releaseEntityScratch();
+        }
+
+        /**
+         * Queue work that must run on the main thread, such as GLFW window calls.
+         * @param function Work to run during the next executeMainThreadJobs().
+         */
+        void runOnMainThread(std::function<void()> function);
+
+        /**
+         * Run the work queued with runOnMainThread(). Called once per frame by the Application.
+         */
+        void executeMainThreadJobs();
+
+    private:
+        using ChunkFunction = void (*)(void *context, std::size_t begin, std::size_t end, unsigned int threadIndex);
+
+        static constexpr std::size_t kMaxContinuations = 16;
+
+        struct Job {
+            void (*invoke)(Job &job, unsigned int threadIndex) = nullptr;
+            alignas(std::max_align_t) unsigned char payload[kJobPayloadSize]{};
+
+            std::atomic<int> pendingDependencies{0};
+            std::atomic<std::uint32_t> generation{0};
+
+            // Guards finished and the continuation list.
+            std::mutex mutex;
+            bool finished = true;
+            std::uint32_t continuations[kMaxContinuations]{};
+            std::size_t continuationCount = 0;
+        };
+
+        // Bounded queue of job indices; it can hold every job of the pool, so pushes never fail.
+        struct WorkQueue {
+            std::mutex mutex;
+            std::unique_ptr<std::uint32_t[]> ring{new std::uint32_t[kMaxJobs]};
+            std::size_t head = 0; // Oldest job, taken by thieves.
+            std::size_t size = 0;
+        };
+
+        std::uint32_t _allocateJob();
+        void _releaseJob(std::uint32_t index);
+        JobHandle _submit(std::uint32_t index, const JobHandle *dependencies, std::size_t dependencyCount);
+        void _resolveDependency(std::uint32_t index);
+        void _push(std::uint32_t index);
+        bool _pop(unsigned int queueIndex, std::uint32_t &index);
+        bool _steal(unsigned int thiefIndex, std::uint32_t &index);
+        bool _runOne(unsigned int threadIndex);
+        void _execute(std::uint32_t index, unsigned int threadIndex);
+        void _workerLoop(unsigned int threadIndex);
+
+        void _parallelFor(std::size_t count, std::size_t grainSize, void *context, ChunkFunction function);
+
+        // Queue of the calling thread; threads other than the main thread and this instance's workers share the last.
+        [[nodiscard]] unsigned int _currentQueue() const;
+
+        static std::vector<std::uint32_t> &_acquireEntityScratch();
+        static void _releaseEntityScratch();
+
+        std::unique_ptr<Job[]> _jobs;
+        std::vector<std::uint32_t> _freeJobs;
+        std::mutex _freeMutex;
+
+        // Set before any worker starts; workers must not read _workers while it is being filled.
+        unsigned int _threadCount = 2;
+        std::unique_ptr<WorkQueue[]> _queues; // One per thread index.
+        std::vector<std::thread> _workers;
+
+        std::atomic<int> _queuedJobs{0};
+        std::mutex _sleepMutex;
+        std::condition_variable _workAvailable;
+        bool _stopping = false;
+
+        std::mutex _mainThreadMutex;
+        std::vector<std::function<void()> > _mainThreadJobs;
+        std::vector<std::function<void()> > _mainThreadJobsRunning;
+    };
+}
+
+#endif //CBIT_JOBSYSTEM_H
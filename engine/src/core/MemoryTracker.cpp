@@ -0,0 +1,123 @@
+/**
+ * @file    MemoryTracker.cpp
+ * @brief   Implementation of the MemoryTracker class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "MemoryTracker.h"
+
+#include <array>
+#include <atomic>
+#include "utilities/Logger.h"
+
+namespace {
+    constexpr std::size_t kCategoryCount = static_cast<std::size_t>(cbit::MemoryCategory::Count);
+
+    struct Counter {
+        std::atomic<std::int64_t> bytes{0};
+        std::atomic<std::int64_t> peak{0};
+        std::atomic<std::int64_t> budget{0};
+    };
+
+    struct CategoryCounters {
+        Counter cpu;
+        Counter gpu;
+    };
+
+    std::array<CategoryCounters, kCategoryCount> sCounters;
+
+    double toMegabytes(const std::int64_t bytes) {
+        return static_cast<double>(bytes) / (1024.0 * 1024.0);
+    }
+
+    void track(Counter &counter, const cbit::MemoryCategory category, const char *kind, const std::int64_t bytes) {
+        const std::int64_t previous = counter.bytes.fetch_add(bytes, std::memory_order_relaxed);
+        const std::int64_t current = previous + bytes;
+
+        std::int64_t peak = counter.peak.load(std::memory_order_relaxed);
+        while (current > peak && !counter.peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+        }
+
+        const std::int64_t budget = counter.budget.load(std::memory_order_relaxed);
+        if (budget > 0 && previous <= budget && current > budget) {
+            CBIT_LOG_WARN("{} {} memory over budget: {:.2f} MB of {:.2f} MB",
+                          cbit::MemoryTracker::getCategoryName(category), kind, toMegabytes(current),
+                          toMegabytes(budget));
+        }
+    }
+
+    CategoryCounters &countersFor(const cbit::MemoryCategory category) {
+        return sCounters[static_cast<std::size_t>(category)];
+    }
+}
+
+void cbit::MemoryTracker::trackCpu(const MemoryCategory category, const std::int64_t bytes) {
+    track(countersFor(category).cpu, category, "CPU", bytes);
+}
+
+void cbit::MemoryTracker::trackGpu(const MemoryCategory category, const std::int64_t bytes) {
+    track(countersFor(category).gpu, category, "GPU", bytes);
+}
+
+void cbit::MemoryTracker::setBudget(const MemoryCategory category, const std::int64_t cpuBytes,
+                                    const std::int64_t gpuBytes) {
+    countersFor(category).cpu.budget.store(cpuBytes, std::memory_order_relaxed);
+    countersFor(category).gpu.budget.store(gpuBytes, std::memory_order_relaxed);
+}
+
+cbit::MemoryCategoryStats cbit::MemoryTracker::getStats(const MemoryCategory category) {
+    const CategoryCounters &counters = countersFor(category);
+    MemoryCategoryStats stats;
+    stats.cpuBytes = counters.cpu.bytes.load(std::memory_order_relaxed);
+    stats.gpuBytes = counters.gpu.bytes.load(std::memory_order_relaxed);
+    stats.peakCpuBytes = counters.cpu.peak.load(std::memory_order_relaxed);
+    stats.peakGpuBytes = counters.gpu.peak.load(std::memory_order_relaxed);
+    return stats;
+}
+
+cbit::MemoryCategoryStats cbit::MemoryTracker::getTotal() {
+    MemoryCategoryStats total;
+    for (std::size_t i = 0; i < kCategoryCount; ++i) {
+        const MemoryCategoryStats stats = getStats(static_cast<MemoryCategory>(i));
+        total.cpuBytes += stats.cpuBytes;
+        total.gpuBytes += stats.gpuBytes;
+        total.peakCpuBytes += stats.peakCpuBytes;
+        total.peakGpuBytes += stats.peakGpuBytes;
+    }
+    return total;
+}
+
+const char *cbit::MemoryTracker::getCategoryName(const MemoryCategory category) {
+    switch (category) {
+        case MemoryCategory::Meshes:
+            return "Meshes";
+        case MemoryCategory::Textures:
+            return "Textures";
+        case MemoryCategory::Animation:
+            return "Animation";
+        case MemoryCategory::Glyphs:
+            return "Glyphs";
+        case MemoryCategory::ECS:
+            return "ECS";
+        case MemoryCategory::Render:
+            return "Render";
+        default:
+            return "Unknown";
+    }
+}
+
+void cbit::MemoryTracker::logReport(const std::string_view reason) {
+    Logger::log()->info("Memory report ({})", reason);
+    Logger::log()->info("  {:<10} {:>10} {:>10} {:>10} {:>10}", "Category", "CPU MB", "peak", "GPU MB", "peak");
+    for (std::size_t i = 0; i < kCategoryCount; ++i) {
+        const auto category = static_cast<MemoryCategory>(i);
+        const MemoryCategoryStats stats = getStats(category);
+        Logger::log()->info("  {:<10} {:>10.2f} {:>10.2f} {:>10.2f} {:>10.2f}", getCategoryName(category),
+                            toMegabytes(stats.cpuBytes), toMegabytes(stats.peakCpuBytes),
+                            toMegabytes(stats.gpuBytes), toMegabytes(stats.peakGpuBytes));
+    }
+    const MemoryCategoryStats total = getTotal();
+    Logger::log()->info("  {:<10} {:>10.2f} {:>10} {:>10.2f} {:>10}", "Total", toMegabytes(total.cpuBytes), "",
+                        toMegabytes(total.gpuBytes), "");
+}
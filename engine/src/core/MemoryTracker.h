@@ -0,0 +1,129 @@
+/**
+ * @file    MemoryTracker.h
+ * @brief   Header file for the MemoryTracker class.
+ * @details Per-subsystem accounting of CPU heap and GPU memory. Containers holding asset data use TrackedAllocator;
+ *          GPU buffers and textures report their size when they are created and released. Totals can be queried at
+ *          any time and are logged on every scene switch.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_MEMORYTRACKER_H
+#define CBIT_MEMORYTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace cbit {
+    enum class MemoryCategory : std::uint8_t {
+        Meshes,
+        Textures,
+        Animation,
+        Glyphs,
+        ECS,
+        Render,
+        Count
+    };
+
+    /**
+     * @struct MemoryCategoryStats
+     * @brief  Current and peak bytes of one category.
+     */
+    struct MemoryCategoryStats {
+        std::int64_t cpuBytes = 0;
+        std::int64_t gpuBytes = 0;
+        std::int64_t peakCpuBytes = 0;
+        std::int64_t peakGpuBytes = 0;
+    };
+
+    /**
+     * @class MemoryTracker
+     * @brief Thread-safe byte counters per memory category, with optional budgets.
+     * @details Counters are signed so a double release shows up as a negative total instead of wrapping around.
+     *          A category that grows past its budget logs a warning each time it crosses it.
+     */
+    class MemoryTracker {
+    public:
+        /**
+         * Record CPU memory allocated (positive) or freed (negative).
+         * @param category Subsystem the memory belongs to.
+         * @param bytes Change in bytes.
+         */
+        static void trackCpu(MemoryCategory category, std::int64_t bytes);
+
+        /**
+         * Record GPU memory allocated (positive) or freed (negative).
+         * @param category Subsystem the memory belongs to.
+         * @param bytes Change in bytes.
+         */
+        static void trackGpu(MemoryCategory category, std::int64_t bytes);
+
+        /**
+         * Set the budget of a category. Zero means no budget.
+         * @param category Subsystem to limit.
+         * @param cpuBytes CPU budget in bytes.
+         * @param gpuBytes GPU budget in bytes.
+         */
+        static void setBudget(MemoryCategory category, std::int64_t cpuBytes, std::int64_t gpuBytes);
+
+        static MemoryCategoryStats getStats(MemoryCategory category);
+
+        /**
+         * Get the sum over all categories. Peaks are the sums of the per-category peaks.
+         */
+        static MemoryCategoryStats getTotal();
+
+        static const char *getCategoryName(MemoryCategory category);
+
+        /**
+         * Log a table of every category.
+         * @param reason Shown in the header line, e.g. the scene that was loaded.
+         */
+        static void logReport(std::string_view reason);
+    };
+
+    /**
+     * @class TrackedAllocator
+     * @brief Standard allocator that reports its allocations to the MemoryTracker under a fixed category.
+     */
+    template<typename T, MemoryCategory Category>
+    class TrackedAllocator {
+    public:
+        using value_type = T;
+
+        template<typename U>
+        struct rebind {
+            using other = TrackedAllocator<U, Category>;
+        };
+
+        TrackedAllocator() noexcept = default;
+
+        template<typename U>
+        TrackedAllocator(const TrackedAllocator<U, Category> &) noexcept {}
+
+        T *allocate(const std::size_t count) {
+            T *pointer = std::allocator<T>().allocate(count);
+            MemoryTracker::trackCpu(Category, static_cast<std::int64_t>(count * sizeof(T)));
+            return pointer;
+        }
+
+        void deallocate(T *pointer, const std::size_t count) noexcept {
+            MemoryTracker::trackCpu(Category, -static_cast<std::int64_t>(count * sizeof(T)));
+            std::allocator<T>().deallocate(pointer, count);
+        }
+
+        template<typename U>
+        bool operator==(const TrackedAllocator<U, Category> &) const noexcept { return true; }
+
+        template<typename U>
+        bool operator!=(const TrackedAllocator<U, Category> &) const noexcept { return false; }
+    };
+
+    template<typename T, MemoryCategory Category>
+    using TrackedVector = std::vector<T, TrackedAllocator<T, Category> >;
+}
+
+#endif //CBIT_MEMORYTRACKER_H
@@ -0,0 +1,254 @@
+/**
+ * @file    Profiler.cpp
+ * @brief   Implementation of the Profiler and GpuProfiler classes.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "Profiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "utilities/Logger.h"
+
+namespace {
+    struct Zone {
+        const char *name = nullptr;
+        std::uint64_t start = 0;
+        std::uint64_t end = 0;
+    };
+
+    // Zones of one thread. Only the owning thread writes; the mutex is contended only while exporting.
+    struct ThreadTrack {
+        std::mutex mutex;
+        std::vector<Zone> zones;
+        std::size_t next = 0;
+        std::size_t count = 0;
+        std::uint32_t id = 0;
+        std::string name;
+
+        void push(const Zone &zone) {
+            std::lock_guard lock(mutex);
+            if (zones.empty()) {
+                zones.resize(cbit::Profiler::kZonesPerThread);
+            }
+            zones[next] = zone;
+            next = (next + 1) % zones.size();
+            count = std::min(count + 1, zones.size());
+        }
+    };
+
+    struct FrameMark {
+        std::uint64_t frame = 0;
+        std::uint64_t start = 0;
+    };
+
+    // Tracks are never freed, so zones of finished threads can still be exported.
+    std::mutex sTracksMutex;
+    std::vector<std::unique_ptr<ThreadTrack> > sTracks;
+    thread_local ThreadTrack *tTrack = nullptr;
+
+    ThreadTrack sGpuTrack;
+
+    std::mutex sFramesMutex;
+    std::array<FrameMark, cbit::Profiler::kMaxFrames> sFrames;
+    std::size_t sFrameNext = 0;
+    std::size_t sFrameCount = 0;
+
+    ThreadTrack &localTrack() {
+        if (!tTrack) {
+            std::lock_guard lock(sTracksMutex);
+            sTracks.push_back(std::make_unique<ThreadTrack>());
+            tTrack = sTracks.back().get();
+            tTrack->id = static_cast<std::uint32_t>(sTracks.size());
+            tTrack->name = "Thread " + std::to_string(tTrack->id);
+        }
+        return *tTrack;
+    }
+
+    void writeEscaped(std::ofstream &file, const char *text) {
+        for (const char *c = text; *c; ++c) {
+            if (*c == '"' || *c == '\\') {
+                file << '\\';
+            }
+            file << *c;
+        }
+    }
+
+    void writeZone(std::ofstream &file, bool &first, const char *name, const std::uint64_t start,
+                   const std::uint64_t duration, const std::uint32_t tid, const std::uint64_t origin) {
+        file << (first ? "\n" : ",\n") << R"({"ph":"X","pid":1,"tid":)" << tid << R"(,"name":")";
+        writeEscaped(file, name);
+        file << R"(","ts":)" << static_cast<double>(start - origin) / 1000.0
+                << R"(,"dur":)" << static_cast<double>(duration) / 1000.0 << "}";
+        first = false;
+    }
+
+    void writeTrackName(std::ofstream &file, bool &first, const std::uint32_t tid, const std::string &name) {
+        file << (first ? "\n" : ",\n") << R"({"ph":"M","pid":1,"tid":)" << tid
+                << R"(,"name":"thread_name","args":{"name":")";
+        writeEscaped(file, name.c_str());
+        file << R"("}})";
+        first = false;
+    }
+
+    // The GPU track is listed after every thread track.
+    constexpr std::uint32_t kGpuTrackId = 1000;
+}
+
+std::atomic<bool> cbit::Profiler::_enabled{true};
+
+void cbit::Profiler::setEnabled(const bool enabled) {
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void cbit::Profiler::setThreadName(const std::string &name) {
+    ThreadTrack &track = localTrack();
+    std::lock_guard lock(track.mutex);
+    track.name = name;
+}
+
+void cbit::Profiler::beginFrame(const std::uint64_t frame) {
+    if (!isEnabled()) {
+        return;
+    }
+
+    std::lock_guard lock(sFramesMutex);
+    sFrames[sFrameNext] = {frame, now()};
+    sFrameNext = (sFrameNext + 1) % sFrames.size();
+    sFrameCount = std::min(sFrameCount + 1, sFrames.size());
+}
+
+void cbit::Profiler::recordZone(const char *name, const std::uint64_t start, const std::uint64_t end) {
+    localTrack().push({name, start, end});
+}
+
+void cbit::Profiler::recordGpuZone(const char *name, const std::uint64_t submitTime, const std::uint64_t duration) {
+    sGpuTrack.push({name, submitTime, submitTime + duration});
+}
+
+bool cbit::Profiler::exportChromeTrace(const std::string &path) {
+    std::vector<FrameMark> frames;
+    {
+        std::lock_guard lock(sFramesMutex);
+        for (std::size_t i = 0; i < sFrameCount; ++i) {
+            frames.push_back(sFrames[(sFrameNext + sFrames.size() - sFrameCount + i) % sFrames.size()]);
+        }
+    }
+    if (frames.empty()) {
+        Logger::log()->warn("No profiled frames to export.");
+        return false;
+    }
+
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        Logger::log()->error("Unable to open trace file {}", path);
+        return false;
+    }
+
+    // Timestamps are relative to the oldest frame kept; zones that started before it are left out.
+    const std::uint64_t origin = frames.front().start;
+    const std::uint64_t exportTime = now();
+    bool first = true;
+    std::size_t zoneCount = 0;
+    file << R"({"displayTimeUnit":"ms","traceEvents":[)";
+
+    auto writeTrack = [&](ThreadTrack &track, const std::uint32_t tid, const char *name) {
+        std::lock_guard lock(track.mutex);
+        writeTrackName(file, first, tid, name ? name : track.name);
+        for (std::size_t i = 0; i < track.count; ++i) {
+            const Zone &zone = track.zones[(track.next + track.zones.size() - track.count + i) % track.zones.size()];
+            if (zone.start >= origin) {
+                writeZone(file, first, zone.name, zone.start, zone.end - zone.start, tid, origin);
+                ++zoneCount;
+            }
+        }
+    };
+
+    {
+        std::lock_guard lock(sTracksMutex);
+        for (const auto &track: sTracks) {
+            writeTrack(*track, track->id, nullptr);
+        }
+    }
+    writeTrack(sGpuTrack, kGpuTrackId, "GPU");
+
+    // Frames go on their own track so they do not nest under the zones of the main thread.
+    constexpr std::uint32_t kFrameTrackId = 0;
+    writeTrackName(file, first, kFrameTrackId, "Frames");
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        const std::uint64_t end = i + 1 < frames.size() ? frames[i + 1].start : exportTime;
+        const std::string name = "Frame " + std::to_string(frames[i].frame);
+        writeZone(file, first, name.c_str(), frames[i].start, end - frames[i].start, kFrameTrackId, origin);
+    }
+
+    file << "\n]}\n";
+    if (!file) {
+        Logger::log()->error("Failed to write trace file {}", path);
+        return false;
+    }
+
+    Logger::log()->info("Exported {} zones over {} frames to {}", zoneCount, frames.size(), path);
+    return true;
+}
+
+cbit::GpuProfiler::~GpuProfiler() {
+    if (_created) {
+        for (auto &frame: _frames) {
+            glDeleteQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+        }
+    }
+}
+
+void cbit::GpuProfiler::beginFrame() {
+    _current = (_current + 1) % _frames.size();
+    Frame &frame = _frames[_current];
+
+    // This slot was last filled kLatency frames ago; by now its results are normally available.
+    for (std::size_t i = 0; i < frame.count; ++i) {
+        GLint available = GL_FALSE;
+        glGetQueryObjectiv(frame.queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available == GL_TRUE) {
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &elapsed);
+            Profiler::recordGpuZone(frame.names[i], frame.submitTimes[i], elapsed);
+        }
+    }
+    frame.count = 0;
+}
+
+void cbit::GpuProfiler::begin(const char *name) {
+    if (_depth++ > 0 || !Profiler::isEnabled()) {
+        return;
+    }
+
+    Frame &frame = _frames[_current];
+    if (frame.count == frame.queries.size()) {
+        return;
+    }
+
+    if (!_created) {
+        for (auto &slot: _frames) {
+            glGenQueries(static_cast<GLsizei>(slot.queries.size()), slot.queries.data());
+        }
+        _created = true;
+    }
+
+    frame.names[frame.count] = name;
+    frame.submitTimes[frame.count] = Profiler::now();
+    glBeginQuery(GL_TIME_ELAPSED, frame.queries[frame.count]);
+    _recording = true;
+}
+
+void cbit::GpuProfiler::end() {
+    if (--_depth > 0 || !_recording) {
+        return;
+    }
+
+    glEndQuery(GL_TIME_ELAPSED);
+    ++_frames[_current].count;
+    _recording = false;
+}
@@ -0,0 +1,202 @@
+/**
+ * @file    Profiler.h
+ * @brief   Header file for the Profiler, ProfileScope and GpuProfiler classes.
+ * @details Scoped CPU and GPU timing zones. CPU zones are recorded per thread into fixed-size rings; GPU zones use
+ *          GL_TIME_ELAPSED queries that are read back a few frames later so the CPU never waits on the GPU. The
+ *          last frames can be exported as a Chrome trace_event JSON file and opened in chrome://tracing or Perfetto.
+ *
+ *          Instrument code with CBIT_PROFILE_SCOPE("Name") and CBIT_PROFILE_GPU_SCOPE(gpuProfiler, "Name"). Zone
+ *          names must be string literals or otherwise outlive the profiler. Building with CBIT_PROFILER_ENABLED=0
+ *          (the CBIT_ENABLE_PROFILER CMake option) compiles the zones out entirely.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_PROFILER_H
+#define CBIT_PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "OpenGLInclude.h"
+
+#ifndef CBIT_PROFILER_ENABLED
+#define CBIT_PROFILER_ENABLED 1
+#endif
+
+#define CBIT_PROFILE_CONCAT_INNER(a, b) a##b
+#define CBIT_PROFILE_CONCAT(a, b) CBIT_PROFILE_CONCAT_INNER(a, b)
+
+#if CBIT_PROFILER_ENABLED
+#define CBIT_PROFILE_SCOPE(name) \
+    const ::cbit::ProfileScope CBIT_PROFILE_CONCAT(cbitProfileScope, __LINE__)(name)
+#define CBIT_PROFILE_GPU_SCOPE(profiler, name) \
+    const ::cbit::GpuProfileScope CBIT_PROFILE_CONCAT(cbitGpuProfileScope, __LINE__)(profiler, name)
+#else
+#define CBIT_PROFILE_SCOPE(name) static_cast<void>(0)
+#define CBIT_PROFILE_GPU_SCOPE(profiler, name) static_cast<void>(0)
+#endif
+
+namespace cbit {
+    /**
+     * @class Profiler
+     * @brief Process-wide store of timing zones and frame boundaries.
+     * @details Every thread that records a zone gets its own ring of kZonesPerThread zones, so recording never
+     *          contends with other threads. Frame boundaries are kept for the last kMaxFrames frames; an export
+     *          contains the zones of those frames.
+     */
+    class Profiler {
+    public:
+        static constexpr std::size_t kMaxFrames = 240;
+        static constexpr std::size_t kZonesPerThread = 16384;
+
+        /**
+         * Turn recording on or off at runtime. On by default.
+         * @param enabled If false, zones cost one atomic load and record nothing.
+         */
+        static void setEnabled(bool enabled);
+
+        static bool isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+
+        /**
+         * Name the calling thread's track in exported traces.
+         * @param name Track name, e.g. "Main" or "Worker 1".
+         */
+        static void setThreadName(const std::string &name);
+
+        /**
+         * Mark the start of a frame on the main thread. The previous frame ends here.
+         * @param frame Frame number.
+         */
+        static void beginFrame(std::uint64_t frame);
+
+        /**
+         * Get the profiler clock.
+         * @return Monotonic time in nanoseconds.
+         */
+        static std::uint64_t now() {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        /**
+         * Record a finished CPU zone on the calling thread's track.
+         * @param name Zone name; must outlive the profiler.
+         * @param start Start time from now().
+         * @param end End time from now().
+         */
+        static void recordZone(const char *name, std::uint64_t start, std::uint64_t end);
+
+        /**
+         * Record a resolved GPU zone on the GPU track.
+         * @param name Zone name; must outlive the profiler.
+         * @param submitTime CPU time at which the zone's commands were issued.
+         * @param duration GPU time spent on the zone in nanoseconds.
+         */
+        static void recordGpuZone(const char *name, std::uint64_t submitTime, std::uint64_t duration);
+
+        /**
+         * Write the zones of the last kMaxFrames frames as Chrome trace_event JSON.
+         * @param path Output file; overwritten.
+         * @return false if the file could not be written.
+         */
+        static bool exportChromeTrace(const std::string &path);
+
+    private:
+        static std::atomic<bool> _enabled;
+    };
+
+    /**
+     * @class ProfileScope
+     * @brief Records a CPU zone from construction to destruction. Use through CBIT_PROFILE_SCOPE.
+     */
+    class ProfileScope {
+    public:
+        explicit ProfileScope(const char *name) : _name(name), _start(Profiler::isEnabled() ? Profiler::now() : 0) {
+        }
+
+        ~ProfileScope() {
+            if (_start != 0) {
+                Profiler::recordZone(_name, _start, Profiler::now());
+            }
+        }
+
+        ProfileScope(const ProfileScope &) = delete;
+        ProfileScope &operator=(const ProfileScope &) = delete;
+
+    private:
+        const char *_name;
+        std::uint64_t _start;
+    };
+
+    /**
+     * @class GpuProfiler
+     * @brief GL_TIME_ELAPSED query pool for the GPU zones of one GL context.
+     * @details Queries are cycled over kLatency frames. beginFrame() reads the results of the frame that last used
+     *          the slot it is about to reuse; results that are still not available are dropped rather than waited
+     *          for. Elapsed-time queries cannot nest, so a zone opened inside another GPU zone is ignored.
+     *
+     *          Must be created, used and destroyed on the thread that owns the GL context.
+     */
+    class GpuProfiler {
+    public:
+        static constexpr std::size_t kLatency = 4;
+        static constexpr std::size_t kMaxZonesPerFrame = 16;
+
+        GpuProfiler() = default;
+
+        ~GpuProfiler();
+
+        GpuProfiler(const GpuProfiler &) = delete;
+        GpuProfiler &operator=(const GpuProfiler &) = delete;
+
+        /**
+         * Start a new frame of GPU zones and publish the results of an earlier frame.
+         */
+        void beginFrame();
+
+        void begin(const char *name);
+
+        void end();
+
+    private:
+        struct Frame {
+            std::array<GLuint, kMaxZonesPerFrame> queries{};
+            std::array<const char *, kMaxZonesPerFrame> names{};
+            std::array<std::uint64_t, kMaxZonesPerFrame> submitTimes{};
+            std::size_t count = 0;
+        };
+
+        std::array<Frame, kLatency> _frames;
+        std::size_t _current = 0;
+        int _depth = 0;
+        bool _recording = false;
+        bool _created = false;
+    };
+
+    /**
+     * @class GpuProfileScope
+     * @brief Records a GPU zone around the GL commands issued in its scope. Use through CBIT_PROFILE_GPU_SCOPE.
+     */
+    class GpuProfileScope {
+    public:
+        GpuProfileScope(GpuProfiler &profiler, const char *name) : _profiler(profiler) {
+            _profiler.begin(name);
+        }
+
+        ~GpuProfileScope() {
+            _profiler.end();
+        }
+
+        GpuProfileScope(const GpuProfileScope &) = delete;
+        GpuProfileScope &operator=(const GpuProfileScope &) = delete;
+
+    private:
+        GpuProfiler &_profiler;
+    };
+}
+
+#endif //CBIT_PROFILER_H
@@ -0,0 +1,119 @@
+/**
+ * @file    RenderThread.cpp
+ * @brief   Implementation of the RenderThread class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "RenderThread.h"
+
+#include "Profiler.h"
+#include "graphics/renderers/GLThread.h"
+#include "graphics/renderers/SceneRenderer.h"
+#include "utilities/Logger.h"
+
+cbit::RenderThread::RenderThread(GLFWwindow *window) : _window(window) {
+    GLThread::setWakeCallback([this] {
+        std::lock_guard lock(_mutex);
+        _condition.notify_all();
+    });
+
+    glfwMakeContextCurrent(nullptr);
+    _thread = std::thread(&RenderThread::_run, this);
+
+    // Until the thread owns the context, GLThread::run() would still execute GL work inline on this thread.
+    std::unique_lock lock(_mutex);
+    _condition.wait(lock, [this] { return _started; });
+    Logger::log()->info("Render thread started.");
+}
+
+cbit::RenderThread::~RenderThread() {
+    {
+        std::lock_guard lock(_mutex);
+        _stopping = true;
+    }
+    _condition.notify_all();
+    _thread.join();
+
+    GLThread::setWakeCallback(nullptr);
+    glfwMakeContextCurrent(_window);
+    GLThread::makeCurrent();
+    Logger::log()->info("Render thread stopped.");
+}
+
+cbit::RenderSnapshot &cbit::RenderThread::acquire() {
+    // The previous snapshot must have been picked up, otherwise publishing this one would drop it undrawn.
+    CBIT_PROFILE_SCOPE("RenderThread::acquire");
+    std::unique_lock lock(_mutex);
+    _condition.wait(lock, [this] { return _pendingIndex < 0 && _writeIndex != _drawingIndex; });
+    return _snapshots[_writeIndex];
+}
+
+void cbit::RenderThread::publish() {
+    {
+        std::lock_guard lock(_mutex);
+        _pendingIndex = _writeIndex;
+        _writeIndex = 1 - _writeIndex;
+        GLThread::framePublished();
+    }
+    _condition.notify_all();
+}
+
+void cbit::RenderThread::_run() {
+    glfwMakeContextCurrent(_window);
+    GLThread::makeCurrent();
+    Profiler::setThreadName("Render");
+    {
+        std::lock_guard lock(_mutex);
+        _started = true;
+    }
+    _condition.notify_all();
+
+    {
+        SceneRenderer renderer;
+
+        while (true) {
+            int index;
+            {
+                std::unique_lock lock(_mutex);
+                _condition.wait(lock, [this] {
+                    return _stopping || _pendingIndex >= 0 || GLThread::hasPendingWork();
+                });
+                if (_stopping) {
+                    if (_pendingIndex >= 0) {
+                        // Never drawn; count it so objects released while it was pending can be deleted.
+                        GLThread::frameSubmitted();
+                        _pendingIndex = -1;
+                    }
+                    break;
+                }
+                index = _pendingIndex;
+                _pendingIndex = -1;
+                _drawingIndex = index;
+            }
+
+            // Resource uploads and deletions requested by the main thread since the last frame.
+            GLThread::executePending();
+
+            if (index < 0) {
+                continue;
+            }
+
+            renderer.submit(_snapshots[index]);
+            {
+                CBIT_PROFILE_SCOPE("SwapBuffers");
+                glfwSwapBuffers(_window);
+            }
+            GLThread::frameSubmitted();
+
+            {
+                std::lock_guard lock(_mutex);
+                _drawingIndex = -1;
+            }
+            _condition.notify_all();
+        }
+    }
+
+    GLThread::executePending();
+    glfwMakeContextCurrent(nullptr);
+}
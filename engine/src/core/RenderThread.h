@@ -0,0 +1,73 @@
+/**
+ * @file    RenderThread.h
+ * @brief   Header file for the RenderThread class.
+ * @details Optional thread that owns the OpenGL context and submits render snapshots, so simulating frame N+1 on
+ *          the main thread overlaps drawing and swapping frame N.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_RENDERTHREAD_H
+#define CBIT_RENDERTHREAD_H
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "OpenGLInclude.h"
+#include "graphics/renderers/RenderSnapshot.h"
+
+namespace cbit {
+    /**
+     * @class RenderThread
+     * @brief Double-buffered hand-off of render snapshots to a thread that owns the GL context.
+     * @details The main thread fills the snapshot returned by acquire() and hands it over with publish(); the
+     *          render thread draws it and swaps buffers while the main thread fills the other snapshot. acquire()
+     *          blocks while both snapshots are in use, so the simulation runs at most one frame ahead.
+     *
+     *          Window events must still be polled on the main thread; GL work posted with GLThread::run() is
+     *          executed between frames.
+     */
+    class RenderThread {
+    public:
+        /**
+         * Move the window's GL context to a new render thread.
+         * @param window Window whose context is current on the calling thread.
+         */
+        explicit RenderThread(GLFWwindow *window);
+
+        /**
+         * Stop the render thread and make the context current on the calling thread again.
+         */
+        ~RenderThread();
+
+        RenderThread(const RenderThread &) = delete;
+        RenderThread &operator=(const RenderThread &) = delete;
+
+        /**
+         * Get the snapshot to fill for the next frame, waiting until the renderer no longer reads it.
+         * @return Snapshot owned by the caller until publish().
+         */
+        RenderSnapshot &acquire();
+
+        /**
+         * Hand the acquired snapshot to the render thread.
+         */
+        void publish();
+
+    private:
+        GLFWwindow *_window;
+        RenderSnapshot _snapshots[2];
+        int _writeIndex = 0;
+        int _pendingIndex = -1;
+        int _drawingIndex = -1;
+        bool _started = false;
+        bool _stopping = false;
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        std::thread _thread;
+
+        void _run();
+    };
+}
+
+#endif //CBIT_RENDERTHREAD_H
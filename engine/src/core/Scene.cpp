@@ -13,19 +13,19 @@
 void cbit::Scene::setWindowSize(const int width, const int height) {
     _windowHeight = height;
     _windowWidth = width;
+    _world.setViewportSize(width, height);
 }
 
 void cbit::Scene::update(float deltaTime) {
     _world.update(deltaTime);
 }
 
+void cbit::Scene::extract(RenderSnapshot &snapshot) {
+    snapshot.clearColor = _backgroundColor.glmVec4;
+    _world.extract(snapshot);
+}
+
 void cbit::Scene::render() {
-    glClearColor(
-        _backgroundColor.glmVec4.r,
-        _backgroundColor.glmVec4.g,
-        _backgroundColor.glmVec4.b,
-        _backgroundColor.glmVec4.a);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     _world.render();
 }
 
@@ -51,8 +51,17 @@ namespace cbit {
         virtual void update(float deltaTime);
 
         /**
-         * Renders the scene.
-         * @details This method is called to render the scene, drawing all game objects and UI elements.
+         * Extracts the scene into a render snapshot.
+         * @param snapshot Frame being extracted.
+         * @details This method is called on the simulation thread after update to copy everything the renderer
+         *          needs to draw all game objects and UI elements, including the background clear color.
+         */
+        virtual void extract(RenderSnapshot &snapshot);
+
+        /**
+         * Renders the scene with immediate GL calls.
+         * @details Called after the extracted snapshot has been drawn, on the main thread only; it is skipped when a
+         *          render thread owns the GL context. The default implementation runs the ISystem render hooks.
          */
         virtual void render();
 
@@ -9,6 +9,8 @@
  */
 
 #include "SceneManager.h"
+#include "MemoryTracker.h"
+#include "Profiler.h"
 #include "utilities/Logger.h"
 
 cbit::SceneManager::SceneManager(): _currentScene(nullptr) {
@@ -49,6 +51,7 @@ void cbit::SceneManager::setActiveScene(const std::string &name) {
 
     if (_currentScene) {
         _currentScene->cleanup(); // Clean up the current scene before switching
+        MemoryTracker::logReport("left scene '" + getActiveScene() + "'");
     }
 
     _currentScene = scenes->second;
@@ -56,19 +59,37 @@ void cbit::SceneManager::setActiveScene(const std::string &name) {
     if (_currentScene) {
         _currentScene->setSceneManager(this);
         _currentScene->setWindow(_window);
+        _currentScene->setWindowSize(_viewportWidth, _viewportHeight);
         _currentScene->initialize(); // Initialize the new current scene
+        MemoryTracker::logReport("entered scene '" + name + "'");
+    }
+}
+
+void cbit::SceneManager::setViewportSize(const int width, const int height) {
+    _viewportWidth = width;
+    _viewportHeight = height;
+    if (_currentScene) {
+        _currentScene->setWindowSize(width, height);
     }
 }
 
 void cbit::SceneManager::update(const float deltaTime) const {
+    CBIT_PROFILE_SCOPE("SceneManager::update");
     if (_currentScene) {
         _currentScene->update(deltaTime);
     }
 }
 
-void cbit::SceneManager::render(int windowWidth, int windowHeight) const {
+void cbit::SceneManager::extract(RenderSnapshot &snapshot) const {
+    CBIT_PROFILE_SCOPE("SceneManager::extract");
+    if (_currentScene) {
+        _currentScene->extract(snapshot);
+    }
+}
+
+void cbit::SceneManager::render() const {
+    CBIT_PROFILE_SCOPE("SceneManager::render");
     if (_currentScene) {
-        _currentScene->setWindowSize(windowWidth, windowHeight);
         _currentScene->render();
     }
 }
@@ -62,6 +62,14 @@ namespace cbit {
          */
         void setActiveScene(const std::string &name);
 
+        /**
+         * Set the framebuffer size the scenes are drawn at.
+         * @details Called once per frame before the simulation runs; a scene entered later starts with the same size.
+         * @param width Width in pixels.
+         * @param height Height in pixels.
+         */
+        void setViewportSize(int width, int height);
+
         /**
          * Update all scenes in the manager.
          * @param deltaTime Time since the last update in seconds.
@@ -69,12 +77,16 @@ namespace cbit {
         void update(float deltaTime) const;
 
         /**
-         * Render all scenes in the manager.
-         * @details This method calls the render method of each scene in the manager.
-         * @param windowWidth  Width of the window in pixels.
-         * @param windowHeight Height of the window in pixels.
+         * Extract the active scene into a render snapshot.
+         * @param snapshot Frame being extracted; interpolationAlpha and the framebuffer size must be set.
+         */
+        void extract(RenderSnapshot &snapshot) const;
+
+        /**
+         * Run the immediate-mode render hooks of the active scene.
+         * @details Only called when the application renders on the main thread.
          */
-        void render(int windowWidth, int windowHeight) const;
+        void render() const;
 
         /**
          * Clean up resources used by the SceneManager.
@@ -87,6 +99,7 @@ namespace cbit {
         std::unordered_map<std::string, std::shared_ptr<Scene> > _scenes;
         std::shared_ptr<Scene> _currentScene;
         GLFWwindow *_window{nullptr};
+        int _viewportWidth = 0, _viewportHeight = 0;
     };
 }
 #endif //CBIT_SCENEMANAGER_H
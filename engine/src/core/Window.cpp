@@ -82,6 +82,7 @@ cbit::Window::~Window() {
     }
     glfwTerminate();
     Logger::log()->info("Window destroyed and GLFW terminated");
+    Logger::log()->flush(); // Write out messages still queued for the logging thread
 }
 
 bool cbit::Window::shouldClose() const {
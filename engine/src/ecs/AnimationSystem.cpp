@@ -7,147 +7,299 @@
 
 #include "AnimationSystem.h"
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
 #include "Components.h"
+#include "SceneView.h"
+#include "core/JobSystem.h"
+#include "core/Profiler.h"
 #include "utilities/Logger.h"
 #include "glm/glm.hpp"
 
+namespace {
+    // Entities per chunk handed to a worker. Small enough to balance a handful of units across threads,
+    // large enough that chunk claiming stays negligible for crowds.
+    constexpr size_t kAnimationGrainSize = 8;
+
+#if CBIT_LOG_ACTIVE_LEVEL <= CBIT_LOG_LEVEL_DEBUG
+    void logClipDiagnostics(const cbit::AnimatorComponent &animatorComponent,
+                            const cbit::SkinnedMeshComponent &skinnedMesh) {
+        const auto logClipIt = animatorComponent.clips.find(animatorComponent.activeClip);
+        if (logClipIt != animatorComponent.clips.end()) {
+            const auto &clip = logClipIt->second;
+            CBIT_LOG_DEBUG("Animation clip '{}' duration={} tps={} channels={}",
+                           clip.getName(),
+                           clip.getDuration(),
+                           clip.getTicksPerSecond(),
+                           clip.getChannels().size());
+            if (!clip.getChannels().empty()) {
+                const auto &entry = *clip.getChannels().begin();
+                const auto &channel = entry.second;
+                const float posStart = channel.positions.empty() ? 0.0f : channel.positions.front().timeStamp;
+                const float posEnd = channel.positions.empty() ? 0.0f : channel.positions.back().timeStamp;
+                const float rotStart = channel.rotations.empty() ? 0.0f : channel.rotations.front().timeStamp;
+                const float rotEnd = channel.rotations.empty() ? 0.0f : channel.rotations.back().timeStamp;
+                const float scaleStart = channel.scales.empty() ? 0.0f : channel.scales.front().timeStamp;
+                const float scaleEnd = channel.scales.empty() ? 0.0f : channel.scales.back().timeStamp;
+                CBIT_LOG_DEBUG(
+                    "Channel '{}' keys pos={} rot={} scale={} posTime=[{},{}] rotTime=[{},{}] scaleTime=[{},{}]",
+                    entry.first,
+                    channel.positions.size(),
+                    channel.rotations.size(),
+                    channel.scales.size(),
+                    posStart, posEnd,
+                    rotStart, rotEnd,
+                    scaleStart, scaleEnd);
+            }
+
+            const auto &boneMap = skinnedMesh.mesh.getBoneMap();
+            CBIT_LOG_DEBUG("Skinned mesh bones count={}", boneMap.size());
+            int bonePrinted = 0;
+            for (const auto &pair: boneMap) {
+                CBIT_LOG_DEBUG("Bone name[{}]: {}", bonePrinted, pair.first);
+                if (++bonePrinted >= 10) {
+                    break;
+                }
+            }
+
+            int channelPrinted = 0;
+            for (const auto &pair: clip.getChannels()) {
+                CBIT_LOG_DEBUG("Channel name[{}]: {}", channelPrinted, pair.first);
+                if (++channelPrinted >= 10) {
+                    break;
+                }
+            }
+
+            for (const auto &pair: clip.getChannels()) {
+                const auto &channel = pair.second;
+                if (channel.rotations.size() >= 2) {
+                    const auto &first = channel.rotations.front().rotation;
+                    const auto &second = channel.rotations[1].rotation;
+                    const float delta = glm::length(glm::vec4(first.x - second.x,
+                                                               first.y - second.y,
+                                                               first.z - second.z,
+                                                               first.w - second.w));
+                    CBIT_LOG_DEBUG("Channel '{}' rotation delta between key0 and key1: {}",
+                                   pair.first, delta);
+                    break;
+                }
+            }
+
+            size_t movingChannels = 0;
+            for (const auto &pair: clip.getChannels()) {
+                const auto &channel = pair.second;
+                float positionDelta = 0.0f;
+                float rotationDelta = 0.0f;
+                float scaleDelta = 0.0f;
+                if (channel.positions.size() >= 2) {
+                    const auto &first = channel.positions.front().position;
+                    const auto &second = channel.positions[1].position;
+                    positionDelta = glm::length(second - first);
+                }
+                if (channel.rotations.size() >= 2) {
+                    const auto &first = channel.rotations.front().rotation;
+                    const auto &second = channel.rotations[1].rotation;
+                    rotationDelta = glm::length(glm::vec4(first.x - second.x,
+                                                          first.y - second.y,
+                                                          first.z - second.z,
+                                                          first.w - second.w));
+                }
+                if (channel.scales.size() >= 2) {
+                    const auto &first = channel.scales.front().scale;
+                    const auto &second = channel.scales[1].scale;
+                    scaleDelta = glm::length(second - first);
+                }
+
+                if (positionDelta > 0.0001f || rotationDelta > 0.0001f || scaleDelta > 0.0001f) {
+                    movingChannels++;
+                }
+            }
+
+            CBIT_LOG_DEBUG("Animation channels with non-zero delta in first two keys: {}/{}",
+                           movingChannels, clip.getChannels().size());
+
+            std::unordered_set<std::string> nodeNames;
+            nodeNames.reserve(skinnedMesh.mesh.getSkeletonNodes().size());
+            for (const auto &node: skinnedMesh.mesh.getSkeletonNodes()) {
+                nodeNames.insert(node.name);
+            }
+
+            size_t matchedChannels = 0;
+            for (const auto &pair: clip.getChannels()) {
+                if (nodeNames.find(pair.first) != nodeNames.end()) {
+                    matchedChannels++;
+                }
+            }
+            CBIT_LOG_DEBUG("Animation channels matched to skeleton nodes: {}/{}",
+                           matchedChannels, clip.getChannels().size());
+        }
+    }
+#endif
+}
+
 void cbit::AnimationSystem::update(entt::registry &registry, const float deltaTime) {
     const auto view = registry.view<SkinnedMeshComponent, AnimatorComponent>();
 
-    for (const auto entity: view) {
-        const auto &[skinnedMesh, animatorComponent] = view.get<SkinnedMeshComponent, AnimatorComponent>(entity);
-
-        if (animatorComponent.activeClip.empty()) {
-            continue;
+    // Resolve clips, LOD levels and clip switches serially; only the per-entity work below runs on workers.
+    {
+        CBIT_PROFILE_SCOPE("AnimationSystem::resolve");
+        SceneView sceneView;
+        bool hasSceneView = false;
+        if (const auto *viewport = registry.ctx().find<Viewport>(); viewport && viewport->isValid()) {
+            hasSceneView = buildSceneView(registry, viewport->getAspectRatio(), sceneView);
         }
 
-        if (animatorComponent.previousClip != animatorComponent.activeClip) {
-            animatorComponent.animator.reset();
-            animatorComponent.previousClip = animatorComponent.activeClip;
-            if (!animatorComponent.activeClip.empty()) {
-                const auto logClipIt = animatorComponent.clips.find(animatorComponent.activeClip);
-                if (logClipIt != animatorComponent.clips.end()) {
-                    const auto &clip = logClipIt->second;
-                    Logger::log()->info("Animation clip '{}' duration={} tps={} channels={}",
-                                        clip.getName(),
-                                        clip.getDuration(),
-                                        clip.getTicksPerSecond(),
-                                        clip.getChannels().size());
-                    if (!clip.getChannels().empty()) {
-                        const auto &entry = *clip.getChannels().begin();
-                        const auto &channel = entry.second;
-                        const float posStart = channel.positions.empty() ? 0.0f : channel.positions.front().timeStamp;
-                        const float posEnd = channel.positions.empty() ? 0.0f : channel.positions.back().timeStamp;
-                        const float rotStart = channel.rotations.empty() ? 0.0f : channel.rotations.front().timeStamp;
-                        const float rotEnd = channel.rotations.empty() ? 0.0f : channel.rotations.back().timeStamp;
-                        const float scaleStart = channel.scales.empty() ? 0.0f : channel.scales.front().timeStamp;
-                        const float scaleEnd = channel.scales.empty() ? 0.0f : channel.scales.back().timeStamp;
-                        Logger::log()->info(
-                            "Channel '{}' keys pos={} rot={} scale={} posTime=[{},{}] rotTime=[{},{}] scaleTime=[{},{}]",
-                            entry.first,
-                            channel.positions.size(),
-                            channel.rotations.size(),
-                            channel.scales.size(),
-                            posStart, posEnd,
-                            rotStart, rotEnd,
-                            scaleStart, scaleEnd);
-                    }
-
-                    const auto &boneMap = skinnedMesh.mesh.getBoneMap();
-                    Logger::log()->info("Skinned mesh bones count={}", boneMap.size());
-                    int bonePrinted = 0;
-                    for (const auto &pair: boneMap) {
-                        Logger::log()->info("Bone name[{}]: {}", bonePrinted, pair.first);
-                        if (++bonePrinted >= 10) {
-                            break;
-                        }
-                    }
-
-                    int channelPrinted = 0;
-                    for (const auto &pair: clip.getChannels()) {
-                        Logger::log()->info("Channel name[{}]: {}", channelPrinted, pair.first);
-                        if (++channelPrinted >= 10) {
-                            break;
-                        }
-                    }
-
-                    for (const auto &pair: clip.getChannels()) {
-                        const auto &channel = pair.second;
-                        if (channel.rotations.size() >= 2) {
-                            const auto &first = channel.rotations.front().rotation;
-                            const auto &second = channel.rotations[1].rotation;
-                            const float delta = glm::length(glm::vec4(first.x - second.x,
-                                                                       first.y - second.y,
-                                                                       first.z - second.z,
-                                                                       first.w - second.w));
-                            Logger::log()->info("Channel '{}' rotation delta between key0 and key1: {}",
-                                                pair.first, delta);
-                            break;
-                        }
-                    }
-
-                    size_t movingChannels = 0;
-                    for (const auto &pair: clip.getChannels()) {
-                        const auto &channel = pair.second;
-                        float positionDelta = 0.0f;
-                        float rotationDelta = 0.0f;
-                        float scaleDelta = 0.0f;
-                        if (channel.positions.size() >= 2) {
-                            const auto &first = channel.positions.front().position;
-                            const auto &second = channel.positions[1].position;
-                            positionDelta = glm::length(second - first);
-                        }
-                        if (channel.rotations.size() >= 2) {
-                            const auto &first = channel.rotations.front().rotation;
-                            const auto &second = channel.rotations[1].rotation;
-                            rotationDelta = glm::length(glm::vec4(first.x - second.x,
-                                                                  first.y - second.y,
-                                                                  first.z - second.z,
-                                                                  first.w - second.w));
-                        }
-                        if (channel.scales.size() >= 2) {
-                            const auto &first = channel.scales.front().scale;
-                            const auto &second = channel.scales[1].scale;
-                            scaleDelta = glm::length(second - first);
-                        }
-
-                        if (positionDelta > 0.0001f || rotationDelta > 0.0001f || scaleDelta > 0.0001f) {
-                            movingChannels++;
-                        }
-                    }
-
-                    Logger::log()->info("Animation channels with non-zero delta in first two keys: {}/{}",
-                                        movingChannels, clip.getChannels().size());
-
-                    std::unordered_set<std::string> nodeNames;
-                    nodeNames.reserve(skinnedMesh.mesh.getSkeletonNodes().size());
-                    for (const auto &node: skinnedMesh.mesh.getSkeletonNodes()) {
-                        nodeNames.insert(node.name);
-                    }
-
-                    size_t matchedChannels = 0;
-                    for (const auto &pair: clip.getChannels()) {
-                        if (nodeNames.find(pair.first) != nodeNames.end()) {
-                            matchedChannels++;
-                        }
-                    }
-                    Logger::log()->info("Animation channels matched to skeleton nodes: {}/{}",
-                                        matchedChannels, clip.getChannels().size());
+        _jobs.clear();
+        _layerStates.clear();
+        for (const auto entity: view) {
+            const auto &[skinnedMesh, animatorComponent] = view.get<SkinnedMeshComponent, AnimatorComponent>(entity);
+
+            if (animatorComponent.activeClip.empty()) {
+                continue;
+            }
+
+            const auto clipIt = animatorComponent.clips.find(animatorComponent.activeClip);
+
+            if (animatorComponent.previousClip != animatorComponent.activeClip) {
+                const auto previousIt = animatorComponent.clips.find(animatorComponent.previousClip);
+                if (previousIt != animatorComponent.clips.end() && clipIt != animatorComponent.clips.end()) {
+                    animatorComponent.animator.crossFade(&previousIt->second, animatorComponent.crossFadeDuration);
+                } else {
+                    animatorComponent.animator.crossFade(nullptr, 0.0f);
                 }
+                animatorComponent.previousClip = animatorComponent.activeClip;
+#if CBIT_LOG_ACTIVE_LEVEL <= CBIT_LOG_LEVEL_DEBUG
+                logClipDiagnostics(animatorComponent, skinnedMesh);
+#endif
             }
+
+            if (clipIt == animatorComponent.clips.end()) {
+                CBIT_LOG_WARN_RATE_LIMITED(1.0, "Missing animation clip '{}' on entity.", animatorComponent.activeClip);
+                continue;
+            }
+
+            // Layer times are advanced here with the rest of the bookkeeping; the workers only read them.
+            const size_t layerBegin = _layerStates.size();
+            for (auto &layer: animatorComponent.layers) {
+                const auto layerClipIt = animatorComponent.clips.find(layer.clip);
+                if (layerClipIt == animatorComponent.clips.end() || layer.weight <= 0.0f) {
+                    continue;
+                }
+                layer.time = Animator::advanceTime(layerClipIt->second, layer.time, deltaTime, layer.loop,
+                                                   layer.playbackSpeed);
+                _layerStates.push_back({&layerClipIt->second, layer.time, layer.weight, layer.additive});
+            }
+
+            const AnimationLod lod = hasSceneView && animatorComponent.lodSettings.enabled
+                                         ? _selectLod(registry, entity, skinnedMesh.mesh, animatorComponent, sceneView)
+                                         : AnimationLod::Full;
+            const bool lodChanged = lod != animatorComponent.lod;
+            animatorComponent.lod = lod;
+
+            _jobs.push_back({
+                &animatorComponent, &clipIt->second, &skinnedMesh.mesh,
+                layerBegin, _layerStates.size() - layerBegin, lod, lodChanged
+            });
         }
+    }
 
-        const auto clipIt = animatorComponent.clips.find(animatorComponent.activeClip);
-        if (clipIt == animatorComponent.clips.end()) {
-            Logger::log()->warn("Missing animation clip '{}' on entity.", animatorComponent.activeClip);
-            continue;
+    JobSystem::get().parallelFor(_jobs.size(), kAnimationGrainSize,
+                                 [this, deltaTime](const size_t begin, const size_t end, unsigned int) {
+                                     CBIT_PROFILE_SCOPE("AnimationSystem::evaluate");
+                                     for (size_t i = begin; i < end; ++i) {
+                                         _runJob(_jobs[i], deltaTime);
+                                     }
+                                 });
+
+    // Baked crowd units only carry a playback time; their palettes are fetched on the GPU.
+    const auto bakedView = registry.view<BakedAnimationComponent>();
+    for (const auto entity: bakedView) {
+        auto &baked = bakedView.get<BakedAnimationComponent>(entity);
+        baked.time += deltaTime * baked.playbackSpeed;
+
+        if (baked.animation && baked.clip >= 0 && baked.clip < static_cast<int>(baked.animation->getClips().size())) {
+            const auto &clip = baked.animation->getClips()[baked.clip];
+            if (clip.loop && clip.duration > 0.0f) {
+                baked.time = std::fmod(baked.time, clip.duration);
+            }
         }
+    }
+}
+
+void cbit::AnimationSystem::declareAccess(SystemAccess &access) const {
+    access.writes<AnimatorComponent, BakedAnimationComponent>()
+            .reads<SkinnedMeshComponent, TransformComponent, ModelOffsetComponent>()
+            .reads<CameraComponent, ActiveCameraComponent>();
+}
+
+cbit::AnimationLod cbit::AnimationSystem::_selectLod(entt::registry &registry,
+                                                     const entt::entity entity,
+                                                     const SkinnedMesh &mesh,
+                                                     const AnimatorComponent &animator,
+                                                     const SceneView &sceneView) {
+    const auto *transform = registry.try_get<TransformComponent>(entity);
+    if (!transform) {
+        return AnimationLod::Full;
+    }
+
+    const auto &settings = animator.lodSettings;
+    const glm::mat4 model = computeModelMatrix(*transform, registry.try_get<ModelOffsetComponent>(entity));
+
+    const glm::vec3 localCenter = (mesh.getBoundsMin() + mesh.getBoundsMax()) * 0.5f;
+    const float localRadius = glm::length(mesh.getBoundsMax() - mesh.getBoundsMin()) * 0.5f;
+    const float maxScale = std::max({
+        glm::length(glm::vec3(model[0])),
+        glm::length(glm::vec3(model[1])),
+        glm::length(glm::vec3(model[2]))
+    });
+
+    const glm::vec3 worldCenter = glm::vec3(model * glm::vec4(localCenter, 1.0f));
+    const float worldRadius = localRadius * maxScale * settings.boundsScale;
+
+    bool visible = true;
+    const float screenHeight = projectedScreenHeight(sceneView, worldCenter, worldRadius, visible);
+    if (!visible && !settings.animateWhenCulled) {
+        return AnimationLod::Culled;
+    }
+
+    const float distance = glm::length(worldCenter - sceneView.cameraPosition);
+    if (screenHeight >= settings.fullRateScreenHeight || distance <= settings.fullRateDistance) {
+        return AnimationLod::Full;
+    }
 
-        animatorComponent.animator.update(
-            &clipIt->second,
-            skinnedMesh.mesh,
-            deltaTime,
-            animatorComponent.loop,
-            animatorComponent.playbackSpeed);
+    return AnimationLod::Reduced;
+}
+
+void cbit::AnimationSystem::_runJob(const AnimationJob &job, const float deltaTime) const {
+    auto &component = *job.animator;
+    auto &animator = component.animator;
+    const AnimationLayerState *layers = job.layerCount > 0 ? &_layerStates[job.layerBegin] : nullptr;
+
+    // Playback time always advances so throttled units stay in sync with their clips.
+    animator.advance(*job.clip, deltaTime, component.loop, component.playbackSpeed);
+
+    switch (job.lod) {
+        case AnimationLod::Full:
+            animator.evaluate(*job.clip, *job.mesh, layers, job.layerCount);
+            break;
+        case AnimationLod::Reduced: {
+            const float interval = 1.0f / std::max(component.lodSettings.reducedRate, 0.001f);
+            if (job.lodChanged) {
+                animator.discardKeyframes();
+                component.lodTimer = interval;
+            } else {
+                component.lodTimer += deltaTime;
+            }
+
+            if (component.lodTimer >= interval) {
+                component.lodTimer = std::fmod(component.lodTimer, interval);
+                animator.evaluateKeyframe(*job.clip, *job.mesh, layers, job.layerCount);
+            }
+            animator.interpolateKeyframes(component.lodTimer / interval);
+            break;
+        }
+        case AnimationLod::Culled:
+            break;
     }
 }
@@ -9,12 +9,61 @@
 #ifndef CBIT_ANIMATIONSYSTEM_H
 #define CBIT_ANIMATIONSYSTEM_H
 
+#include <vector>
 #include "ISystem.h"
 
 namespace cbit {
+    class AnimationClip;
+    class SkinnedMesh;
+    struct AnimatorComponent;
+    struct AnimationLayerState;
+    struct SceneView;
+    enum class AnimationLod;
+
+    /**
+     * @class AnimationSystem
+     * @brief Updates every animated skinned mesh in the registry.
+     * @details Clip bookkeeping runs on the calling thread; the per-entity skeleton evaluation is then split into
+     *          chunks that run on the engine JobSystem. Each entity only writes its own Animator, so the result
+     *          does not depend on how the work was distributed, and update() returns only once every chunk has
+     *          finished, before anything is rendered.
+     *
+     *          Each animator also gets an AnimationLod from its projected size on screen (see AnimationLodSettings):
+     *          large or nearby units evaluate every frame, small ones at a reduced rate with interpolated palettes,
+     *          and off-screen ones keep advancing time with a frozen palette.
+     *
+     *          A change of activeClip cross-fades from the previous clip over crossFadeDuration, and the animator's
+     *          layers are resolved to clips here and evaluated on top of the active clip.
+     *
+     *          Units using a BakedAnimationComponent only have their playback time advanced here.
+     */
     class AnimationSystem final : public ISystem {
     public:
         void update(entt::registry &registry, float deltaTime) override;
+        void declareAccess(SystemAccess &access) const override;
+        const char *getName() const override { return "AnimationSystem"; }
+
+    private:
+        struct AnimationJob {
+            AnimatorComponent *animator = nullptr;
+            const AnimationClip *clip = nullptr;
+            const SkinnedMesh *mesh = nullptr;
+            size_t layerBegin = 0; // Range in _layerStates.
+            size_t layerCount = 0;
+            AnimationLod lod{};
+            bool lodChanged = false;
+        };
+
+        static AnimationLod _selectLod(entt::registry &registry,
+                                       entt::entity entity,
+                                       const SkinnedMesh &mesh,
+                                       const AnimatorComponent &animator,
+                                       const SceneView &sceneView);
+
+        void _runJob(const AnimationJob &job, float deltaTime) const;
+
+        std::vector<AnimationJob> _jobs;
+        std::vector<AnimationLayerState> _layerStates;
     };
 }
 
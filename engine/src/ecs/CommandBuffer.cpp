@@ -0,0 +1,135 @@
+/**
+ * @file    CommandBuffer.cpp
+ * @brief   Implementation of the CommandBuffer and CommandBuffers classes.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "CommandBuffer.h"
+
+#include <algorithm>
+#include <tuple>
+#include "core/JobSystem.h"
+#include "core/Profiler.h"
+#include "utilities/Logger.h"
+
+cbit::CommandEntity cbit::CommandBuffer::create(const std::uint64_t sortKey) {
+    CommandEntity entity;
+    entity.deferred = static_cast<std::uint32_t>(_creates.size());
+    entity.slot = _slot;
+    _creates.push_back({sortKey, _sequence++});
+    return entity;
+}
+
+void cbit::CommandBuffer::destroy(const CommandEntity entity) {
+    _destroys.emplace_back(entity, _sequence++);
+}
+
+void cbit::CommandBuffer::_clear() {
+    _sequence = 0;
+    _creates.clear();
+    _created.clear();
+    _destroys.clear();
+    for (const auto &batch: _batches) {
+        batch->clear();
+    }
+}
+
+cbit::CommandBuffers::CommandBuffers(const unsigned int threadCount) : _buffers(std::max(1u, threadCount)) {
+    for (std::uint32_t i = 0; i < _buffers.size(); ++i) {
+        _buffers[i]._slot = i;
+    }
+}
+
+cbit::CommandBuffer &cbit::CommandBuffers::local() {
+    const unsigned int threadIndex = JobSystem::getCurrentThreadIndex();
+    if (threadIndex >= _buffers.size()) {
+        // Buffers cannot grow while threads record; this only happens if the JobSystem changed size.
+        CBIT_LOG_ERROR_RATE_LIMITED(1.0, "No command buffer for thread {}; recording on the main thread buffer.",
+                                    threadIndex);
+        return _buffers[0];
+    }
+    return _buffers[threadIndex];
+}
+
+void cbit::CommandBuffers::clear() {
+    for (auto &buffer: _buffers) {
+        buffer._clear();
+    }
+}
+
+entt::entity cbit::CommandBuffers::resolve(const CommandEntity &entity) const {
+    if (!entity.isDeferred()) {
+        return entity.entity;
+    }
+    if (entity.slot >= _buffers.size()) {
+        return entt::null;
+    }
+    const auto &created = _buffers[entity.slot]._created;
+    return entity.deferred < created.size() ? created[entity.deferred] : entt::null;
+}
+
+void cbit::CommandBuffers::playback(entt::registry &registry) {
+    CBIT_PROFILE_SCOPE("CommandBuffers::playback");
+    // Creates: ordered by sort key so entity ids do not depend on which thread recorded them.
+    _orderedCreates.clear();
+    for (auto &buffer: _buffers) {
+        buffer._created.assign(buffer._creates.size(), entt::null);
+        for (std::uint32_t i = 0; i < buffer._creates.size(); ++i) {
+            _orderedCreates.push_back({buffer._creates[i].sortKey, buffer._slot, buffer._creates[i].sequence, i});
+        }
+    }
+    std::sort(_orderedCreates.begin(), _orderedCreates.end(), [](const OrderedCreate &lhs, const OrderedCreate &rhs) {
+        return std::tie(lhs.sortKey, lhs.slot, lhs.sequence) < std::tie(rhs.sortKey, rhs.slot, rhs.sequence);
+    });
+    for (const auto &create: _orderedCreates) {
+        _buffers[create.slot]._created[create.index] = registry.create();
+    }
+
+    // Component commands: one batch per component type, so each storage is touched in one contiguous pass.
+    _types.clear();
+    for (const auto &buffer: _buffers) {
+        for (const auto &batch: buffer._batches) {
+            _types.push_back(batch->type);
+        }
+    }
+    std::sort(_types.begin(), _types.end());
+    _types.erase(std::unique(_types.begin(), _types.end()), _types.end());
+
+    for (const entt::id_type type: _types) {
+        _pending.clear();
+        for (auto &buffer: _buffers) {
+            for (const auto &batch: buffer._batches) {
+                if (batch->type == type) {
+                    batch->collect(*this, buffer._slot, _pending);
+                }
+            }
+        }
+        std::sort(_pending.begin(), _pending.end(),
+                  [](const CommandBuffer::PendingOp &lhs, const CommandBuffer::PendingOp &rhs) {
+                      return std::tie(lhs.entity, lhs.slot, lhs.sequence) < std::tie(rhs.entity, rhs.slot, rhs.sequence);
+                  });
+        for (const auto &pending: _pending) {
+            if (pending.entity != entt::null && registry.valid(pending.entity)) {
+                pending.batch->apply(registry, pending.entity, pending.op);
+            }
+        }
+    }
+
+    // Destroys last, so commands recorded for an entity before its destruction still apply cleanly.
+    _destroyed.clear();
+    for (const auto &buffer: _buffers) {
+        for (const auto &[entity, sequence]: buffer._destroys) {
+            _destroyed.push_back(resolve(entity));
+        }
+    }
+    std::sort(_destroyed.begin(), _destroyed.end());
+    _destroyed.erase(std::unique(_destroyed.begin(), _destroyed.end()), _destroyed.end());
+    for (const auto entity: _destroyed) {
+        if (entity != entt::null && registry.valid(entity)) {
+            registry.destroy(entity);
+        }
+    }
+
+    clear();
+}
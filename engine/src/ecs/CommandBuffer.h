@@ -0,0 +1,242 @@
+/**
+ * @file    CommandBuffer.h
+ * @brief   Header file for the CommandBuffer and CommandBuffers classes.
+ * @details Deferred structural changes to the registry. Systems running concurrently (or code iterating a view)
+ *          record entity creation, destruction and component emplacement/removal into the command buffer of their
+ *          thread; the buffers are played back on the main thread at a sync point.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_COMMANDBUFFER_H
+#define CBIT_COMMANDBUFFER_H
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "entt/entt.hpp"
+
+namespace cbit {
+    class CommandBuffers;
+
+    /**
+     * @struct CommandEntity
+     * @brief  Target of a recorded command: an existing entity, or one created by the same command buffer.
+     */
+    struct CommandEntity {
+        static constexpr std::uint32_t kNotDeferred = UINT32_MAX;
+
+        entt::entity entity = entt::null;
+        std::uint32_t deferred = kNotDeferred; // Index of the create command within its buffer.
+        std::uint32_t slot = 0; // Buffer that recorded the create command.
+
+        CommandEntity() = default;
+
+        CommandEntity(const entt::entity existing) : entity(existing) { // NOLINT(*-explicit-constructor)
+        }
+
+        [[nodiscard]] bool isDeferred() const { return deferred != kNotDeferred; }
+    };
+
+    /**
+     * @class CommandBuffer
+     * @brief Records structural registry changes made by one thread.
+     * @details Obtain the buffer of the calling thread through CommandBuffers::local(). Recording allocates only
+     *          while a buffer grows; buffers keep their capacity between frames.
+     */
+    class CommandBuffer {
+    public:
+        /**
+         * Record the creation of an entity.
+         * @param sortKey Orders creates from different threads at playback (e.g. the id of the source entity), so
+         *                created entity ids do not depend on thread scheduling.
+         * @return Handle usable as target of later commands in any buffer of the same frame.
+         */
+        CommandEntity create(std::uint64_t sortKey = 0);
+
+        /**
+         * Record the destruction of an entity. Destroys are played back after every other command.
+         * @param entity Entity to destroy; invalid entities are skipped at playback.
+         */
+        void destroy(CommandEntity entity);
+
+        /**
+         * Record adding or replacing a component.
+         * @tparam Component Component type.
+         * @param entity Target entity.
+         * @param args Arguments used to construct the component now; the value is moved in at playback.
+         */
+        template<typename Component, typename... Args>
+        void emplace(const CommandEntity entity, Args &&... args) {
+            auto &batch = _batch<Component>();
+            batch.ops.push_back({entity, _sequence++, static_cast<std::uint32_t>(batch.values.size()), false});
+            batch.values.emplace_back(std::forward<Args>(args)...);
+        }
+
+        /**
+         * Record removing a component; missing components are ignored at playback.
+         * @tparam Component Component type.
+         * @param entity Target entity.
+         */
+        template<typename Component>
+        void remove(const CommandEntity entity) {
+            _batch<Component>().ops.push_back({entity, _sequence++, 0, true});
+        }
+
+        [[nodiscard]] bool empty() const { return _sequence == 0; }
+
+    private:
+        friend class CommandBuffers;
+
+        struct PendingOp;
+
+        struct BatchBase {
+            explicit BatchBase(const entt::id_type batchType) : type(batchType) {
+            }
+
+            virtual ~BatchBase() = default;
+            virtual void collect(const CommandBuffers &buffers, std::uint32_t slot,
+                                 std::vector<PendingOp> &pending) = 0;
+            virtual void apply(entt::registry &registry, entt::entity entity, std::uint32_t op) = 0;
+            virtual void clear() = 0;
+
+            entt::id_type type;
+        };
+
+        template<typename Component>
+        struct Batch final : BatchBase {
+            struct Op {
+                CommandEntity target;
+                std::uint32_t sequence;
+                std::uint32_t value;
+                bool remove;
+            };
+
+            Batch() : BatchBase(entt::type_id<Component>().hash()) {
+            }
+
+            void collect(const CommandBuffers &buffers, std::uint32_t slot, std::vector<PendingOp> &pending) override;
+
+            void apply(entt::registry &registry, const entt::entity entity, const std::uint32_t op) override {
+                const Op &record = ops[op];
+                if (record.remove) {
+                    registry.remove<Component>(entity);
+                } else {
+                    registry.emplace_or_replace<Component>(entity, std::move(values[record.value]));
+                }
+            }
+
+            void clear() override {
+                ops.clear();
+                values.clear();
+            }
+
+            std::vector<Op> ops;
+            std::vector<Component> values;
+        };
+
+        struct Create {
+            std::uint64_t sortKey;
+            std::uint32_t sequence;
+        };
+
+        template<typename Component>
+        Batch<Component> &_batch() {
+            const entt::id_type type = entt::type_id<Component>().hash();
+            for (const auto &batch: _batches) {
+                if (batch->type == type) {
+                    return static_cast<Batch<Component> &>(*batch);
+                }
+            }
+            _batches.push_back(std::make_unique<Batch<Component> >());
+            return static_cast<Batch<Component> &>(*_batches.back());
+        }
+
+        void _clear();
+
+        std::uint32_t _slot = 0;
+        std::uint32_t _sequence = 0;
+        std::vector<Create> _creates;
+        std::vector<entt::entity> _created; // Filled at playback; indexed like _creates.
+        std::vector<std::pair<CommandEntity, std::uint32_t> > _destroys;
+        std::vector<std::unique_ptr<BatchBase> > _batches;
+    };
+
+    /**
+     * @class CommandBuffers
+     * @brief One CommandBuffer per JobSystem thread, played back together at a sync point.
+     * @details Playback is deterministic for a given set of recorded commands: creates run first ordered by
+     *          (sort key, recording order), then component commands batched per component type (types ordered by
+     *          type id, commands by target entity, then recording order), then destroys ordered by entity.
+     *          The EntityComponentSystem stores an instance in the registry context; systems reach it through
+     *          ISystem::commands().
+     */
+    class CommandBuffers {
+    public:
+        /**
+         * Constructor.
+         * @param threadCount JobSystem::getThreadCount(), one buffer per thread index.
+         */
+        explicit CommandBuffers(unsigned int threadCount);
+
+        /**
+         * Get the command buffer of the calling thread.
+         * @return Buffer indexed by JobSystem::getCurrentThreadIndex().
+         */
+        CommandBuffer &local();
+
+        /**
+         * Apply and clear every recorded command. Must not run concurrently with recording.
+         * @param registry Registry to modify.
+         */
+        void playback(entt::registry &registry);
+
+        /**
+         * Drop every recorded command without applying it, e.g. when the registry is cleared.
+         */
+        void clear();
+
+        /**
+         * Resolve a command target to a registry entity. Only meaningful during playback.
+         * @param entity Command target.
+         * @return The existing entity, or the entity created for a deferred create.
+         */
+        [[nodiscard]] entt::entity resolve(const CommandEntity &entity) const;
+
+    private:
+        std::vector<CommandBuffer> _buffers;
+
+        // Playback scratch, kept between frames.
+        struct OrderedCreate {
+            std::uint64_t sortKey;
+            std::uint32_t slot;
+            std::uint32_t sequence;
+            std::uint32_t index;
+        };
+
+        std::vector<OrderedCreate> _orderedCreates;
+        std::vector<entt::id_type> _types;
+        std::vector<CommandBuffer::PendingOp> _pending;
+        std::vector<entt::entity> _destroyed;
+    };
+
+    struct CommandBuffer::PendingOp {
+        entt::entity entity;
+        std::uint32_t slot;
+        std::uint32_t sequence;
+        std::uint32_t op;
+        BatchBase *batch;
+    };
+
+    template<typename Component>
+    void CommandBuffer::Batch<Component>::collect(const CommandBuffers &buffers,
+                                                  const std::uint32_t slot,
+                                                  std::vector<PendingOp> &pending) {
+        for (std::uint32_t i = 0; i < ops.size(); ++i) {
+            pending.push_back({buffers.resolve(ops[i].target), slot, ops[i].sequence, i, this});
+        }
+    }
+}
+
+#endif //CBIT_COMMANDBUFFER_H
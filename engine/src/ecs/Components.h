@@ -10,21 +10,22 @@
 #ifndef CBIT_COMPONENTS_H
 #define CBIT_COMPONENTS_H
 
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include "entt/entt.hpp"
-#include "graphics/meshes/Circle.h"
-#include "graphics/meshes/Cube.h"
-#include "graphics/meshes/Ellipsoid.h"
 #include "graphics/meshes/Mesh.h"
-#include "graphics/meshes/Quad.h"
+#include "graphics/meshes/PrimitiveRegistry.h"
 #include "graphics/meshes/SkinnedMesh.h"
-#include "graphics/meshes/Sphere.h"
 #include "graphics/animation/AnimationClip.h"
 #include "graphics/animation/Animator.h"
+#include "graphics/animation/BakedAnimation.h"
 #include "math/Color.h"
 #include "math/Vector2.h"
 #include "math/Vector3.h"
+#include "utilities/UUIDGenerator.h"
 
 namespace cbit {
 #pragma region DefaultComponents
@@ -41,7 +42,7 @@ namespace cbit {
      * @brief  Identifier component for entities.
      */
     struct IdComponent {
-        std::string uuid;
+        UUID uuid;
     };
 
     /**
@@ -54,6 +55,15 @@ namespace cbit {
         Vector3 scale{1.0f, 1.0f, 1.0f};
     };
 
+    /**
+     * @struct PreviousTransformComponent
+     * @brief  Transform at the start of the last simulation tick, used to interpolate rendering between ticks.
+     * @details Maintained by the EntityComponentSystem; entities without it render at their current transform.
+     */
+    struct PreviousTransformComponent {
+        TransformComponent transform;
+    };
+
 #pragma endregion DefaultComponents
 
 #pragma region GraphicsComponents
@@ -231,61 +241,69 @@ namespace cbit {
 
     /**
      * @struct CubeComponent
-     * @brief  Cube component for storing a Cube mesh.
+     * @brief  Cube component referencing the shared cube geometry.
      */
     struct CubeComponent {
-        Cube cube;
+        PrimitiveHandle geometry = PrimitiveRegistry::cube();
     };
 
     /**
      * @struct CircleComponent
-     * @brief  Circle component for storing a Circle mesh.
+     * @brief  Circle component referencing shared circle geometry.
      */
     struct CircleComponent {
-        Circle circle;
+        PrimitiveHandle geometry = PrimitiveRegistry::circle();
+        std::uint8_t lod = 0; // Level of detail drawn last frame, picked by MeshRenderSystem.
 
         CircleComponent() = default;
 
         explicit CircleComponent(float radius, int segments = 32)
-            : circle(radius, segments) {
+            : geometry(PrimitiveRegistry::circle(radius, segments)) {
         }
     };
 
     /**
      * @struct QuadComponent
-     * @brief  Quad component for storing a Quad mesh.
+     * @brief  Quad component referencing the shared quad geometry.
      */
     struct QuadComponent {
-        Quad quad;
+        PrimitiveHandle geometry = PrimitiveRegistry::quad();
     };
 
     /**
      * @struct SphereComponent
-     * @brief  Sphere component for storing a Sphere mesh.
+     * @brief  Sphere component referencing shared sphere geometry.
      */
     struct SphereComponent {
-        Sphere sphere;
+        PrimitiveHandle geometry = PrimitiveRegistry::sphere();
+        std::uint8_t lod = 0; // Level of detail drawn last frame, picked by MeshRenderSystem.
 
         SphereComponent() = default;
 
         explicit SphereComponent(float radius, int stacks = 16, int slices = 32)
-            : sphere(radius, stacks, slices) {
+            : geometry(PrimitiveRegistry::sphere(radius, stacks, slices)) {
         }
     };
 
     /**
      * @struct EllipsoidComponent
-     * @brief  Ellipsoid component for storing an Ellipsoid mesh.
+     * @brief  Ellipsoid component referencing shared ellipsoid geometry.
      */
     struct EllipsoidComponent {
-        Ellipsoid ellipsoid;
+        PrimitiveHandle geometry;
+        std::uint8_t lod = 0; // Level of detail drawn last frame, picked by MeshRenderSystem.
 
         EllipsoidComponent(float radiusX = 1.0f, float radiusY = 1.0f, float radiusZ = 1.0f,
                            int sectorCount = 36, int stackCount = 18)
-            : ellipsoid(radiusX, radiusY, radiusZ, sectorCount, stackCount) {
+            : geometry(PrimitiveRegistry::ellipsoid(radiusX, radiusY, radiusZ, sectorCount, stackCount)) {
         }
     };
 
+    static_assert(std::is_trivially_copyable_v<CubeComponent> && std::is_trivially_copyable_v<CircleComponent> &&
+                  std::is_trivially_copyable_v<QuadComponent> && std::is_trivially_copyable_v<SphereComponent> &&
+                  std::is_trivially_copyable_v<EllipsoidComponent>,
+                  "Primitive components hold handles only");
+
     /**
      * @struct MeshComponent
      * @brief  Mesh component for storing a Mesh loaded from file.
@@ -293,11 +311,13 @@ namespace cbit {
     struct MeshComponent {
         Mesh mesh;
         std::string path;
+        std::uint8_t lod = 0; // Level of detail drawn last frame, picked by MeshRenderSystem.
 
         MeshComponent() = default;
 
-        explicit MeshComponent(const std::string &meshPath)
-            : path(meshPath) {
+        explicit MeshComponent(const std::string &meshPath,
+                               const GeometryRetention retention = GeometryRetention::Discard)
+            : mesh(retention), path(meshPath) {
             mesh.loadFromFile(meshPath);
         }
     };
@@ -309,15 +329,71 @@ namespace cbit {
     struct SkinnedMeshComponent {
         SkinnedMesh mesh;
         std::string path;
+        std::uint8_t lod = 0; // Level of detail drawn last frame, picked by MeshRenderSystem.
 
         SkinnedMeshComponent() = default;
 
-        explicit SkinnedMeshComponent(const std::string &meshPath)
+        explicit SkinnedMeshComponent(const std::string &meshPath,
+                                      const GeometryRetention retention = GeometryRetention::Discard)
             : path(meshPath) {
+            mesh.setGeometryRetention(retention);
             mesh.loadFromFile(meshPath);
         }
     };
 
+    /**
+     * @struct  BakedAnimationComponent
+     * @brief   Crowd unit skinned from a baked bone-matrix texture.
+     * @details Entities sharing the same mesh, baked animation and texture are drawn with a single instanced
+     *          call. Each unit only carries its clip ID and playback time; no Animator is evaluated for it.
+     */
+    struct BakedAnimationComponent {
+        std::shared_ptr<SkinnedMesh> mesh;
+        std::shared_ptr<const BakedAnimation> animation;
+        int clip = 0;
+        float time = 0.0f; // Playback time in seconds.
+        float playbackSpeed = 1.0f;
+    };
+
+    /**
+     * @enum  AnimationLod
+     * @brief Evaluation level chosen for an animated entity.
+     */
+    enum class AnimationLod {
+        Full, // Skeleton evaluated every frame.
+        Reduced, // Skeleton evaluated at a lower rate; palettes interpolated in between.
+        Culled // Off screen; playback time advances but the palette is frozen.
+    };
+
+    /**
+     * @struct AnimationLodSettings
+     * @brief  Thresholds used by the AnimationSystem to pick an AnimationLod.
+     * @details Screen heights are the projected diameter of the mesh bounds as a fraction of the viewport height.
+     */
+    struct AnimationLodSettings {
+        bool enabled = true;
+        float fullRateScreenHeight = 0.12f; // At or above this size the entity animates every frame.
+        float fullRateDistance = 0.0f; // Entities closer than this to the camera always animate every frame.
+        float reducedRate = 10.0f; // Evaluations per second below the full-rate threshold.
+        float boundsScale = 1.25f; // Inflates the bind-pose bounds to cover animated extremities.
+        bool animateWhenCulled = false; // Keep evaluating off screen (e.g. for attachments or shadows).
+    };
+
+    /**
+     * @struct AnimationLayer
+     * @brief  Clip played on top of the active clip of an AnimatorComponent.
+     * @details Override layers blend towards their clip by weight (e.g. an upper-body wave, or a weighted mix of
+     *          two locomotion clips); additive layers add the clip's motion relative to its first frame.
+     */
+    struct AnimationLayer {
+        std::string clip;
+        float weight = 1.0f;
+        bool additive = false;
+        bool loop = true;
+        float playbackSpeed = 1.0f;
+        float time = 0.0f; // Ticks; advanced by the AnimationSystem.
+    };
+
     /**
      * @struct AnimatorComponent
      * @brief  Animator component storing animation clips and playback state.
@@ -329,7 +405,13 @@ namespace cbit {
         float playbackSpeed = 1.0f;
         bool loop = true;
         bool autoState = true;
+        float crossFadeDuration = 0.2f; // Seconds; 0 snaps to the new clip.
+        std::vector<AnimationLayer> layers;
         Animator animator;
+
+        AnimationLodSettings lodSettings;
+        AnimationLod lod = AnimationLod::Full; // Level selected by the AnimationSystem this frame.
+        float lodTimer = 0.0f; // Time since the last evaluation at reduced rate.
     };
 
 #pragma endregion MeshComponents
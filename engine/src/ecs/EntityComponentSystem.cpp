@@ -7,40 +7,95 @@
  */
 
 #include "EntityComponentSystem.h"
+#include "CommandBuffer.h"
 #include "Components.h"
 #include "GameObject.h"
+#include "SceneView.h"
+#include "core/JobSystem.h"
+#include "core/MemoryTracker.h"
+#include "core/Profiler.h"
 #include "utilities/UUIDGenerator.h"
 
+namespace {
+    // Updates between storage samples; the walk is cheap, but the numbers only need to follow scene growth.
+    constexpr int kMemorySampleInterval = 60;
+
+    template<typename... Components>
+    std::size_t engineComponentSize(const entt::id_type type) {
+        std::size_t size = 0;
+        ((size = size == 0 && entt::type_id<Components>().hash() == type
+                     ? (std::is_empty_v<Components> ? 0 : sizeof(Components))
+                     : size), ...);
+        return size;
+    }
+}
+
 cbit::EntityComponentSystem::EntityComponentSystem() : _uiSystem(nullptr, _registry) {
-    // Constructor implementation can be added here if needed
+    _tagIndex.connect(_registry);
+    _idIndex.connect(_registry);
+    _registry.ctx().emplace<CommandBuffers>(JobSystem::get().getThreadCount());
 }
 
 void cbit::EntityComponentSystem::setWindow(GLFWwindow *window) {
     _window = window;
     _uiSystem.setWindow(window);
-    _meshRenderSystem.setWindow(window);
 }
 
-cbit::EntityComponentSystem::~EntityComponentSystem() = default;
+void cbit::EntityComponentSystem::setViewportSize(const int width, const int height) {
+    _registry.ctx().insert_or_assign(Viewport{width, height});
+}
+
+cbit::EntityComponentSystem::~EntityComponentSystem() {
+    _tagIndex.disconnect();
+    _idIndex.disconnect();
+    MemoryTracker::trackCpu(MemoryCategory::ECS, -_reportedStorageBytes);
+}
 
 void cbit::EntityComponentSystem::update(const float deltaTime) {
-    for (const auto &system: _customSystems) {
-        system->update(_registry, deltaTime);
+    CBIT_PROFILE_SCOPE("EntityComponentSystem::update");
+    _snapshotTransforms();
+
+    if (_systemsDirty) {
+        // Custom systems keep running before animation so clip changes apply in the same frame.
+        _scheduler.clear();
+        for (const auto &system: _customSystems) {
+            _scheduler.add(system.get());
+        }
+        _scheduler.add(&_animationSystem);
+        _scheduler.add(&_perfOverlaySystem);
+        _systemsDirty = false;
     }
-    _animationSystem.update(_registry, deltaTime);
+    _scheduler.update(_registry, deltaTime);
+
+    // Sync point: the UI dispatches pointer callbacks that may change anything.
     _uiSystem.update(deltaTime);
+    _registry.ctx().get<CommandBuffers>().playback(_registry);
+
+    if (--_memorySampleCountdown <= 0) {
+        _sampleMemory();
+        _memorySampleCountdown = kMemorySampleInterval;
+    }
+}
+
+void cbit::EntityComponentSystem::extract(RenderSnapshot &snapshot) {
+    CBIT_PROFILE_SCOPE("EntityComponentSystem::extract");
+    _meshRenderSystem.extract(snapshot);
+    _uiSystem.extract(snapshot);
 }
 
 void cbit::EntityComponentSystem::render() {
-    _meshRenderSystem.render();
-    _uiSystem.render();
+    CBIT_PROFILE_SCOPE("EntityComponentSystem::render");
     for (const auto &system: _customSystems) {
         system->render(_registry);
     }
 }
 
 void cbit::EntityComponentSystem::cleanup() {
+    _registry.ctx().get<CommandBuffers>().clear();
     _registry.clear();
+    _tagIndex.clear();
+    _idIndex.clear();
+    _sampleMemory();
 }
 
 cbit::GameObject cbit::EntityComponentSystem::createGameObject(const std::string &tag) {
@@ -55,11 +110,55 @@ void cbit::EntityComponentSystem::destroyGameObject(const GameObject gameObject)
 }
 
 cbit::GameObject cbit::EntityComponentSystem::getGameObject(const std::string &tag) {
-    const auto view = _registry.view<TagComponent>();
-    for (auto entity: view) {
-        if (auto &[tagComponent] = view.get<TagComponent>(entity); tagComponent == tag) {
-            return {entity, this};
+    // Guard against hash collisions; the hashed overload trusts the 64-bit hash.
+    entt::entity match = entt::null;
+    _tagIndex.forEach(hashTag(tag), [this, &tag, &match](const entt::entity entity) {
+        if (match == entt::null && _registry.get<TagComponent>(entity).tag == tag) {
+            match = entity;
         }
+    });
+    return {match, this};
+}
+
+cbit::GameObject cbit::EntityComponentSystem::getGameObject(const TagHash tag) {
+    return {_tagIndex.find(tag), this};
+}
+
+cbit::GameObject cbit::EntityComponentSystem::getGameObject(const UUID &id) {
+    return {_idIndex.find(id), this};
+}
+
+void cbit::EntityComponentSystem::_snapshotTransforms() {
+    auto &previousTransforms = _registry.storage<PreviousTransformComponent>();
+    for (const auto [entity, transform]: _registry.view<TransformComponent>().each()) {
+        if (previousTransforms.contains(entity)) {
+            previousTransforms.get(entity).transform = transform;
+        } else {
+            previousTransforms.emplace(entity, PreviousTransformComponent{transform});
+        }
+    }
+}
+
+void cbit::EntityComponentSystem::_sampleMemory() {
+    // Pools keep their capacity after entities are destroyed, so this is what the registry holds, not what it uses.
+    // Component sizes come from the engine components and from the access declared by scheduled systems.
+    std::size_t bytes = 0;
+    for (auto [type, storage]: _registry.storage()) {
+        std::size_t componentSize = engineComponentSize<
+            TagComponent, IdComponent, TransformComponent, PreviousTransformComponent, TextureComponent,
+            ShaderOverrideComponent, SkyboxComponent, BaseColorComponent, ModelOffsetComponent, RectangleComponent,
+            UIAnchorComponent, ButtonComponent, UIColorRectangleComponent, UIImageComponent, UITextComponent,
+            UIPointerCallbacksComponent, UIPointerState, CubeComponent, CircleComponent, QuadComponent,
+            SphereComponent, EllipsoidComponent, MeshComponent, SkinnedMeshComponent, BakedAnimationComponent,
+            AnimatorComponent, CameraComponent, ActiveCameraComponent, DirectionalLightComponent,
+            PointLightComponent, SpotLightComponent>(type);
+        if (componentSize == 0) {
+            componentSize = _scheduler.getComponentSize(type);
+        }
+        bytes += storage.capacity() * (sizeof(entt::entity) + componentSize) + storage.extent() * sizeof(entt::entity);
     }
-    return {entt::null, this};
+
+    const auto sampled = static_cast<std::int64_t>(bytes);
+    MemoryTracker::trackCpu(MemoryCategory::ECS, sampled - _reportedStorageBytes);
+    _reportedStorageBytes = sampled;
 }
@@ -11,7 +11,11 @@
 
 #include "ISystem.h"
 #include "AnimationSystem.h"
+#include "IdIndex.h"
 #include "MeshRenderSystem.h"
+#include "PerfOverlaySystem.h"
+#include "SystemScheduler.h"
+#include "TagIndex.h"
 #include "UISystem.h"
 #include "entt/entt.hpp"
 #include "utilities/Logger.h"
@@ -42,6 +46,15 @@ namespace cbit {
          */
         void setWindow(GLFWwindow *window);
 
+        /**
+         * Set the framebuffer size the world is drawn at.
+         * @details Stored as a Viewport in the registry context, where systems read it instead of querying the
+         *          window, so they are not tied to the main thread.
+         * @param width Width in pixels.
+         * @param height Height in pixels.
+         */
+        void setViewportSize(int width, int height);
+
         /**
          * Default destructor.
          * @details Cleans up resources used by the EntityComponentSystem.
@@ -57,9 +70,17 @@ namespace cbit {
         void update(float deltaTime);
 
         /**
-         * Render the entity-component system.
-         * @details This method is called to render all game objects and their components.
-         *          It should be called after the update method to ensure that all game objects are rendered correctly.
+         * Extract the entity-component system into a render snapshot.
+         * @details Copies the meshes, bone palettes, camera, light and UI of all game objects into the snapshot.
+         *          It should be called after the update method, on the simulation thread.
+         * @param snapshot Frame being extracted; interpolationAlpha and the framebuffer size must be set.
+         */
+        void extract(RenderSnapshot &snapshot);
+
+        /**
+         * Render the custom systems.
+         * @details Calls ISystem::render() on every added system. These hooks draw with immediate GL calls, so they
+         *          only run when the application renders on the main thread.
          */
         void render();
 
@@ -96,10 +117,38 @@ namespace cbit {
          * @param tag The tag of the game object to retrieve.
          * @return GameObject representing the game object with the specified tag.
          * @details This method retrieves a game object by its tag. If no game object with the specified tag exists,
-         *          it will return an invalid GameObject instance.
+         *          it will return an invalid GameObject instance. Lookups go through a hashed tag index and do not
+         *          depend on the number of entities.
          */
         GameObject getGameObject(const std::string &tag);
 
+        /**
+         * Get a game object by its hashed tag.
+         * @param tag The hashed tag, e.g. "enemy"_tag from cbit::literals.
+         * @return GameObject with the tag, or an invalid GameObject if none exists.
+         * @details If several game objects share the tag, any one of them is returned.
+         */
+        GameObject getGameObject(TagHash tag);
+
+        /**
+         * Get a game object by its unique ID.
+         * @param id The UUID stored in the game object's IdComponent.
+         * @return GameObject with the ID, or an invalid GameObject if none exists.
+         */
+        GameObject getGameObject(const UUID &id);
+
+        /**
+         * Invoke a function for every game object with a tag.
+         * @param tag The hashed tag.
+         * @param function Callable invoked as function(GameObject).
+         */
+        template<typename Function>
+        void forEachGameObject(const TagHash tag, Function &&function) {
+            _tagIndex.forEach(tag, [this, &function](const auto entity) {
+                function(GameObject(entity, this));
+            });
+        }
+
         /**
          * Get all game objects with specified components.
          * @tparam Components  The types of components to filter the game objects by.
@@ -201,21 +250,41 @@ namespace cbit {
          * @param args Arguments to construct the system.
          * @details This method adds a custom system of type T to the ECS.
          *          The system will be stored in the ECS and can be updated and rendered as needed.
+         *          Systems are updated through the SystemScheduler in insertion order, concurrently where their
+         *          declared component access allows (see ISystem::declareAccess).
          */
         template<typename T, typename... Args>
         void addSystem(Args &&... args) {
             _customSystems.emplace_back(std::make_unique<T>(std::forward<Args>(args)...));
+            _systemsDirty = true;
         }
 
     private:
+        /**
+         * Record every transform as the previous-tick state before the simulation advances.
+         */
+        void _snapshotTransforms();
+
+        /**
+         * Report the registry's storage size to the MemoryTracker under MemoryCategory::ECS.
+         */
+        void _sampleMemory();
+
         entt::registry _registry;
+        TagIndex _tagIndex;
+        IdIndex _idIndex;
         friend class GameObject;
         GLFWwindow *_window{nullptr};
 
         std::vector<std::unique_ptr<ISystem> > _customSystems;
+        SystemScheduler _scheduler;
+        bool _systemsDirty = true;
         UISystem _uiSystem{_window, _registry};
         AnimationSystem _animationSystem{};
         MeshRenderSystem _meshRenderSystem{_registry};
+        PerfOverlaySystem _perfOverlaySystem{};
+        std::int64_t _reportedStorageBytes = 0;
+        int _memorySampleCountdown = 0;
     };
 }
 
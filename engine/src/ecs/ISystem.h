@@ -8,6 +8,8 @@
 
 #ifndef CBIT_ISYSTEM_H
 #define CBIT_ISYSTEM_H
+#include "CommandBuffer.h"
+#include "SystemAccess.h"
 #include "entt/entt.hpp"
 
 namespace cbit {
@@ -33,13 +35,44 @@ namespace cbit {
          */
         virtual void update(entt::registry &registry, float deltaTime) = 0;
 
+        /**
+         * Declare the components the system reads and writes during update().
+         * @param access Access description to fill in.
+         * @details Systems that do not override this are treated as exclusive and run alone on the main thread.
+         *          Systems with declared access may run on a worker thread, concurrently with systems they do
+         *          not conflict with, and must not change the registry structurally or touch undeclared
+         *          component types.
+         */
+        virtual void declareAccess(SystemAccess &access) const {
+            access.exclusive();
+        }
+
+        /**
+         * Get the name of the system's profiling zone.
+         * @return String literal naming the system in profiler traces.
+         */
+        virtual const char *getName() const {
+            return "ISystem::update";
+        }
+
         /**
          * Render the system.
          * @param registry
          * @details This method is called to render the system, drawing all relevant components.
+         *          It issues GL calls directly, so it is skipped while a render thread owns the context.
          */
         virtual void render(entt::registry &registry) {
         };
+
+    protected:
+        /**
+         * Get the command buffer of the calling thread for deferred structural changes.
+         * @param registry Registry owned by an EntityComponentSystem.
+         * @return Buffer played back at the next sync point of the scheduler.
+         */
+        static CommandBuffer &commands(entt::registry &registry) {
+            return registry.ctx().get<CommandBuffers>().local();
+        }
     };
 }
 
@@ -0,0 +1,70 @@
+/**
+ * @file    IdIndex.cpp
+ * @brief   Implementation of the IdIndex class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "IdIndex.h"
+#include "Components.h"
+
+void cbit::IdIndex::connect(entt::registry &registry) {
+    disconnect();
+    _registry = &registry;
+    registry.on_construct<IdComponent>().connect<&IdIndex::_onConstruct>(*this);
+    registry.on_update<IdComponent>().connect<&IdIndex::_onUpdate>(*this);
+    registry.on_destroy<IdComponent>().connect<&IdIndex::_onDestroy>(*this);
+
+    const auto view = registry.view<IdComponent>();
+    for (const auto entity: view) {
+        _onConstruct(registry, entity);
+    }
+}
+
+void cbit::IdIndex::disconnect() {
+    if (_registry) {
+        _registry->on_construct<IdComponent>().disconnect<&IdIndex::_onConstruct>(*this);
+        _registry->on_update<IdComponent>().disconnect<&IdIndex::_onUpdate>(*this);
+        _registry->on_destroy<IdComponent>().disconnect<&IdIndex::_onDestroy>(*this);
+        _registry = nullptr;
+    }
+    clear();
+}
+
+entt::entity cbit::IdIndex::find(const UUID &id) const {
+    const auto it = _entities.find(id);
+    return it != _entities.end() ? it->second : entt::null;
+}
+
+void cbit::IdIndex::clear() {
+    _entities.clear();
+    _entityIds.clear();
+}
+
+void cbit::IdIndex::_onConstruct(entt::registry &registry, const entt::entity entity) {
+    const UUID &id = registry.get<IdComponent>(entity).uuid;
+    _entities[id] = entity;
+    _entityIds[entity] = id;
+}
+
+void cbit::IdIndex::_onUpdate(entt::registry &registry, const entt::entity entity) {
+    _erase(entity);
+    _onConstruct(registry, entity);
+}
+
+void cbit::IdIndex::_onDestroy(entt::registry &, const entt::entity entity) {
+    _erase(entity);
+}
+
+void cbit::IdIndex::_erase(const entt::entity entity) {
+    const auto idIt = _entityIds.find(entity);
+    if (idIt == _entityIds.end()) {
+        return;
+    }
+
+    const auto entityIt = _entities.find(idIt->second);
+    if (entityIt != _entities.end() && entityIt->second == entity) {
+        _entities.erase(entityIt);
+    }
+    _entityIds.erase(idIt);
+}
@@ -0,0 +1,58 @@
+/**
+ * @file    IdIndex.h
+ * @brief   Header file for the IdIndex class.
+ * @details Maps IdComponent UUIDs to entities.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_IDINDEX_H
+#define CBIT_IDINDEX_H
+
+#include <unordered_map>
+#include "entt/entt.hpp"
+#include "utilities/UUIDGenerator.h"
+
+namespace cbit {
+    /**
+     * @class IdIndex
+     * @brief UUID to entity index kept in sync through registry signals.
+     * @details Like TagIndex, the index listens to construction, update and destruction of IdComponent;
+     *          IDs changed in place must go through registry.patch() or registry.replace().
+     */
+    class IdIndex {
+    public:
+        /**
+         * Start indexing the IdComponents of a registry.
+         * @param registry Registry to listen to; must outlive the index or be disconnected first.
+         */
+        void connect(entt::registry &registry);
+
+        /**
+         * Stop listening to the registry and clear the index.
+         */
+        void disconnect();
+
+        /**
+         * Find the entity with the given ID.
+         * @param id Entity UUID.
+         * @return The entity, or entt::null.
+         */
+        [[nodiscard]] entt::entity find(const UUID &id) const;
+
+        void clear();
+
+    private:
+        void _onConstruct(entt::registry &registry, entt::entity entity);
+        void _onUpdate(entt::registry &registry, entt::entity entity);
+        void _onDestroy(entt::registry &registry, entt::entity entity);
+
+        void _erase(entt::entity entity);
+
+        entt::registry *_registry = nullptr;
+        std::unordered_map<UUID, entt::entity> _entities;
+        std::unordered_map<entt::entity, UUID> _entityIds; // ID an entity was indexed under.
+    };
+}
+
+#endif //CBIT_IDINDEX_H
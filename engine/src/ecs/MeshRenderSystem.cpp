@@ -9,380 +9,150 @@
 #include "MeshRenderSystem.h"
 
 #include "Components.h"
+#include "SceneView.h"
+#include "core/Profiler.h"
 #include <algorithm>
 #include <vector>
-#include "utilities/Logger.h"
-#include "glm/ext/matrix_clip_space.hpp"
-#include "glm/ext/matrix_transform.hpp"
+#include <glm/gtc/matrix_inverse.hpp>
 
 cbit::MeshRenderSystem::MeshRenderSystem(entt::registry &registry) : _registry(registry) {
-    // Constructor implementation can be added here if needed
-    _shader.loadShaders("resources/shaders/default.vert", "resources/shaders/default.frag");
-    _skinnedShader.loadShaders("resources/shaders/skinned.vert", "resources/shaders/default.frag");
 }
 
-void cbit::MeshRenderSystem::setWindow(GLFWwindow *window) {
-    _window = window;
-}
-
-cbit::ShaderProgram *cbit::MeshRenderSystem::_getShader(const std::string &vertexPath, const std::string &fragmentPath) {
-    if (vertexPath.empty() || fragmentPath.empty()) {
-        return &_shader;
-    }
-
-    const std::string key = vertexPath + "|" + fragmentPath;
-    const auto found = _shaderCache.find(key);
-    if (found != _shaderCache.end()) {
-        return found->second.get();
-    }
-
-    auto shader = std::make_unique<ShaderProgram>();
-    if (!shader->loadShaders(vertexPath.c_str(), fragmentPath.c_str())) {
-        Logger::log()->error("Failed to load shader override: {} / {}", vertexPath, fragmentPath);
-        return &_shader;
-    }
-
-    auto *shaderPtr = shader.get();
-    _shaderCache.emplace(key, std::move(shader));
-    return shaderPtr;
-}
-
-void cbit::MeshRenderSystem::render() {
-    const auto cameraView = _registry.view<CameraComponent, TransformComponent, ActiveCameraComponent>();
-
-    if (cameraView.begin() == cameraView.end()) {
+void cbit::MeshRenderSystem::extract(RenderSnapshot &snapshot) {
+    CBIT_PROFILE_SCOPE("MeshRenderSystem::extract");
+    if (snapshot.framebufferWidth <= 0 || snapshot.framebufferHeight <= 0) {
         return;
     }
 
-    const auto cameraEntity = *cameraView.begin();
-
-    const auto &cameraComponent = cameraView.get<CameraComponent>(cameraEntity);
+    const float aspectRatio = static_cast<float>(snapshot.framebufferWidth) / snapshot.framebufferHeight;
+    const float interpolationAlpha = snapshot.interpolationAlpha;
 
-    const auto &cameraTransformComponent = cameraView.get<TransformComponent>(cameraEntity);
-
-    if (!_window) {
+    SceneView sceneView;
+    if (!buildSceneView(_registry, aspectRatio, sceneView, interpolationAlpha)) {
         return;
     }
 
-    int windowWidth, windowHeight;
-
-    glfwGetFramebufferSize(_window, &windowWidth, &windowHeight);
-
-    if (windowWidth <= 0 || windowHeight <= 0) {
-        return;
-    }
-
-    const float aspectRatio = static_cast<float>(windowWidth) / windowHeight;
-
-    glm::mat4 projection;
-
-    switch (cameraComponent.type) {
-        case CameraType::Perspective:
-            projection = glm::perspective(
-                glm::radians(cameraComponent.fov),
-                aspectRatio,
-                cameraComponent.nearPlane,
-                cameraComponent.farPlane);
-            break;
-        case CameraType::Orthographic:
-            projection = glm::ortho(
-                cameraComponent.orthoLeft,
-                cameraComponent.orthoRight,
-                cameraComponent.orthoBottom,
-                cameraComponent.orthoTop,
-                cameraComponent.nearPlane,
-                cameraComponent.farPlane);
-            break;
-        case CameraType::Isometric: {
-            projection = glm::ortho(
-                cameraComponent.orthoLeft,
-                cameraComponent.orthoRight,
-                cameraComponent.orthoBottom,
-                cameraComponent.orthoTop,
-                cameraComponent.nearPlane,
-                cameraComponent.farPlane);
-            break;
-        }
-        default:
-            throw std::runtime_error("Unknown camera type");
-    }
-
-    const float yaw = glm::radians(cameraComponent.yaw);
-    const float pitch = glm::radians(cameraComponent.pitch);
-
-    // Standard FPS-style forward vector
-    glm::vec3 forward;
-    forward.x = cosf(pitch) * cosf(yaw);
-    forward.y = sinf(pitch);
-    forward.z = cosf(pitch) * sinf(yaw);
-
-
-    const glm::vec3 cameraPosition = cameraTransformComponent.position.toGLM();
-    const glm::vec3 cameraTarget = cameraPosition + glm::normalize(forward);
-    constexpr auto cameraUp = glm::vec3(0.0f, 1.0f, 0.0f);
-
-    const glm::mat4 viewMatrix = glm::lookAt(cameraPosition, cameraTarget, cameraUp);
-
-    glm::vec3 lightDirection{-10.0f, -10.0f, -1.0f};
-    glm::vec3 lightColor{1.0f, 1.0f, 1.0f};
-    float ambientStrength = 0.25f;
-    float lightIntensity = 1.0f;
+    snapshot.hasCamera = true;
+    snapshot.view = sceneView.view;
+    snapshot.projection = sceneView.projection;
+    snapshot.cameraPosition = sceneView.cameraPosition;
 
     auto lightView = _registry.view<DirectionalLightComponent, TransformComponent>();
     if (lightView.begin() != lightView.end()) {
         auto &lightComponent = lightView.get<DirectionalLightComponent>(*lightView.begin());
         if (lightComponent.enabled) {
-            lightDirection = lightComponent.direction.toGLM();
-            lightColor = lightComponent.diffuse.toGLM();
-            ambientStrength = (lightComponent.ambient.x + lightComponent.ambient.y + lightComponent.ambient.z) / 3.0f;
-            lightIntensity = lightComponent.intensity;
+            snapshot.lightDirection = lightComponent.direction.toGLM();
+            snapshot.lightColor = lightComponent.diffuse.toGLM();
+            snapshot.ambientStrength =
+                    (lightComponent.ambient.x + lightComponent.ambient.y + lightComponent.ambient.z) / 3.0f;
+            snapshot.lightIntensity = lightComponent.intensity;
         }
     }
 
-    ShaderProgram *currentShader = nullptr;
+    auto buildModelMatrix = [&](const entt::entity entity, const TransformComponent &transform) {
+        return computeModelMatrix(renderTransform(_registry, entity, transform, interpolationAlpha),
+                                  _registry.try_get<ModelOffsetComponent>(entity));
+    };
 
-    auto applyShaderForEntity = [&](entt::entity entity, ShaderProgram *fallbackShader) -> ShaderProgram * {
-        const auto *shaderOverride = _registry.try_get<ShaderOverrideComponent>(entity);
-        const std::string vertexPath = shaderOverride ? shaderOverride->vertexShaderPath : "";
-        const std::string fragmentPath = shaderOverride ? shaderOverride->fragmentShaderPath : "";
-        ShaderProgram *shader = fallbackShader;
+    // Shader override, texture and base color shared by every item kind.
+    auto addItem = [&](const entt::entity entity, const RenderItemKind kind, const MeshDrawCall &drawCall)
+        -> RenderMeshItem & {
+        RenderMeshItem &item = snapshot.items.emplace_back();
+        item.kind = kind;
+        item.drawCall = drawCall;
 
-        if (!vertexPath.empty() && !fragmentPath.empty()) {
-            shader = _getShader(vertexPath, fragmentPath);
+        if (const auto *shaderOverride = _registry.try_get<ShaderOverrideComponent>(entity)) {
+            item.vertexShader = snapshot.internPath(shaderOverride->vertexShaderPath);
+            item.fragmentShader = snapshot.internPath(shaderOverride->fragmentShaderPath);
         }
-
-        if (shader != currentShader) {
-            shader->use();
-
-            if (shader->hasUniform("uView")) {
-                shader->setUniform("uView", viewMatrix);
-            }
-            if (shader->hasUniform("uProjection")) {
-                shader->setUniform("uProjection", projection);
-            }
-            if (shader->hasUniform("lightDir")) {
-                shader->setUniform("lightDir", lightDirection);
-            }
-            if (shader->hasUniform("lightColor")) {
-                shader->setUniform("lightColor", lightColor);
-            }
-            if (shader->hasUniform("baseColor")) {
-                shader->setUniform("baseColor", glm::vec3(0.83f, 0.83f, 0.83f));
-            }
-            if (shader->hasUniform("ambientStrength")) {
-                shader->setUniform("ambientStrength", ambientStrength);
-            }
-            if (shader->hasUniform("lightIntensity")) {
-                shader->setUniform("lightIntensity", lightIntensity);
-            }
-            if (shader->hasUniform("lightWrap")) {
-                shader->setUniform("lightWrap", 0.35f);
-            }
-
-            currentShader = shader;
+        if (const auto *textureComponent = _registry.try_get<TextureComponent>(entity)) {
+            item.texture = snapshot.internPath(textureComponent->path);
+            item.flipTexture = textureComponent->flipVertically;
         }
-
-        return shader;
-    };
-
-    auto applyTextureForEntity = [&](ShaderProgram *shader, entt::entity entity) {
-        const auto *textureComponent = _registry.try_get<TextureComponent>(entity);
-        const bool hasTexture = textureComponent && !textureComponent->path.empty();
-
-        if (shader->hasUniform("uUseTexture")) {
-            shader->setUniform("uUseTexture", hasTexture ? 1 : 0);
+        if (const auto *baseColor = _registry.try_get<BaseColorComponent>(entity)) {
+            item.baseColor = baseColor->color.toGLM();
         }
+        return item;
+    };
 
-        if (hasTexture && shader->hasUniform("diffuseTexture")) {
-            auto [it, inserted] = _textures.try_emplace(textureComponent->path);
-            if (inserted) {
-                it->second.loadTexture(textureComponent->path, textureComponent->flipVertically);
-            }
-            glActiveTexture(GL_TEXTURE0);
-            it->second.bind();
-            shader->setUniform("diffuseTexture", 0);
-        }
+    auto addPrimitive = [&](const entt::entity entity, const TransformComponent &transform,
+                            const PrimitiveHandle geometry) {
+        addItem(entity, RenderItemKind::Static, PrimitiveRegistry::getDrawCall(geometry)).model =
+                buildModelMatrix(entity, transform);
     };
 
-    auto buildModelMatrix = [&](const entt::entity entity, const TransformComponent &transform) {
-        glm::mat4 model = glm::translate(glm::mat4(1.0f), transform.position.toGLM());
-        const glm::vec3 rotation = transform.rotation.toGLM();
-        model = glm::rotate(model, glm::radians(rotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
-        model = glm::rotate(model, glm::radians(rotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
-        model = glm::rotate(model, glm::radians(rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
-        model = glm::scale(model, transform.scale.toGLM());
-
-        if (const auto *offset = _registry.try_get<ModelOffsetComponent>(entity)) {
-            glm::mat4 offsetMatrix = glm::translate(glm::mat4(1.0f), offset->position.toGLM());
-            const glm::vec3 offsetRotation = offset->rotation.toGLM();
-            offsetMatrix = glm::rotate(offsetMatrix, glm::radians(offsetRotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
-            offsetMatrix = glm::rotate(offsetMatrix, glm::radians(offsetRotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
-            offsetMatrix = glm::rotate(offsetMatrix, glm::radians(offsetRotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
-            offsetMatrix = glm::scale(offsetMatrix, offset->scale.toGLM());
-            model *= offsetMatrix;
-        }
+    // Level of detail from the projected size of a bounding sphere; lod keeps last frame's choice for the
+    // hysteresis.
+    auto updateLod = [&](const glm::mat4 &model, const glm::vec3 &localCenter, const float localRadius,
+                         const int lodCount, std::uint8_t &lod) {
+        if (lodCount <= 1) {
+            lod = 0;
+            return;
+        }
+        const float maxScale = std::max({
+            glm::length(glm::vec3(model[0])),
+            glm::length(glm::vec3(model[1])),
+            glm::length(glm::vec3(model[2]))
+        });
+
+        bool visible = true;
+        const float screenHeight = projectedScreenHeight(sceneView, glm::vec3(model * glm::vec4(localCenter, 1.0f)),
+                                                         localRadius * maxScale, visible);
+        lod = static_cast<std::uint8_t>(selectLodLevel(lodCount, lod, screenHeight));
+    };
 
-        return model;
+    auto addLodPrimitive = [&](const entt::entity entity, const TransformComponent &transform,
+                               const PrimitiveHandle geometry, std::uint8_t &lod) {
+        const glm::mat4 model = buildModelMatrix(entity, transform);
+        updateLod(model, glm::vec3(0.0f), PrimitiveRegistry::getBoundingRadius(geometry),
+                  PrimitiveRegistry::getLodCount(geometry), lod);
+        addItem(entity, RenderItemKind::Static, PrimitiveRegistry::getDrawCall(geometry, lod)).model = model;
     };
 
     const auto skyView = _registry.view<SkyboxComponent, QuadComponent, TransformComponent, TextureComponent>();
-    if (skyView.begin() != skyView.end()) {
-        const glm::mat4 invViewRot = glm::mat4(glm::transpose(glm::mat3(viewMatrix)));
-        glDepthMask(GL_FALSE);
-        glDisable(GL_DEPTH_TEST);
-
-        for (const auto entity: skyView) {
-            auto [skybox, quad, transform] = skyView.get<SkyboxComponent, QuadComponent, TransformComponent>(entity);
-            ShaderProgram *shader = applyShaderForEntity(entity, &_shader);
-
-            if (shader->hasUniform("uInvViewRot")) {
-                shader->setUniform("uInvViewRot", invViewRot);
-            }
-
-            applyTextureForEntity(shader, entity);
-            quad.quad.draw();
-        }
-
-        glDepthMask(GL_TRUE);
-        glEnable(GL_DEPTH_TEST);
+    for (const auto entity: skyView) {
+        addItem(entity, RenderItemKind::Skybox,
+                PrimitiveRegistry::getDrawCall(skyView.get<QuadComponent>(entity).geometry));
     }
 
     const auto cubeView = _registry.view<CubeComponent, TransformComponent>();
     for (const auto entity: cubeView) {
         auto [cube, transform] = cubeView.get<CubeComponent, TransformComponent>(entity);
-        ShaderProgram *shader = applyShaderForEntity(entity, &_shader);
-
-        glm::mat4 model = buildModelMatrix(entity, transform);
-        if (shader->hasUniform("uModel")) {
-            shader->setUniform("uModel", model);
-        }
-
-        if (shader->hasUniform("baseColor")) {
-            const auto *baseColor = _registry.try_get<BaseColorComponent>(entity);
-            if (baseColor) {
-                shader->setUniform("baseColor", baseColor->color.toGLM());
-            } else {
-                shader->setUniform("baseColor", glm::vec3(0.83f, 0.83f, 0.83f));
-            }
-        }
-
-        applyTextureForEntity(shader, entity);
-        cube.cube.draw();
+        addPrimitive(entity, transform, cube.geometry);
     }
 
     const auto circleView = _registry.view<CircleComponent, TransformComponent>();
     for (const auto entity: circleView) {
         auto [circle, transform] = circleView.get<CircleComponent, TransformComponent>(entity);
-        ShaderProgram *shader = applyShaderForEntity(entity, &_shader);
-
-        glm::mat4 model = buildModelMatrix(entity, transform);
-        if (shader->hasUniform("uModel")) {
-            shader->setUniform("uModel", model);
-        }
-
-        if (shader->hasUniform("baseColor")) {
-            const auto *baseColor = _registry.try_get<BaseColorComponent>(entity);
-            if (baseColor) {
-                shader->setUniform("baseColor", baseColor->color.toGLM());
-            } else {
-                shader->setUniform("baseColor", glm::vec3(0.83f, 0.83f, 0.83f));
-            }
-        }
-
-        applyTextureForEntity(shader, entity);
-        circle.circle.draw();
+        addLodPrimitive(entity, transform, circle.geometry, circle.lod);
     }
 
     const auto quadView = _registry.view<QuadComponent, TransformComponent>();
     for (const auto entity: quadView) {
         auto [quad, transform] = quadView.get<QuadComponent, TransformComponent>(entity);
-        ShaderProgram *shader = applyShaderForEntity(entity, &_shader);
-
-        glm::mat4 model = buildModelMatrix(entity, transform);
-        if (shader->hasUniform("uModel")) {
-            shader->setUniform("uModel", model);
-        }
-
-        if (shader->hasUniform("baseColor")) {
-            const auto *baseColor = _registry.try_get<BaseColorComponent>(entity);
-            if (baseColor) {
-                shader->setUniform("baseColor", baseColor->color.toGLM());
-            } else {
-                shader->setUniform("baseColor", glm::vec3(0.83f, 0.83f, 0.83f));
-            }
-        }
-
-        applyTextureForEntity(shader, entity);
-        quad.quad.draw();
+        addPrimitive(entity, transform, quad.geometry);
     }
 
     const auto sphereView = _registry.view<SphereComponent, TransformComponent>();
     for (const auto entity: sphereView) {
         auto [sphere, transform] = sphereView.get<SphereComponent, TransformComponent>(entity);
-        ShaderProgram *shader = applyShaderForEntity(entity, &_shader);
-
-        glm::mat4 model = buildModelMatrix(entity, transform);
-        if (shader->hasUniform("uModel")) {
-            shader->setUniform("uModel", model);
-        }
-
-        if (shader->hasUniform("baseColor")) {
-            const auto *baseColor = _registry.try_get<BaseColorComponent>(entity);
-            if (baseColor) {
-                shader->setUniform("baseColor", baseColor->color.toGLM());
-            } else {
-                shader->setUniform("baseColor", glm::vec3(0.83f, 0.83f, 0.83f));
-            }
-        }
-
-        applyTextureForEntity(shader, entity);
-        sphere.sphere.draw();
+        addLodPrimitive(entity, transform, sphere.geometry, sphere.lod);
     }
 
     const auto ellipsoidView = _registry.view<EllipsoidComponent, TransformComponent>();
     for (const auto entity: ellipsoidView) {
         auto [ellipsoid, transform] = ellipsoidView.get<EllipsoidComponent, TransformComponent>(entity);
-        ShaderProgram *shader = applyShaderForEntity(entity, &_shader);
-
-        glm::mat4 model = buildModelMatrix(entity, transform);
-        if (shader->hasUniform("uModel")) {
-            shader->setUniform("uModel", model);
-        }
-
-        if (shader->hasUniform("baseColor")) {
-            const auto *baseColor = _registry.try_get<BaseColorComponent>(entity);
-            if (baseColor) {
-                shader->setUniform("baseColor", baseColor->color.toGLM());
-            } else {
-                shader->setUniform("baseColor", glm::vec3(0.83f, 0.83f, 0.83f));
-            }
-        }
-
-        applyTextureForEntity(shader, entity);
-        ellipsoid.ellipsoid.draw();
+        addLodPrimitive(entity, transform, ellipsoid.geometry, ellipsoid.lod);
     }
 
     const auto meshView = _registry.view<MeshComponent, TransformComponent>();
     for (const auto entity: meshView) {
         auto [meshComponent, transform] = meshView.get<MeshComponent, TransformComponent>(entity);
-        ShaderProgram *shader = applyShaderForEntity(entity, &_shader);
-
-        glm::mat4 model = buildModelMatrix(entity, transform);
-        if (shader->hasUniform("uModel")) {
-            shader->setUniform("uModel", model);
-        }
-
-        if (shader->hasUniform("baseColor")) {
-            const auto *baseColor = _registry.try_get<BaseColorComponent>(entity);
-            if (baseColor) {
-                shader->setUniform("baseColor", baseColor->color.toGLM());
-            } else {
-                shader->setUniform("baseColor", glm::vec3(0.83f, 0.83f, 0.83f));
-            }
-        }
-
-        applyTextureForEntity(shader, entity);
-        meshComponent.mesh.draw();
+        const Mesh &mesh = meshComponent.mesh;
+        const glm::mat4 model = buildModelMatrix(entity, transform);
+        updateLod(model, (mesh.getBoundsMin() + mesh.getBoundsMax()) * 0.5f,
+                  glm::length(mesh.getBoundsMax() - mesh.getBoundsMin()) * 0.5f, mesh.getLodCount(), meshComponent.lod);
+        addItem(entity, RenderItemKind::Static, mesh.getLodDrawCall(meshComponent.lod)).model = model;
     }
 
     const auto skinnedView = _registry.view<SkinnedMeshComponent, TransformComponent>();
@@ -390,53 +160,94 @@ void cbit::MeshRenderSystem::render() {
         auto [skinnedMesh, transform] = skinnedView.get<SkinnedMeshComponent, TransformComponent>(entity);
         const auto *animatorComponent = _registry.try_get<AnimatorComponent>(entity);
         const bool useSkinning = animatorComponent && !animatorComponent->activeClip.empty();
-        ShaderProgram *shader = applyShaderForEntity(entity, useSkinning ? &_skinnedShader : &_shader);
-
-        Logger::log()->info("Skinned render entity {} vertices={} indices={} bones={} useSkinning={}",
-                            static_cast<int>(entity),
-                            skinnedMesh.mesh.getVertexCount(),
-                            skinnedMesh.mesh.getIndexCount(),
-                            skinnedMesh.mesh.getBoneCount(),
-                            useSkinning ? 1 : 0);
-
-        glm::mat4 model = buildModelMatrix(entity, transform);
-        if (shader->hasUniform("uModel")) {
-            shader->setUniform("uModel", model);
-        }
-
-        if (shader->hasUniform("baseColor")) {
-            const auto *baseColor = _registry.try_get<BaseColorComponent>(entity);
-            if (baseColor) {
-                shader->setUniform("baseColor", baseColor->color.toGLM());
-            } else {
-                shader->setUniform("baseColor", glm::vec3(0.83f, 0.83f, 0.83f));
-            }
-        }
 
-        applyTextureForEntity(shader, entity);
+        const SkinnedMesh &mesh = skinnedMesh.mesh;
+        const glm::mat4 model = buildModelMatrix(entity, transform);
+        updateLod(model, (mesh.getBoundsMin() + mesh.getBoundsMax()) * 0.5f,
+                  glm::length(mesh.getBoundsMax() - mesh.getBoundsMin()) * 0.5f, mesh.getLodCount(), skinnedMesh.lod);
 
-        if (shader->hasUniform("uUseSkinning")) {
-            shader->setUniform("uUseSkinning", useSkinning ? 1 : 0);
-        }
+        RenderMeshItem &item = addItem(entity, RenderItemKind::Skinned, mesh.getLodDrawCall(skinnedMesh.lod));
+        item.model = model;
+        item.useSkinning = useSkinning;
 
+        // The palette is copied so the animation system can advance while the renderer reads this frame.
         const size_t boneCount = skinnedMesh.mesh.getBoneCount();
-        if (boneCount > 0 && shader->hasUniform("uBones[0]")) {
-            const auto *animatorComponent = _registry.try_get<AnimatorComponent>(entity);
+        if (boneCount > 0) {
             const auto *boneMatrices = animatorComponent ? &animatorComponent->animator.getFinalBoneMatrices() : nullptr;
-            std::vector<glm::mat4> identityMatrices;
-
-            if (!boneMatrices || boneMatrices->size() < boneCount) {
-                identityMatrices.assign(boneCount, glm::mat4(1.0f));
-                boneMatrices = &identityMatrices;
+            item.boneOffset = static_cast<std::uint32_t>(snapshot.bones.size());
+            item.boneCount = static_cast<std::uint32_t>(boneCount);
+            if (boneMatrices && boneMatrices->size() >= boneCount) {
+                snapshot.bones.insert(snapshot.bones.end(), boneMatrices->begin(), boneMatrices->begin() + boneCount);
+            } else {
+                snapshot.bones.insert(snapshot.bones.end(), boneCount, glm::mat4(1.0f));
             }
+        }
+    }
 
-            const size_t maxCount = std::min(boneCount, boneMatrices->size());
-            for (size_t i = 0; i < maxCount; ++i) {
-                const std::string uniformName = "uBones[" + std::to_string(i) + "]";
-                shader->setUniform(uniformName.c_str(), (*boneMatrices)[i]);
-            }
+    // Baked-animation crowds: one instanced draw per (mesh, animation, texture) batch.
+    _instancedItems.clear();
+    const auto bakedView = _registry.view<BakedAnimationComponent, TransformComponent>();
+    for (const auto entity: bakedView) {
+        const auto &baked = bakedView.get<BakedAnimationComponent>(entity);
+        if (!baked.mesh || !baked.animation || !baked.animation->isBaked()) {
+            continue;
         }
+        _instancedItems.push_back({
+            baked.mesh.get(),
+            baked.animation.get(),
+            _registry.try_get<TextureComponent>(entity),
+            entity
+        });
+    }
 
-        skinnedMesh.mesh.draw();
+    if (_instancedItems.empty()) {
+        return;
+    }
+
+    const auto texturePathOf = [](const TextureComponent *texture) -> const std::string & {
+        static const std::string kNoTexture;
+        return texture ? texture->path : kNoTexture;
+    };
+    const auto sameBatch = [&](const InstancedDrawItem &a, const InstancedDrawItem &b) {
+        return a.mesh == b.mesh && a.animation == b.animation && texturePathOf(a.texture) == texturePathOf(b.texture);
+    };
+    std::sort(_instancedItems.begin(), _instancedItems.end(),
+              [&](const InstancedDrawItem &a, const InstancedDrawItem &b) {
+                  if (a.mesh != b.mesh) return a.mesh < b.mesh;
+                  if (a.animation != b.animation) return a.animation < b.animation;
+                  return texturePathOf(a.texture) < texturePathOf(b.texture);
+              });
+
+    for (size_t batchBegin = 0; batchBegin < _instancedItems.size();) {
+        size_t batchEnd = batchBegin + 1;
+        while (batchEnd < _instancedItems.size() && sameBatch(_instancedItems[batchBegin], _instancedItems[batchEnd])) {
+            ++batchEnd;
+        }
+
+        const auto &first = _instancedItems[batchBegin];
+        const auto &firstBaked = bakedView.get<BakedAnimationComponent>(first.entity);
+
+        RenderInstanceBatch &batch = snapshot.batches.emplace_back();
+        batch.mesh = firstBaked.mesh;
+        batch.animation = firstBaked.animation;
+        if (first.texture) {
+            batch.texture = snapshot.internPath(first.texture->path);
+            batch.flipTexture = first.texture->flipVertically;
+        }
+        batch.instanceOffset = static_cast<std::uint32_t>(snapshot.instances.size());
+        batch.instanceCount = static_cast<std::uint32_t>(batchEnd - batchBegin);
+
+        for (size_t i = batchBegin; i < batchEnd; ++i) {
+            const auto entity = _instancedItems[i].entity;
+            const auto &[baked, transform] = bakedView.get<BakedAnimationComponent, TransformComponent>(entity);
+            const glm::mat4 model = buildModelMatrix(entity, transform);
+            snapshot.instances.push_back({
+                model,
+                glm::inverseTranspose(glm::mat3(model)),
+                glm::vec4(static_cast<float>(baked.clip), baked.time, 0.0f, 0.0f)
+            });
+        }
+
+        batchBegin = batchEnd;
     }
 }
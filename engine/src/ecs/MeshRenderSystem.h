@@ -9,17 +9,19 @@
 #ifndef CBIT_MESHRENDERSYSTEM_H
 #define CBIT_MESHRENDERSYSTEM_H
 
-#include <memory>
-#include <string>
-#include <unordered_map>
+#include <vector>
 #include "entt/entt.hpp"
-#include "graphics/renderers/ShaderProgram.h"
-#include "graphics/renderers/Texture.h"
+#include "graphics/renderers/RenderSnapshot.h"
 
 namespace cbit {
+    class BakedAnimation;
+    struct TextureComponent;
+
     /**
      * @class MeshRenderSystem
      * @brief System for rendering mesh components.
+     * @details Extracts the meshes, camera, light and baked-animation batches of the registry into a render snapshot.
+     *          It holds no GL state; SceneRenderer draws the snapshot on the GL thread.
      */
     class MeshRenderSystem {
     public:
@@ -29,23 +31,29 @@ namespace cbit {
          */
         explicit MeshRenderSystem(entt::registry &registry);
 
-        void setWindow(GLFWwindow *window);
+        MeshRenderSystem(const MeshRenderSystem &) = delete;
+        MeshRenderSystem &operator=(const MeshRenderSystem &) = delete;
 
         /**
-         * @brief Renders all mesh components.
-         * @details This method iterates through all entities with mesh components and renders them.
+         * @brief Adds all mesh components to a render snapshot.
+         * @details Transforms are blended from their previous tick by snapshot.interpolationAlpha, and the camera
+         *          aspect ratio comes from the snapshot framebuffer size.
+         * @param snapshot Frame being extracted.
          */
-        void render();
+        void extract(RenderSnapshot &snapshot);
 
     private:
-        ShaderProgram *_getShader(const std::string &vertexPath, const std::string &fragmentPath);
+        struct InstancedDrawItem {
+            SkinnedMesh *mesh = nullptr;
+            const BakedAnimation *animation = nullptr;
+            const TextureComponent *texture = nullptr;
+            entt::entity entity = entt::null;
+        };
 
-        GLFWwindow *_window{nullptr};
         entt::registry &_registry;
-        ShaderProgram _shader;
-        ShaderProgram _skinnedShader;
-        std::unordered_map<std::string, std::unique_ptr<ShaderProgram> > _shaderCache;
-        std::unordered_map<std::string, Texture> _textures;
+
+        // Baked-animation crowds, batched by (mesh, animation, texture) into instanced draws.
+        std::vector<InstancedDrawItem> _instancedItems;
     };
 }
 #endif //CBIT_MESHRENDERSYSTEM_H
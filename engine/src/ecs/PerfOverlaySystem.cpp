@@ -0,0 +1,132 @@
+/**
+ * @file    PerfOverlaySystem.cpp
+ * @brief   Implementation of the PerfOverlaySystem class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "PerfOverlaySystem.h"
+
+#include <cstdio>
+#include "Components.h"
+#include "core/AllocationCounter.h"
+#include "core/FrameArena.h"
+#include "core/Input.h"
+#include "graphics/renderers/RenderStats.h"
+
+namespace {
+    constexpr float kRefreshInterval = 0.25f;
+    constexpr float kPanelWidth = 470.0f;
+    constexpr float kLineHeight = 22.0f;
+    constexpr float kMargin = 8.0f;
+    constexpr float kFontSize = 0.28f;
+    constexpr int kZIndex = 1000;
+
+    // Frame times, memory, totals, then one line per pass.
+    constexpr std::size_t kLineCount = 3 + static_cast<std::size_t>(cbit::RenderPass::Count);
+
+    void formatPass(char *buffer, const std::size_t size, const char *label, const cbit::RenderPassStats &stats) {
+        std::snprintf(buffer, size, "%-9s %4u draws %7.1fk tris %3u prog %4u tex %5u uni", label, stats.drawCalls,
+                      static_cast<double>(stats.triangles) / 1000.0, stats.programBinds, stats.textureBinds,
+                      stats.uniformUploads);
+    }
+}
+
+bool cbit::PerfOverlaySystem::_visible = false;
+
+void cbit::PerfOverlaySystem::setVisible(const bool visible) {
+    _visible = visible;
+}
+
+bool cbit::PerfOverlaySystem::isVisible() {
+    return _visible;
+}
+
+void cbit::PerfOverlaySystem::update(entt::registry &registry, const float deltaTime) {
+    if (Input::isKeyPressed(Keyboard::F3)) {
+        _visible = !_visible;
+    }
+
+    // Scene cleanup clears the registry under the overlay.
+    const bool created = _panel != entt::null && registry.valid(_panel);
+    if (!_visible) {
+        if (created) {
+            _destroy(registry);
+        }
+        _panel = entt::null;
+        _lines.clear();
+        return;
+    }
+
+    if (!created) {
+        _create(registry);
+        _refreshTimer = 0.0f;
+    }
+
+    _refreshTimer -= deltaTime;
+    if (_refreshTimer <= 0.0f) {
+        _refresh(registry);
+        _refreshTimer = kRefreshInterval;
+    }
+}
+
+void cbit::PerfOverlaySystem::_create(entt::registry &registry) {
+    const float panelHeight = kLineHeight * static_cast<float>(kLineCount) + kMargin;
+
+    _panel = registry.create();
+    registry.emplace<UIAnchorComponent>(_panel, UIAnchor::TopRight, Vector2(-kMargin, -kMargin),
+                                        Vector2(kPanelWidth, panelHeight), kZIndex, true, false);
+    registry.emplace<UIColorRectangleComponent>(_panel, Color(0.0f, 0.0f, 0.0f, 0.6f), Color(0.0f, 0.0f, 0.0f, 0.6f),
+                                                Color(0.0f, 0.0f, 0.0f, 0.6f));
+
+    _lines.clear();
+    for (std::size_t i = 0; i < kLineCount; ++i) {
+        const entt::entity line = registry.create();
+        const float offsetY = -kMargin - kMargin * 0.5f - kLineHeight * static_cast<float>(i);
+        registry.emplace<UIAnchorComponent>(line, UIAnchor::TopRight, Vector2(-kMargin, offsetY),
+                                            Vector2(kPanelWidth, kLineHeight), kZIndex + 1, true, false);
+        registry.emplace<UITextComponent>(line, std::string(), kFontSize, Color::White);
+        _lines.push_back(line);
+    }
+}
+
+void cbit::PerfOverlaySystem::_destroy(entt::registry &registry) {
+    for (const auto line: _lines) {
+        if (registry.valid(line)) {
+            registry.destroy(line);
+        }
+    }
+    registry.destroy(_panel);
+}
+
+void cbit::PerfOverlaySystem::_refresh(entt::registry &registry) {
+    const RenderFrameStats frame = RenderStats::getLastFrame();
+    char buffer[128];
+
+    auto setLine = [&](const std::size_t index) {
+        registry.get<UITextComponent>(_lines[index]).text.assign(buffer);
+    };
+
+    std::snprintf(buffer, sizeof(buffer), "Frame  p50 %5.2f ms  p95 %5.2f ms  p99 %5.2f ms",
+                  RenderStats::getFrameTimePercentile(50.0f) * 1000.0f,
+                  RenderStats::getFrameTimePercentile(95.0f) * 1000.0f,
+                  RenderStats::getFrameTimePercentile(99.0f) * 1000.0f);
+    setLine(0);
+
+    const double arenaKilobytes = static_cast<double>(FrameArena::getLastFrameBytes()) / 1024.0;
+    if (AllocationCounter::isEnabled()) {
+        std::snprintf(buffer, sizeof(buffer), "Memory frame arena %7.1f KB  heap %4llu allocs/frame", arenaKilobytes,
+                      static_cast<unsigned long long>(AllocationCounter::getLastFrame()));
+    } else {
+        std::snprintf(buffer, sizeof(buffer), "Memory frame arena %7.1f KB", arenaKilobytes);
+    }
+    setLine(1);
+
+    formatPass(buffer, sizeof(buffer), "Total", frame.total());
+    setLine(2);
+
+    for (std::size_t i = 0; i < frame.passes.size(); ++i) {
+        formatPass(buffer, sizeof(buffer), RenderStats::getPassName(static_cast<RenderPass>(i)), frame.passes[i]);
+        setLine(3 + i);
+    }
+}
@@ -0,0 +1,45 @@
+/**
+ * @file    PerfOverlaySystem.h
+ * @brief   Header file for the PerfOverlaySystem class.
+ * @details On-screen panel with frame time percentiles, frame memory and the render counters of RenderStats, drawn
+ *          through the UI system. F3 toggles it in every scene.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_PERFOVERLAYSYSTEM_H
+#define CBIT_PERFOVERLAYSYSTEM_H
+
+#include <vector>
+#include "ISystem.h"
+
+namespace cbit {
+    /**
+     * @class PerfOverlaySystem
+     * @brief Shows frame times and per-pass draw calls, program and texture binds, uniform uploads and triangles.
+     * @details The panel is made of UIAnchorComponent entities created when it is shown and destroyed when it is
+     *          hidden, so it costs nothing while off. Its text is refreshed a few times per second rather than every
+     *          tick.
+     */
+    class PerfOverlaySystem final : public ISystem {
+    public:
+        void update(entt::registry &registry, float deltaTime) override;
+        const char *getName() const override { return "PerfOverlaySystem"; }
+
+        static void setVisible(bool visible);
+        static bool isVisible();
+
+    private:
+        static bool _visible;
+
+        std::vector<entt::entity> _lines;
+        entt::entity _panel = entt::null;
+        float _refreshTimer = 0.0f;
+
+        void _create(entt::registry &registry);
+        void _destroy(entt::registry &registry);
+        void _refresh(entt::registry &registry);
+    };
+}
+
+#endif //CBIT_PERFOVERLAYSYSTEM_H
@@ -0,0 +1,157 @@
+/**
+ * @file    SceneView.cpp
+ * @brief   Implementation of the camera and transform helpers.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "SceneView.h"
+
+#include <cmath>
+#include <stdexcept>
+#include "Components.h"
+#include "glm/ext/matrix_clip_space.hpp"
+#include "glm/ext/matrix_transform.hpp"
+
+namespace {
+    float lerpAngle(const float from, const float to, const float alpha) {
+        const float difference = std::fmod(std::fmod(to - from, 360.0f) + 540.0f, 360.0f) - 180.0f;
+        return from + difference * alpha;
+    }
+
+    cbit::Vector3 lerpVector(const cbit::Vector3 &from, const cbit::Vector3 &to, const float alpha) {
+        return {
+            from.x + (to.x - from.x) * alpha,
+            from.y + (to.y - from.y) * alpha,
+            from.z + (to.z - from.z) * alpha
+        };
+    }
+}
+
+bool cbit::buildSceneView(entt::registry &registry,
+                          const float aspectRatio,
+                          SceneView &sceneView,
+                          const float interpolationAlpha) {
+    const auto cameraView = registry.view<CameraComponent, TransformComponent, ActiveCameraComponent>();
+    if (cameraView.begin() == cameraView.end()) {
+        return false;
+    }
+
+    const auto cameraEntity = *cameraView.begin();
+    const auto &cameraComponent = cameraView.get<CameraComponent>(cameraEntity);
+    const TransformComponent cameraTransformComponent = renderTransform(
+        registry, cameraEntity, cameraView.get<TransformComponent>(cameraEntity), interpolationAlpha);
+
+    switch (cameraComponent.type) {
+        case CameraType::Perspective:
+            sceneView.projection = glm::perspective(
+                glm::radians(cameraComponent.fov),
+                aspectRatio,
+                cameraComponent.nearPlane,
+                cameraComponent.farPlane);
+            break;
+        case CameraType::Orthographic:
+        case CameraType::Isometric:
+            sceneView.projection = glm::ortho(
+                cameraComponent.orthoLeft,
+                cameraComponent.orthoRight,
+                cameraComponent.orthoBottom,
+                cameraComponent.orthoTop,
+                cameraComponent.nearPlane,
+                cameraComponent.farPlane);
+            break;
+        default:
+            throw std::runtime_error("Unknown camera type");
+    }
+
+    const float yaw = glm::radians(cameraComponent.yaw);
+    const float pitch = glm::radians(cameraComponent.pitch);
+
+    // Standard FPS-style forward vector
+    glm::vec3 forward;
+    forward.x = cosf(pitch) * cosf(yaw);
+    forward.y = sinf(pitch);
+    forward.z = cosf(pitch) * sinf(yaw);
+
+    const glm::vec3 cameraPosition = cameraTransformComponent.position.toGLM();
+    const glm::vec3 cameraTarget = cameraPosition + glm::normalize(forward);
+    constexpr auto cameraUp = glm::vec3(0.0f, 1.0f, 0.0f);
+
+    sceneView.view = glm::lookAt(cameraPosition, cameraTarget, cameraUp);
+    sceneView.viewProjection = sceneView.projection * sceneView.view;
+    sceneView.cameraPosition = cameraPosition;
+    return true;
+}
+
+cbit::TransformComponent cbit::interpolateTransform(const TransformComponent &previous,
+                                                    const TransformComponent &current,
+                                                    const float alpha) {
+    TransformComponent result;
+    result.position = lerpVector(previous.position, current.position, alpha);
+    result.rotation = {
+        lerpAngle(previous.rotation.x, current.rotation.x, alpha),
+        lerpAngle(previous.rotation.y, current.rotation.y, alpha),
+        lerpAngle(previous.rotation.z, current.rotation.z, alpha)
+    };
+    result.scale = lerpVector(previous.scale, current.scale, alpha);
+    return result;
+}
+
+cbit::TransformComponent cbit::renderTransform(const entt::registry &registry,
+                                               const entt::entity entity,
+                                               const TransformComponent &current,
+                                               const float interpolationAlpha) {
+    const auto *previous = registry.try_get<PreviousTransformComponent>(entity);
+    if (!previous || interpolationAlpha >= 1.0f) {
+        return current;
+    }
+    return interpolateTransform(previous->transform, current, interpolationAlpha);
+}
+
+glm::mat4 cbit::computeModelMatrix(const TransformComponent &transform, const ModelOffsetComponent *offset) {
+    glm::mat4 model = glm::translate(glm::mat4(1.0f), transform.position.toGLM());
+    const glm::vec3 rotation = transform.rotation.toGLM();
+    model = glm::rotate(model, glm::radians(rotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
+    model = glm::rotate(model, glm::radians(rotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
+    model = glm::rotate(model, glm::radians(rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
+    model = glm::scale(model, transform.scale.toGLM());
+
+    if (offset) {
+        glm::mat4 offsetMatrix = glm::translate(glm::mat4(1.0f), offset->position.toGLM());
+        const glm::vec3 offsetRotation = offset->rotation.toGLM();
+        offsetMatrix = glm::rotate(offsetMatrix, glm::radians(offsetRotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
+        offsetMatrix = glm::rotate(offsetMatrix, glm::radians(offsetRotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
+        offsetMatrix = glm::rotate(offsetMatrix, glm::radians(offsetRotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
+        offsetMatrix = glm::scale(offsetMatrix, offset->scale.toGLM());
+        model *= offsetMatrix;
+    }
+
+    return model;
+}
+
+float cbit::projectedScreenHeight(const SceneView &sceneView,
+                                  const glm::vec3 &center,
+                                  const float radius,
+                                  bool &visible) {
+    const glm::vec4 clip = sceneView.viewProjection * glm::vec4(center, 1.0f);
+
+    // Perspective projections keep w > 0 in front of the camera; orthographic ones always have w == 1.
+    const float w = clip.w;
+    if (w <= 0.0f) {
+        visible = w + radius > 0.0f;
+        return visible ? 1.0f : 0.0f;
+    }
+
+    // proj[1][1] maps a view-space height to NDC units; NDC spans 2 units across the viewport.
+    const float ndcRadius = radius * sceneView.projection[1][1] / w;
+    const float ndcRadiusX = radius * sceneView.projection[0][0] / w;
+    const float ndcX = clip.x / w;
+    const float ndcY = clip.y / w;
+    const float ndcZ = clip.z / w;
+
+    visible = ndcX + ndcRadiusX >= -1.0f && ndcX - ndcRadiusX <= 1.0f &&
+              ndcY + ndcRadius >= -1.0f && ndcY - ndcRadius <= 1.0f &&
+              ndcZ - ndcRadius <= 1.0f;
+
+    return ndcRadius;
+}
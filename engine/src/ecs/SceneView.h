@@ -0,0 +1,95 @@
+/**
+ * @file    SceneView.h
+ * @brief   Camera and transform helpers shared by the engine systems.
+ * @details Builds the view and projection matrices of the active camera and the model matrix of an entity,
+ *          so that rendering and visibility-driven systems (such as animation LOD) agree on what is on screen.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_SCENEVIEW_H
+#define CBIT_SCENEVIEW_H
+
+#include "entt/entt.hpp"
+#include "glm/glm.hpp"
+
+namespace cbit {
+    struct TransformComponent;
+    struct ModelOffsetComponent;
+
+    /**
+     * @struct Viewport
+     * @brief  Framebuffer size in pixels, kept in the registry context and updated once per frame.
+     */
+    struct Viewport {
+        int width = 0;
+        int height = 0;
+
+        [[nodiscard]] bool isValid() const { return width > 0 && height > 0; }
+        [[nodiscard]] float getAspectRatio() const { return static_cast<float>(width) / static_cast<float>(height); }
+    };
+
+    /**
+     * @struct SceneView
+     * @brief  Matrices of the active camera for one frame.
+     */
+    struct SceneView {
+        glm::mat4 view{1.0f};
+        glm::mat4 projection{1.0f};
+        glm::mat4 viewProjection{1.0f};
+        glm::vec3 cameraPosition{0.0f};
+    };
+
+    /**
+     * Build the scene view of the active camera.
+     * @param registry Registry holding the camera entity.
+     * @param aspectRatio Viewport width divided by height.
+     * @param sceneView Output matrices.
+     * @param interpolationAlpha Blend between the camera's previous and current tick transform.
+     * @return true if an active camera was found.
+     */
+    bool buildSceneView(entt::registry &registry, float aspectRatio, SceneView &sceneView,
+                        float interpolationAlpha = 1.0f);
+
+    /**
+     * Blend two transforms; rotations take the shortest way around each Euler angle.
+     * @param previous Transform at alpha 0.
+     * @param current Transform at alpha 1.
+     * @param alpha Blend factor in [0, 1].
+     * @return Interpolated transform.
+     */
+    TransformComponent interpolateTransform(const TransformComponent &previous,
+                                            const TransformComponent &current,
+                                            float alpha);
+
+    /**
+     * Get the transform an entity should be drawn with between two simulation ticks.
+     * @param registry Registry holding the entity.
+     * @param entity Entity to draw.
+     * @param current Current transform of the entity.
+     * @param interpolationAlpha Fraction of a tick elapsed since the last simulation step.
+     * @return Interpolated transform, or current if the entity has no PreviousTransformComponent.
+     */
+    TransformComponent renderTransform(const entt::registry &registry, entt::entity entity,
+                                       const TransformComponent &current, float interpolationAlpha);
+
+    /**
+     * Build the model matrix of an entity.
+     * @param transform Gameplay transform of the entity.
+     * @param offset Optional render-time mesh calibration.
+     * @return Model matrix with the offset applied after the transform.
+     */
+    glm::mat4 computeModelMatrix(const TransformComponent &transform, const ModelOffsetComponent *offset);
+
+    /**
+     * Estimate the on-screen height of a bounding sphere.
+     * @param sceneView Active camera matrices.
+     * @param center World-space sphere center.
+     * @param radius World-space sphere radius.
+     * @param visible Set to false when the sphere lies completely outside the view frustum.
+     * @return Projected diameter as a fraction of the viewport height.
+     */
+    float projectedScreenHeight(const SceneView &sceneView, const glm::vec3 &center, float radius, bool &visible);
+}
+
+#endif //CBIT_SCENEVIEW_H
@@ -0,0 +1,131 @@
+/**
+ * @file    SystemAccess.h
+ * @brief   Header file for the SystemAccess class.
+ * @details Component access declared by a system, used by the SystemScheduler to decide which systems may run
+ *          at the same time.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_SYSTEMACCESS_H
+#define CBIT_SYSTEMACCESS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "entt/entt.hpp"
+
+namespace cbit {
+    /**
+     * @class SystemAccess
+     * @brief Read and write sets of component types plus threading requirements of a system.
+     * @details Two systems conflict when one writes a component type the other reads or writes, or when either
+     *          is exclusive. Declared types have their storage created before systems run, so concurrent systems
+     *          never create storage in the registry while others look it up.
+     */
+    class SystemAccess {
+    public:
+        /**
+         * Declare component types the system only reads.
+         */
+        template<typename... Components>
+        SystemAccess &reads() {
+            (_add<Components>(_reads), ...);
+            return *this;
+        }
+
+        /**
+         * Declare component types the system writes.
+         */
+        template<typename... Components>
+        SystemAccess &writes() {
+            (_add<Components>(_writes), ...);
+            return *this;
+        }
+
+        /**
+         * The system must run on the main thread (OpenGL or GLFW calls).
+         */
+        SystemAccess &mainThread() {
+            _mainThread = true;
+            return *this;
+        }
+
+        /**
+         * The system may touch any component or change the registry structurally; it runs alone, on the main
+         * thread, after every earlier system finished and before any later one starts.
+         */
+        SystemAccess &exclusive() {
+            _exclusive = true;
+            _mainThread = true;
+            return *this;
+        }
+
+        [[nodiscard]] bool isMainThread() const { return _mainThread; }
+        [[nodiscard]] bool isExclusive() const { return _exclusive; }
+
+        /**
+         * Check whether two systems must not run concurrently.
+         * @param other Access of the other system.
+         * @return true if the systems conflict.
+         */
+        [[nodiscard]] bool conflictsWith(const SystemAccess &other) const {
+            if (_exclusive || other._exclusive) {
+                return true;
+            }
+            return _intersects(_writes, other._writes)
+                   || _intersects(_writes, other._reads)
+                   || _intersects(_reads, other._writes);
+        }
+
+        /**
+         * Create the storage of every declared component type.
+         * @param registry Registry the system runs on.
+         */
+        void assureStorage(entt::registry &registry) const {
+            for (const auto assure: _assure) {
+                assure(registry);
+            }
+        }
+
+        /**
+         * Get the size of a declared component type, for memory accounting.
+         * @param type Hash of the component type.
+         * @return Bytes per component; 0 for empty types and types that were not declared.
+         */
+        [[nodiscard]] std::size_t getComponentSize(const entt::id_type type) const {
+            const auto found = std::find_if(_sizes.begin(), _sizes.end(), [type](const auto &entry) {
+                return entry.first == type;
+            });
+            return found != _sizes.end() ? found->second : 0;
+        }
+
+    private:
+        template<typename Component>
+        void _add(std::vector<entt::id_type> &types) {
+            const entt::id_type type = entt::type_id<Component>().hash();
+            if (std::find(types.begin(), types.end(), type) == types.end()) {
+                types.push_back(type);
+                _assure.push_back([](entt::registry &registry) { registry.storage<Component>(); });
+                _sizes.emplace_back(type, std::is_empty_v<Component> ? 0 : sizeof(Component));
+            }
+        }
+
+        static bool _intersects(const std::vector<entt::id_type> &lhs, const std::vector<entt::id_type> &rhs) {
+            return std::any_of(lhs.begin(), lhs.end(), [&rhs](const entt::id_type type) {
+                return std::find(rhs.begin(), rhs.end(), type) != rhs.end();
+            });
+        }
+
+        std::vector<entt::id_type> _reads;
+        std::vector<entt::id_type> _writes;
+        std::vector<void (*)(entt::registry &)> _assure;
+        std::vector<std::pair<entt::id_type, std::size_t> > _sizes;
+        bool _mainThread = false;
+        bool _exclusive = false;
+    };
+}
+
+#endif //CBIT_SYSTEMACCESS_H
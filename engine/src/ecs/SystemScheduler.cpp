@@ -0,0 +1,105 @@
+/**
+ * @file    SystemScheduler.cpp
+ * @brief   Implementation of the SystemScheduler class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "SystemScheduler.h"
+
+#include "core/Profiler.h"
+
+void cbit::SystemScheduler::add(ISystem *system) {
+    Node node;
+    node.system = system;
+    system->declareAccess(node.access);
+    _nodes.push_back(std::move(node));
+    _dirty = true;
+}
+
+void cbit::SystemScheduler::clear() {
+    _nodes.clear();
+    _handles.clear();
+    _assuredRegistry = nullptr;
+    _dirty = false;
+}
+
+std::size_t cbit::SystemScheduler::getComponentSize(const entt::id_type type) const {
+    for (const auto &node: _nodes) {
+        if (const std::size_t size = node.access.getComponentSize(type)) {
+            return size;
+        }
+    }
+    return 0;
+}
+
+void cbit::SystemScheduler::update(entt::registry &registry, const float deltaTime) {
+    CBIT_PROFILE_SCOPE("SystemScheduler::update");
+    if (_dirty) {
+        _build();
+        _assuredRegistry = nullptr;
+    }
+
+    // Storage creation mutates the registry, so it happens here rather than inside concurrent systems.
+    if (_assuredRegistry != &registry) {
+        for (const auto &node: _nodes) {
+            node.access.assureStorage(registry);
+        }
+        _assuredRegistry = &registry;
+    }
+
+    auto &jobSystem = JobSystem::get();
+    CommandBuffers *commands = registry.ctx().find<CommandBuffers>();
+    _handles.assign(_nodes.size(), JobHandle{});
+
+    for (size_t i = 0; i < _nodes.size(); ++i) {
+        Node &node = _nodes[i];
+
+        if (node.access.isMainThread()) {
+            for (const size_t dependency: node.dependencies) {
+                jobSystem.wait(_handles[dependency]);
+            }
+            // Exclusive systems see the structural changes recorded by everything before them.
+            if (node.access.isExclusive() && commands) {
+                commands->playback(registry);
+            }
+            CBIT_PROFILE_SCOPE(node.system->getName());
+            node.system->update(registry, deltaTime);
+            continue; // Finished before any later node is scheduled; its handle stays invalid.
+        }
+
+        _dependencyHandles.clear();
+        for (const size_t dependency: node.dependencies) {
+            if (_handles[dependency].isValid()) {
+                _dependencyHandles.push_back(_handles[dependency]);
+            }
+        }
+
+        ISystem *system = node.system;
+        entt::registry *target = &registry;
+        _handles[i] = jobSystem.schedule([system, target, deltaTime] {
+            CBIT_PROFILE_SCOPE(system->getName());
+            system->update(*target, deltaTime);
+        }, _dependencyHandles.data(), _dependencyHandles.size());
+    }
+
+    for (const auto &handle: _handles) {
+        jobSystem.wait(handle);
+    }
+    if (commands) {
+        commands->playback(registry);
+    }
+}
+
+void cbit::SystemScheduler::_build() {
+    for (size_t i = 0; i < _nodes.size(); ++i) {
+        Node &node = _nodes[i];
+        node.dependencies.clear();
+        for (size_t j = 0; j < i; ++j) {
+            if (node.access.conflictsWith(_nodes[j].access)) {
+                node.dependencies.push_back(j);
+            }
+        }
+    }
+    _dirty = false;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file    SystemScheduler.h
+ * @brief   Header file for the SystemScheduler class.
+ * @details Runs ISystem updates as a dependency graph on the JobSystem, derived from the systems' declared
+ *          component access.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_SYSTEMSCHEDULER_H
+#define CBIT_SYSTEMSCHEDULER_H
+
+#include <vector>
+#include "ISystem.h"
+#include "core/JobSystem.h"
+
+namespace cbit {
+    /**
+     * @class SystemScheduler
+     * @brief Builds a per-frame DAG of system updates and runs non-conflicting systems concurrently.
+     * @details Insertion order is the ordering constraint: a system runs after every earlier system it conflicts
+     *          with (see SystemAccess::conflictsWith), so results match serial execution in insertion order.
+     *          Main-thread systems run inline once their dependencies finished; exclusive systems are sync
+     *          points that run alone. Command buffers in the registry context are played back before each
+     *          exclusive system and once every system finished, before update() returns.
+     */
+    class SystemScheduler {
+    public:
+        /**
+         * Append a system; the graph is rebuilt on the next update().
+         * @param system System to schedule; must outlive the scheduler or be removed with clear().
+         */
+        void add(ISystem *system);
+
+        /**
+         * Remove every system.
+         */
+        void clear();
+
+        /**
+         * Run every system once.
+         * @param registry Registry passed to the systems.
+         * @param deltaTime Time since the last update in seconds.
+         */
+        void update(entt::registry &registry, float deltaTime);
+
+        /**
+         * Get the size of a component type declared by any scheduled system.
+         * @param type Hash of the component type.
+         * @return Bytes per component, or 0 if no system declared the type.
+         */
+        [[nodiscard]] std::size_t getComponentSize(entt::id_type type) const;
+
+    private:
+        struct Node {
+            ISystem *system = nullptr;
+            SystemAccess access;
+            std::vector<size_t> dependencies; // Earlier nodes this one must wait for.
+        };
+
+        void _build();
+
+        std::vector<Node> _nodes;
+        std::vector<JobHandle> _handles;
+        std::vector<JobHandle> _dependencyHandles;
+        entt::registry *_assuredRegistry = nullptr;
+        bool _dirty = false;
+    };
+}
+
+#endif //CBIT_SYSTEMSCHEDULER_H
@@ -0,0 +1,76 @@
+/**
+ * @file    TagIndex.cpp
+ * @brief   Implementation of the TagIndex class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "TagIndex.h"
+#include "Components.h"
+
+void cbit::TagIndex::connect(entt::registry &registry) {
+    disconnect();
+    _registry = &registry;
+    registry.on_construct<TagComponent>().connect<&TagIndex::_onConstruct>(*this);
+    registry.on_update<TagComponent>().connect<&TagIndex::_onUpdate>(*this);
+    registry.on_destroy<TagComponent>().connect<&TagIndex::_onDestroy>(*this);
+
+    const auto view = registry.view<TagComponent>();
+    for (const auto entity: view) {
+        _insert(entity, hashTag(view.get<TagComponent>(entity).tag));
+    }
+}
+
+void cbit::TagIndex::disconnect() {
+    if (_registry) {
+        _registry->on_construct<TagComponent>().disconnect<&TagIndex::_onConstruct>(*this);
+        _registry->on_update<TagComponent>().disconnect<&TagIndex::_onUpdate>(*this);
+        _registry->on_destroy<TagComponent>().disconnect<&TagIndex::_onDestroy>(*this);
+        _registry = nullptr;
+    }
+    clear();
+}
+
+entt::entity cbit::TagIndex::find(const TagHash tag) const {
+    const auto it = _entities.find(tag);
+    return it != _entities.end() ? it->second : entt::null;
+}
+
+void cbit::TagIndex::clear() {
+    _entities.clear();
+    _entityTags.clear();
+}
+
+void cbit::TagIndex::_onConstruct(entt::registry &registry, const entt::entity entity) {
+    _insert(entity, hashTag(registry.get<TagComponent>(entity).tag));
+}
+
+void cbit::TagIndex::_onUpdate(entt::registry &registry, const entt::entity entity) {
+    _erase(entity);
+    _insert(entity, hashTag(registry.get<TagComponent>(entity).tag));
+}
+
+void cbit::TagIndex::_onDestroy(entt::registry &, const entt::entity entity) {
+    _erase(entity);
+}
+
+void cbit::TagIndex::_insert(const entt::entity entity, const TagHash tag) {
+    _entities.emplace(tag, entity);
+    _entityTags[entity] = tag;
+}
+
+void cbit::TagIndex::_erase(const entt::entity entity) {
+    const auto tagIt = _entityTags.find(entity);
+    if (tagIt == _entityTags.end()) {
+        return;
+    }
+
+    auto [begin, end] = _entities.equal_range(tagIt->second);
+    for (auto it = begin; it != end; ++it) {
+        if (it->second == entity) {
+            _entities.erase(it);
+            break;
+        }
+    }
+    _entityTags.erase(tagIt);
+}
@@ -0,0 +1,73 @@
+/**
+ * @file    TagIndex.h
+ * @brief   Header file for the TagIndex class.
+ * @details Maps hashed TagComponent tags to entities so tag lookups do not scan the registry.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_TAGINDEX_H
+#define CBIT_TAGINDEX_H
+
+#include <unordered_map>
+#include "entt/entt.hpp"
+#include "utilities/Hash.h"
+
+namespace cbit {
+    /**
+     * @class TagIndex
+     * @brief Hashed tag to entity index kept in sync through registry signals.
+     * @details The index listens to construction, update and destruction of TagComponent. Tags changed in
+     *          place must go through registry.patch() or registry.replace() to be re-indexed. Several entities
+     *          may share a tag.
+     */
+    class TagIndex {
+    public:
+        /**
+         * Start indexing the TagComponents of a registry.
+         * @param registry Registry to listen to; must outlive the index or be disconnected first.
+         */
+        void connect(entt::registry &registry);
+
+        /**
+         * Stop listening to the registry and clear the index.
+         */
+        void disconnect();
+
+        /**
+         * Find an entity with the given tag.
+         * @param tag Hashed tag.
+         * @return One of the entities with the tag, or entt::null.
+         */
+        [[nodiscard]] entt::entity find(TagHash tag) const;
+
+        /**
+         * Invoke a function for every entity with the given tag.
+         * @param tag Hashed tag.
+         * @param function Callable invoked as function(entt::entity).
+         */
+        template<typename Function>
+        void forEach(const TagHash tag, Function &&function) const {
+            const auto [begin, end] = _entities.equal_range(tag);
+            for (auto it = begin; it != end; ++it) {
+                function(it->second);
+            }
+        }
+
+        void clear();
+
+    private:
+        void _onConstruct(entt::registry &registry, entt::entity entity);
+        void _onUpdate(entt::registry &registry, entt::entity entity);
+        void _onDestroy(entt::registry &registry, entt::entity entity);
+
+        void _insert(entt::entity entity, TagHash tag);
+        void _erase(entt::entity entity);
+
+        entt::registry *_registry = nullptr;
+        std::unordered_multimap<TagHash, entt::entity> _entities;
+        std::unordered_map<entt::entity, TagHash> _entityTags; // Hash an entity was indexed under.
+    };
+}
+
+#endif //CBIT_TAGINDEX_H
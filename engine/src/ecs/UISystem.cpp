@@ -14,17 +14,14 @@
  */
 
 #include "UISystem.h"
+#include "CommandBuffer.h"
 #include "Components.h"
-#include "glm/ext/matrix_clip_space.hpp"
+#include "core/FrameArena.h"
+#include "core/Input.h"
+#include "core/Profiler.h"
 #include "utilities/Logger.h"
 
-cbit::UISystem::UISystem(GLFWwindow *window, entt::registry &registry) : _window(window), _registry(registry),
-                                                                         _textRenderer(1200, 800) {
-    // Constructor implementation can be added here if needed
-    _uiShader.loadShaders("resources/shaders/ui.vert", "resources/shaders/ui.frag");
-    _uiColorShader.loadShaders("resources/shaders/color_ui.vert", "resources/shaders/color_ui.frag");
-    _textRenderer.loadFont("resources/fonts/Amble.ttf", 50);
-
+cbit::UISystem::UISystem(GLFWwindow *window, entt::registry &registry) : _window(window), _registry(registry) {
     _syncSize();
 }
 
@@ -35,27 +32,20 @@ void cbit::UISystem::setWindow(GLFWwindow *window) {
 
 void cbit::UISystem::update(float deltaTime) {
     (void) deltaTime; // Currently unused
+    CBIT_PROFILE_SCOPE("UISystem::update");
     _syncSize();
 
     if (!_window) return;
     _dispatchPointerEvents();
 }
 
-void cbit::UISystem::render() {
+void cbit::UISystem::extract(RenderSnapshot &snapshot) {
+    CBIT_PROFILE_SCOPE("UISystem::extract");
     _syncSize();
 
-    const glm::mat4 projectionMatrix = _orthoMatrix();
-
-    glDisable(GL_DEPTH_TEST);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    _renderImages(projectionMatrix);
-    _renderColorRectangles(projectionMatrix);
-    _renderText();
-
-    glDisable(GL_BLEND);
-    glEnable(GL_DEPTH_TEST);
+    _extractImages(snapshot);
+    _extractColorRectangles(snapshot);
+    _extractText(snapshot);
 }
 
 void cbit::UISystem::_syncSize() {
@@ -66,17 +56,6 @@ void cbit::UISystem::_syncSize() {
     _windowHeight = std::max(_windowHeight, 1);
     _framebufferWidth = std::max(_framebufferWidth, 1);
     _framebufferHeight = std::max(_framebufferHeight, 1);
-
-    glViewport(0, 0, _framebufferWidth, _framebufferHeight);
-    _textRenderer.resize(_framebufferWidth, _framebufferHeight);
-}
-
-glm::mat4 cbit::UISystem::_orthoMatrix() const {
-    return glm::ortho(
-        0.0f, static_cast<float>(_framebufferWidth), // left → right
-        0.0f, static_cast<float>(_framebufferHeight), // bottom → top
-        -1.0f, 1.0f
-    );
 }
 
 cbit::UISystem::UIRectangle cbit::UISystem::_computeRectangle(entt::entity entity) const {
@@ -194,14 +173,15 @@ void cbit::UISystem::_dispatchPointerEvents() {
 
     double mouseX, mouseY;
 
-    glfwGetCursorPos(_window, &mouseX, &mouseY);
+    Input::getMousePosition(mouseX, mouseY);
 
     _mouseX = mouseX * scaleX;
     _mouseY = (_windowHeight - mouseY) * scaleY;
 
-    const bool mouseDown = glfwGetMouseButton(_window, GLFW_MOUSE_BUTTON_LEFT) == GLFW_PRESS;
-    const bool mousePressedThisFrame = mouseDown && !_mouseDownLastFrame;
-    const bool mouseReleasedThisFrame = !mouseDown && _mouseDownLastFrame;
+    // Edges come from the input events, so a click shorter than a tick still presses and releases.
+    const bool mouseDown = Input::isMouseDown(MouseButton::Left);
+    const bool mousePressedThisFrame = Input::isMousePressed(MouseButton::Left);
+    const bool mouseReleasedThisFrame = Input::isMouseReleased(MouseButton::Left);
 
     // Collect interactable UI entities with z-index, sort descending so top-most gets events first
     struct Item {
@@ -209,7 +189,7 @@ void cbit::UISystem::_dispatchPointerEvents() {
         int z;
     };
 
-    std::vector<Item> interactableEntities;
+    std::pmr::vector<Item> interactableEntities(&FrameArena::local());
 
     auto view = _registry.view<UIAnchorComponent>();
     interactableEntities.reserve(view.size());
@@ -237,12 +217,10 @@ void cbit::UISystem::_dispatchPointerEvents() {
         const UIRectangle rectangle = _computeRectangle(entity);
         const bool nowHovered = _hit(rectangle, _mouseX, _mouseY);
 
-        // Ensure pointer state exists
-        if (!_registry.any_of<UIPointerState>(entity)) {
-            _registry.emplace<UIPointerState>(entity);
-        }
-
-        auto &statePointer = _registry.get<UIPointerState>(entity);
+        // Work on a copy: emplacing here would change the registry mid-dispatch, so a missing state is added
+        // through the command buffer and the callbacks below never see a storage being resized under them.
+        const UIPointerState *existingState = _registry.try_get<UIPointerState>(entity);
+        UIPointerState statePointer = existingState ? *existingState : UIPointerState{};
 
         // Get callbacks (ButtonComponent reuses its onClick; UIPointerCallbacks is more general)
         UIPointerCallbacksComponent *callbacks = _registry.try_get<UIPointerCallbacksComponent>(entity);
@@ -306,23 +284,23 @@ void cbit::UISystem::_dispatchPointerEvents() {
             button->isPressed = statePointer.pressed;
             button->isPressedInside = statePointer.pressedInside;
         }
-    }
 
-    // Update mouse button state for the next frame
-    _mouseDownLastFrame = mouseDown;
+        if (auto *currentState = _registry.try_get<UIPointerState>(entity)) {
+            *currentState = statePointer;
+        } else {
+            _registry.ctx().get<CommandBuffers>().local().emplace<UIPointerState>(entity, statePointer);
+        }
+    }
 }
 
-void cbit::UISystem::_renderColorRectangles(const glm::mat4 &projectionMatrix) {
-    _uiColorShader.use();
-    _uiColorShader.setUniform("uProjection", projectionMatrix);
-
+void cbit::UISystem::_extractColorRectangles(RenderSnapshot &snapshot) {
     // Draw sorted by z-index ascending (back to front)
     struct Item {
         entt::entity entity;
         int z;
     };
 
-    std::vector<Item> colorRectangleEntities;
+    std::pmr::vector<Item> colorRectangleEntities(&FrameArena::local());
     auto view = _registry.view<UIAnchorComponent, UIColorRectangleComponent>();
     colorRectangleEntities.reserve(view.size_hint());
 
@@ -363,19 +341,18 @@ void cbit::UISystem::_renderColorRectangles(const glm::mat4 &projectionMatrix) {
             }
         }
 
-        _drawColorQuad(rectangle.x, rectangle.y, rectangle.width, rectangle.height, color);
+        snapshot.uiRectangles.push_back({
+            {rectangle.x, rectangle.y}, {rectangle.width, rectangle.height}, color, kNoSnapshotString
+        });
     }
 }
 
-void cbit::UISystem::_renderImages(const glm::mat4 &projectionMatrix) {
-    _uiShader.use();
-    _uiShader.setUniform("uProjection", projectionMatrix);
-
+void cbit::UISystem::_extractImages(RenderSnapshot &snapshot) {
     struct Item {
         entt::entity entity;
         int z;
     };
-    std::vector<Item> imageEntities;
+    std::pmr::vector<Item> imageEntities(&FrameArena::local());
     auto view = _registry.view<UIAnchorComponent, UIImageComponent>();
     imageEntities.reserve(view.size_hint());
     for (const auto &entity: view) {
@@ -394,19 +371,21 @@ void cbit::UISystem::_renderImages(const glm::mat4 &projectionMatrix) {
         if (!anchorComponent.visible) { continue; }
         const auto &imageComponent = _registry.get<UIImageComponent>(entity);
         const UIRectangle rectangle = _computeRectangle(entity);
-        _drawImageQuad(imageComponent.path, rectangle.x, rectangle.y, rectangle.width, rectangle.height,
-                       imageComponent.tintColor);
+        snapshot.uiImages.push_back({
+            {rectangle.x, rectangle.y}, {rectangle.width, rectangle.height}, imageComponent.tintColor,
+            snapshot.internPath(imageComponent.path)
+        });
     }
 }
 
-void cbit::UISystem::_renderText() {
+void cbit::UISystem::_extractText(RenderSnapshot &snapshot) {
     // TextRenderer likely draw in screen space; assume bottom-left origin
     // If it uses top-left origin, need to convert y coordinate
     struct Item {
         entt::entity entity;
         int z;
     };
-    std::vector<Item> textEntities;
+    std::pmr::vector<Item> textEntities(&FrameArena::local());
     auto view = _registry.view<UIAnchorComponent, UITextComponent>();
     textEntities.reserve(view.size_hint());
     for (const auto &entity: view) {
@@ -437,13 +416,7 @@ void cbit::UISystem::_renderText() {
         const float y = rectangle.y + (rectangle.height * 0.5f) - (14.0f * scale);
 
         const glm::vec3 rgb(textComponent.color.glmVec4.r, textComponent.color.glmVec4.g, textComponent.color.glmVec4.b);
-        _textRenderer.renderText(
-            textComponent.text,
-            x,
-            y,
-            textComponent.fontSize,
-            rgb
-        );
+        snapshot.uiTexts.push_back({snapshot.addText(textComponent.text), {x, y}, textComponent.fontSize, rgb});
     }
 }
 
@@ -460,78 +433,3 @@ bool cbit::UISystem::_hitTest(const TransformComponent &transformComponent,
                                 : transformComponent.scale.toGLM().y);
     return uiX >= x0 && uiX <= x1 && uiY >= y0 && uiY <= y1;
 }
-
-void cbit::UISystem::_drawQuad(std::string &texturePath, const TransformComponent &transform) {
-    auto [it, inserted] = _textures.try_emplace(texturePath); // default‐constructs Texture
-    if (inserted) {
-        if (!it->second.loadTexture(texturePath)) {
-            Logger::log()->error("Failed to load texture: {}", texturePath);
-            _textures.erase(it);
-            return;
-        }
-    }
-    // now it->second is valid
-    it->second.bind();
-
-    _uiShader.use();
-
-    glActiveTexture(GL_TEXTURE0);
-    _uiShader.setUniform("uTexture", 0);
-
-    const glm::vec2 position{
-        transform.position.toGLM().x,
-        transform.position.toGLM().y
-    };
-
-    const glm::vec2 size{
-        transform.scale.toGLM().x,
-        transform.scale.toGLM().y
-    };
-
-    _uiShader.setUniform("uPosition", position);
-
-    _uiShader.setUniform("uSize", size);
-
-    _quad2D.draw();
-}
-
-void cbit::UISystem::_drawColorQuad(float x, float y, float w, float h, const glm::vec4 &color) {
-    _uiColorShader.use();
-    // _uiColorShader.setUniform("uProjection", glm::ortho(0.0f, 1200.0f, 0.0f, 800.0f, -1.0f, 1.0f));
-
-    const glm::vec2 position(x, y);
-    const glm::vec2 size(w, h);
-    _uiColorShader.setUniform("uPosition", position);
-    _uiColorShader.setUniform("uSize", size);
-    _uiColorShader.setUniform("uColor", color);
-
-    // draw the unit quad scaled/translated
-    _quad2D.draw();
-}
-
-void cbit::UISystem::_drawImageQuad(const std::string &texturePath, float x, float y, float w, float h,
-                                    const glm::vec4 &tint) {
-    auto [it, inserted] = _textures.try_emplace(texturePath); // default‐constructs Texture
-    if (inserted) {
-        if (!it->second.loadTexture(texturePath)) {
-            Logger::log()->error("Failed to load texture: {}", texturePath);
-            _textures.erase(it);
-            return;
-        }
-    }
-    // now it->second is valid
-    it->second.bind();
-
-    _uiShader.use();
-    glActiveTexture(GL_TEXTURE0);
-    _uiShader.setUniform("uTexture", 0);
-    const glm::vec2 position(x, y);
-    const glm::vec2 size(w, h);
-    _uiShader.setUniform("uPosition", position);
-    _uiShader.setUniform("uSize", size);
-    // if ui shader supports tint
-    if (_uiShader.hasUniform("uTint")) {
-        _uiShader.setUniform("uTint", tint);
-    }
-    _quad2D.draw();
-}
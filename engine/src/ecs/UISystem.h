@@ -18,10 +18,7 @@
 
 #include "Components.h"
 #include "entt/entt.hpp"
-#include "graphics/renderers/ShaderProgram.h"
-#include "graphics/renderers/TextRenderer.h"
-#include "graphics/renderers/Texture.h"
-#include "graphics/ui/Quad2D.h"
+#include "graphics/renderers/RenderSnapshot.h"
 
 
 namespace cbit {
@@ -67,11 +64,12 @@ namespace cbit {
         void update(float deltaTime);
 
         /**
-         * @brief Renders the user interface elements.
-         * @details This method iterates through all entities with TransformComponent and TextureComponent,
-         *          and draws the corresponding UI elements using the specified shaders.
+         * @brief Adds the visible user interface elements to a render snapshot.
+         * @details Images, colored rectangles and text are laid out in framebuffer space and sorted by z-index;
+         *          SceneRenderer draws them after the scene meshes.
+         * @param snapshot Frame being extracted.
          */
-        void render();
+        void extract(RenderSnapshot &snapshot);
 
     private:
         struct UIRectangle {
@@ -80,18 +78,12 @@ namespace cbit {
 
         GLFWwindow *_window{nullptr};
         entt::registry &_registry;
-        ShaderProgram _uiShader;
-        ShaderProgram _uiColorShader;
-        TextRenderer _textRenderer;
-        Quad2D _quad2D;
-        std::unordered_map<std::string, Texture> _textures;
 
         // sizes a window to keep in sync
         int _windowWidth = 1, _windowHeight = 1;
         int _framebufferWidth = 1, _framebufferHeight = 1;
 
         // Input state
-        bool _mouseDownLastFrame = false; // Track if the mouse was down in the last frame
         double _mouseX = 0.0; // Mouse X position
         double _mouseY = 0.0; // Mouse Y position
 
@@ -99,23 +91,12 @@ namespace cbit {
          * @brief Synchronizes the size of the UISystem with the current window size.
          * @details This method checks the current size of the GLFW window and updates the internal
          *          framebuffer size accordingly. It ensures that the UISystem's rendering area matches
-         *          the window size, which is important for proper rendering of UI elements.
-         *          If the window size has changed, it also updates the TextRenderer's size to match
-         *          the new framebuffer dimensions.
+         *          the window size, which is important for proper layout and hit testing of UI elements.
          * @note This method should be called whenever the window size may have changed, such as
          *       during the update phase of the application.
          */
         void _syncSize();
 
-        /**
-         * @brief Generates an orthographic projection matrix for UI rendering.
-         * @details This method creates an orthographic projection matrix based on the current
-         *          framebuffer dimensions. The matrix is used to transform UI elements from
-         *          screen space to normalized device coordinates for rendering.
-         * @return A glm::mat4 representing the orthographic projection matrix.
-         */
-        glm::mat4 _orthoMatrix() const;
-
         /**
          * @brief Computes the UIRectangle for the given entity based on its TransformComponent and RectangleComponent.
          * @param entity The entity for which to compute the UIRectangle.
@@ -140,20 +121,21 @@ namespace cbit {
          */
         void _dispatchPointerEvents();
 
-        /** @brief Renders colored rectangles for UI elements.
-         * @param projectionMatrix The orthographic projection matrix for UI rendering.
+        /** @brief Adds colored rectangles for UI elements to the snapshot.
+         * @param snapshot Frame being extracted.
          */
-        void _renderColorRectangles(const glm::mat4 &projectionMatrix);
+        void _extractColorRectangles(RenderSnapshot &snapshot);
 
-        /** @brief Renders images for UI elements.
-         * @param projectionMatrix The orthographic projection matrix for UI rendering.
+        /** @brief Adds images for UI elements to the snapshot.
+         * @param snapshot Frame being extracted.
          */
-        void _renderImages(const glm::mat4 &projectionMatrix);
+        void _extractImages(RenderSnapshot &snapshot);
 
-        /** @brief Renders text for UI elements.
+        /** @brief Adds text for UI elements to the snapshot.
          * @details This method iterates through all entities with TextComponent and TransformComponent,
+         * @param snapshot Frame being extracted.
          */
-        void _renderText();
+        void _extractText(RenderSnapshot &snapshot);
 
         /**
          * @brief Checks if a point (uiX, uiY) hits the rectangle defined by the TransformComponent and RectangleComponent.
@@ -166,33 +148,6 @@ namespace cbit {
         static bool _hitTest(const TransformComponent &transformComponent, const RectangleComponent &rectangleComponent,
                              double uiX, double uiY);
 
-        /**
-         * Draws a quad with the specified texture and transform.
-         * @param texturePath The path to the texture to be used for the quad.
-         * @param transform The transform component containing position, rotation, and scale.
-         */
-        void _drawQuad(std::string &texturePath, const TransformComponent &transform);
-
-        /**
-         * Draws a colored quad with the specified transform and color.
-         * @param x The x-coordinate of the bottom-left corner of the quad.
-         * @param y The y-coordinate of the bottom-left corner of the quad.
-         * @param w The width of the quad.
-         * @param h The height of the quad.
-         * @param color The color to be used for the quad.
-         */
-        void _drawColorQuad(float x, float y, float w, float h, const glm::vec4 &color);
-
-        /**
-         * Draws an image quad with the specified texture, position, size, and tint color.
-         * @param texturePath The path to the texture to be used for the image quad.
-         * @param x The x-coordinate of the bottom-left corner of the image quad.
-         * @param y The y-coordinate of the bottom-left corner of the image quad.
-         * @param w The width of the image quad.
-         * @param h The height of the image quad.
-         * @param tint The tint color to be applied to the image quad.
-         */
-        void _drawImageQuad(const std::string &texturePath, float x, float y, float w, float h, const glm::vec4 &tint);
     };
 }
 
@@ -7,35 +7,333 @@
 
 #include "AnimationClip.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <ostream>
+#include <utility>
+
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
+#include "utilities/AssetPaths.h"
+#include "utilities/AtomicFile.h"
 #include "utilities/Logger.h"
 
+namespace {
+    constexpr char kCookedClipMagic[4] = {'C', 'B', 'A', 'N'};
+    constexpr std::uint32_t kCookedClipVersion = 1;
+
+    // Longest clip or channel name accepted from a cooked file; anything longer means the file is corrupt.
+    constexpr std::uint32_t kMaxCookedNameLength = 4096;
+
+    // Largest deviation a dropped key may have from the interpolation of the keys around it. Positions are
+    // relative to the largest coordinate of the channel, so centimetre and metre rigs compress alike.
+    constexpr float kPositionTolerance = 1e-4f;
+    constexpr float kScaleTolerance = 1e-4f;
+    constexpr float kRotationTolerance = 1e-6f; // 1 - |dot|, roughly 0.16 degrees.
+
+    constexpr float kRotationQuantization = 32767.0f;
+
+    // Cooked clips are written in host byte order, like the other cooked formats.
+    template<typename T>
+    void writeValue(std::ostream &file, const T &value) {
+        file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool readValue(std::ifstream &file, T &value) {
+        return static_cast<bool>(file.read(reinterpret_cast<char *>(&value), sizeof(T)));
+    }
+
+    void writeString(std::ostream &file, const std::string &text) {
+        writeValue(file, static_cast<std::uint32_t>(text.size()));
+        file.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    bool readString(std::ifstream &file, std::string &text) {
+        std::uint32_t length = 0;
+        if (!readValue(file, length) || length > kMaxCookedNameLength) {
+            return false;
+        }
+        text.resize(length);
+        return length == 0 || static_cast<bool>(file.read(text.data(), length));
+    }
+
+    /**
+     * @brief  Drops keys that interpolating between their kept neighbours reproduces within tolerance.
+     * @param  keys Keys sorted by time.
+     * @param  reproduces Called with a kept key, a later key and a key between them; true if interpolating the
+     *         first two at the time of the third is close enough to it.
+     * @return The kept keys; always includes the first and last key.
+     */
+    template<typename Keys, typename Reproduces>
+    std::vector<typename Keys::value_type> reduceKeys(const Keys &keys, Reproduces &&reproduces) {
+        std::vector<typename Keys::value_type> kept;
+        if (keys.empty()) {
+            return kept;
+        }
+
+        kept.push_back(keys.front());
+        size_t anchor = 0;
+        for (size_t candidate = 2; candidate < keys.size(); ++candidate) {
+            for (size_t i = anchor + 1; i < candidate; ++i) {
+                if (!reproduces(keys[anchor], keys[candidate], keys[i])) {
+                    kept.push_back(keys[candidate - 1]);
+                    anchor = candidate - 1;
+                    break;
+                }
+            }
+        }
+        if (keys.size() > 1) {
+            kept.push_back(keys.back());
+        }
+        return kept;
+    }
+
+    float interpolationFactor(const float from, const float to, const float time) {
+        return to > from ? (time - from) / (to - from) : 0.0f;
+    }
+
+    std::int16_t quantizeRotation(const float component) {
+        return static_cast<std::int16_t>(std::lround(std::clamp(component, -1.0f, 1.0f) * kRotationQuantization));
+    }
+
+    void writeChannel(std::ostream &file, const cbit::AnimationChannel &channel) {
+        float largestCoordinate = 1.0f;
+        for (const cbit::KeyPosition &key: channel.positions) {
+            largestCoordinate = std::max({largestCoordinate, std::abs(key.position.x), std::abs(key.position.y),
+                                          std::abs(key.position.z)});
+        }
+        const float positionTolerance = kPositionTolerance * largestCoordinate;
+
+        const auto positionReproduced = [positionTolerance](const cbit::KeyPosition &from,
+                                                            const cbit::KeyPosition &to,
+                                                            const cbit::KeyPosition &key) {
+            const float t = interpolationFactor(from.timeStamp, to.timeStamp, key.timeStamp);
+            return glm::length(glm::mix(from.position, to.position, t) - key.position) <= positionTolerance;
+        };
+        const auto rotationReproduced = [](const cbit::KeyRotation &from, const cbit::KeyRotation &to,
+                                           const cbit::KeyRotation &key) {
+            const float t = interpolationFactor(from.timeStamp, to.timeStamp, key.timeStamp);
+            const glm::quat interpolated = glm::normalize(glm::slerp(from.rotation, to.rotation, t));
+            return 1.0f - std::abs(glm::dot(interpolated, glm::normalize(key.rotation))) <= kRotationTolerance;
+        };
+        const auto scaleReproduced = [](const cbit::KeyScale &from, const cbit::KeyScale &to,
+                                        const cbit::KeyScale &key) {
+            const float t = interpolationFactor(from.timeStamp, to.timeStamp, key.timeStamp);
+            return glm::length(glm::mix(from.scale, to.scale, t) - key.scale) <= kScaleTolerance;
+        };
+        const auto positions = reduceKeys(channel.positions, positionReproduced);
+        const auto rotations = reduceKeys(channel.rotations, rotationReproduced);
+        const auto scales = reduceKeys(channel.scales, scaleReproduced);
+
+        writeValue(file, channel.baseScale);
+        writeValue(file, static_cast<std::uint32_t>(positions.size()));
+        for (const cbit::KeyPosition &key: positions) {
+            writeValue(file, key.timeStamp);
+            writeValue(file, key.position);
+        }
+        writeValue(file, static_cast<std::uint32_t>(rotations.size()));
+        for (const cbit::KeyRotation &key: rotations) {
+            const glm::quat rotation = glm::normalize(key.rotation);
+            writeValue(file, key.timeStamp);
+            writeValue(file, quantizeRotation(rotation.w));
+            writeValue(file, quantizeRotation(rotation.x));
+            writeValue(file, quantizeRotation(rotation.y));
+            writeValue(file, quantizeRotation(rotation.z));
+        }
+        writeValue(file, static_cast<std::uint32_t>(scales.size()));
+        for (const cbit::KeyScale &key: scales) {
+            writeValue(file, key.timeStamp);
+            writeValue(file, key.scale);
+        }
+    }
+
+    /**
+     * @brief  Checks that a key count read from a file fits in what is left of it, before allocating for it.
+     */
+    bool keysFit(std::ifstream &file, const std::uint64_t remaining, const std::uint32_t count,
+                 const std::uint64_t keySize) {
+        return static_cast<bool>(file) && count <= remaining / keySize;
+    }
+
+    bool readChannel(std::ifstream &file, const std::uint64_t fileSize, cbit::AnimationChannel &channel) {
+        const auto remaining = [&file, fileSize] {
+            const std::streamoff position = file.tellg();
+            return position < 0 ? 0 : fileSize - static_cast<std::uint64_t>(position);
+        };
+
+        std::uint32_t count = 0;
+        if (!readValue(file, channel.baseScale) || !readValue(file, count) ||
+            !keysFit(file, remaining(), count, sizeof(float) + sizeof(glm::vec3))) {
+            return false;
+        }
+        channel.positions.resize(count);
+        for (cbit::KeyPosition &key: channel.positions) {
+            readValue(file, key.timeStamp);
+            readValue(file, key.position);
+        }
+
+        if (!readValue(file, count) || !keysFit(file, remaining(), count, sizeof(float) + 4 * sizeof(std::int16_t))) {
+            return false;
+        }
+        channel.rotations.resize(count);
+        for (cbit::KeyRotation &key: channel.rotations) {
+            std::int16_t components[4] = {};
+            readValue(file, key.timeStamp);
+            readValue(file, components);
+            key.rotation = glm::normalize(glm::quat(static_cast<float>(components[0]) / kRotationQuantization,
+                                                    static_cast<float>(components[1]) / kRotationQuantization,
+                                                    static_cast<float>(components[2]) / kRotationQuantization,
+                                                    static_cast<float>(components[3]) / kRotationQuantization));
+        }
+
+        if (!readValue(file, count) || !keysFit(file, remaining(), count, sizeof(float) + sizeof(glm::vec3))) {
+            return false;
+        }
+        channel.scales.resize(count);
+        for (cbit::KeyScale &key: channel.scales) {
+            readValue(file, key.timeStamp);
+            readValue(file, key.scale);
+        }
+        return static_cast<bool>(file);
+    }
+}
+
 cbit::AnimationClip::AnimationClip(const std::string &name, const std::string &path) {
     loadFromFile(path, name);
 }
 
 bool cbit::AnimationClip::loadFromFile(const std::string &path, const std::string &nameOverride) {
+    std::vector<AnimationClip> clips = loadAllFromFile(path);
+    if (clips.empty()) {
+        return false;
+    }
+
+    *this = std::move(clips.front());
+    if (!nameOverride.empty()) {
+        _name = nameOverride;
+    }
+    return true;
+}
+
+std::vector<cbit::AnimationClip> cbit::AnimationClip::loadAllFromFile(const std::string &path) {
+    std::vector<AnimationClip> clips;
+
+    const std::string cookedPath = AssetPaths::getCookedPath(path, kCookedClipExtension);
+    if (AssetPaths::isCookedCurrent(path, cookedPath) && loadCooked(cookedPath, clips)) {
+        return clips;
+    }
+
     Assimp::Importer importer;
     const unsigned int flags = aiProcess_Triangulate | aiProcess_JoinIdenticalVertices;
 
     const aiScene *scene = importer.ReadFile(path, flags);
     if (!scene || scene->mNumAnimations == 0) {
         Logger::log()->error("Assimp failed to load animation {}: {}", path, importer.GetErrorString());
+        return clips;
+    }
+
+    loadAllFromScene(*scene, clips);
+    if (saveCooked(cookedPath, clips)) {
+        Logger::log()->info("Cooked {} to {}", path, cookedPath);
+    }
+    return clips;
+}
+
+bool cbit::AnimationClip::cookFile(const std::string &path, const std::string &cookedPath) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
+    if (!scene || scene->mNumAnimations == 0) {
+        return false;
+    }
+
+    std::vector<AnimationClip> clips;
+    loadAllFromScene(*scene, clips);
+    return saveCooked(cookedPath, clips);
+}
+
+bool cbit::AnimationClip::saveCooked(const std::string &path, const std::vector<AnimationClip> &clips) {
+    return writeFileAtomically(path, [&](std::ostream &file) {
+        file.write(kCookedClipMagic, sizeof(kCookedClipMagic));
+        writeValue(file, kCookedClipVersion);
+        writeValue(file, static_cast<std::uint32_t>(clips.size()));
+        for (const AnimationClip &clip: clips) {
+            writeString(file, clip._name);
+            writeValue(file, clip._duration);
+            writeValue(file, clip._ticksPerSecond);
+            writeValue(file, static_cast<std::uint32_t>(clip._channels.size()));
+            for (const auto &[name, channel]: clip._channels) {
+                writeString(file, name);
+                writeChannel(file, channel);
+            }
+        }
+        return static_cast<bool>(file);
+    });
+}
+
+bool cbit::AnimationClip::loadCooked(const std::string &path, std::vector<AnimationClip> &clips) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
         return false;
     }
+    const auto fileSize = static_cast<std::uint64_t>(file.tellg());
+    file.seekg(0);
 
-    const aiAnimation *animation = scene->mAnimations[0];
-    _duration = static_cast<float>(animation->mDuration);
-    _ticksPerSecond = animation->mTicksPerSecond != 0.0 ? static_cast<float>(animation->mTicksPerSecond) : 25.0f;
-    _name = nameOverride.empty() ? animation->mName.C_Str() : nameOverride;
+    char magic[sizeof(kCookedClipMagic)] = {};
+    std::uint32_t version = 0;
+    std::uint32_t clipCount = 0;
+    bool valid = file.read(magic, sizeof(magic)) && std::memcmp(magic, kCookedClipMagic, sizeof(magic)) == 0 &&
+                 readValue(file, version) && version == kCookedClipVersion && readValue(file, clipCount);
+
+    std::vector<AnimationClip> loaded;
+    for (std::uint32_t i = 0; valid && i < clipCount; ++i) {
+        AnimationClip clip;
+        std::uint32_t channelCount = 0;
+        valid = readString(file, clip._name) && readValue(file, clip._duration) &&
+                readValue(file, clip._ticksPerSecond) && readValue(file, channelCount);
+        for (std::uint32_t j = 0; valid && j < channelCount; ++j) {
+            std::string name;
+            AnimationChannel channel;
+            valid = readString(file, name) && readChannel(file, fileSize, channel);
+            clip._channels[name] = std::move(channel);
+        }
+        loaded.push_back(std::move(clip));
+    }
+
+    if (!valid) {
+        Logger::log()->error("{} is not a version {} cooked clip file", path, kCookedClipVersion);
+        return false;
+    }
+    clips.reserve(clips.size() + loaded.size());
+    std::move(loaded.begin(), loaded.end(), std::back_inserter(clips));
+    return true;
+}
+
+void cbit::AnimationClip::loadAllFromScene(const aiScene &scene, std::vector<AnimationClip> &clips) {
+    clips.reserve(clips.size() + scene.mNumAnimations);
+    for (unsigned int i = 0; i < scene.mNumAnimations; ++i) {
+        const aiAnimation &animation = *scene.mAnimations[i];
+        AnimationClip clip;
+        clip.loadFromAnimation(animation, animation.mName.length > 0 ? "" : "clip" + std::to_string(i));
+        clips.push_back(std::move(clip));
+    }
+}
+
+void cbit::AnimationClip::loadFromAnimation(const aiAnimation &animation, const std::string &name) {
+    _duration = static_cast<float>(animation.mDuration);
+    _ticksPerSecond = animation.mTicksPerSecond != 0.0 ? static_cast<float>(animation.mTicksPerSecond) : 25.0f;
+    _name = name.empty() ? animation.mName.C_Str() : name;
 
     _channels.clear();
-    _channels.reserve(animation->mNumChannels);
+    _channels.reserve(animation.mNumChannels);
 
-    for (unsigned int i = 0; i < animation->mNumChannels; ++i) {
-        const aiNodeAnim *channel = animation->mChannels[i];
+    for (unsigned int i = 0; i < animation.mNumChannels; ++i) {
+        const aiNodeAnim *channel = animation.mChannels[i];
         const std::string channelName = channel->mNodeName.C_Str();
         AnimationChannel animChannel;
 
@@ -72,6 +370,4 @@ bool cbit::AnimationClip::loadFromFile(const std::string &path, const std::strin
 
         _channels[channelName] = std::move(animChannel);
     }
-
-    return true;
 }
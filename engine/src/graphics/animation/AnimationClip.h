@@ -1,7 +1,10 @@
 /**
  * @file    AnimationClip.h
  * @brief   Animation clip data for skeletal animations.
- * @details Loads animation channels from Assimp-supported files.
+ * @details Loads animation channels from Assimp-supported files. A file may hold several clips; they can be
+ *          extracted in one import with loadAllFromFile() or alongside the mesh through SkinnedMesh::loadFromFile().
+ *          Every clip of a file is also cooked into one compressed .cbanim file, which later loads use instead of
+ *          importing the source again.
  * @author  Nur Akmal bin Jalil
  * @date    2026-01-01
  */
@@ -14,8 +17,14 @@
 #include <vector>
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
+#include "core/MemoryTracker.h"
+
+struct aiAnimation;
+struct aiScene;
 
 namespace cbit {
+    constexpr const char *kCookedClipExtension = ".cbanim";
+
     struct KeyPosition {
         glm::vec3 position{0.0f};
         float timeStamp = 0.0f;
@@ -32,9 +41,9 @@ namespace cbit {
     };
 
     struct AnimationChannel {
-        std::vector<KeyPosition> positions;
-        std::vector<KeyRotation> rotations;
-        std::vector<KeyScale> scales;
+        TrackedVector<KeyPosition, MemoryCategory::Animation> positions;
+        TrackedVector<KeyRotation, MemoryCategory::Animation> rotations;
+        TrackedVector<KeyScale, MemoryCategory::Animation> scales;
         glm::vec3 baseScale{1.0f};
     };
 
@@ -45,6 +54,54 @@ namespace cbit {
 
         bool loadFromFile(const std::string &path, const std::string &nameOverride = "");
 
+        /**
+         * Load a clip from an animation of an already imported scene.
+         * @param animation Assimp animation.
+         * @param name Clip name; the animation name is used when empty.
+         */
+        void loadFromAnimation(const aiAnimation &animation, const std::string &name = "");
+
+        /**
+         * Load every animation of a file with a single import.
+         * @param path Path to the file.
+         * @return One clip per animation, in file order; empty if the file could not be loaded.
+         */
+        static std::vector<AnimationClip> loadAllFromFile(const std::string &path);
+
+        /**
+         * Append every animation of an imported scene to a list of clips.
+         * @param scene Imported Assimp scene.
+         * @param clips Destination list.
+         * @details Unnamed animations are named "clip<index>".
+         */
+        static void loadAllFromScene(const aiScene &scene, std::vector<AnimationClip> &clips);
+
+        /**
+         * Write clips to a cooked clip file.
+         * @param path Destination path; missing directories are created.
+         * @param clips Clips to write.
+         * @return true if the file was written.
+         * @details Keys that linear interpolation (slerp for rotations) reproduces within a small tolerance are
+         *          dropped, and rotations are stored as 16-bit components.
+         */
+        static bool saveCooked(const std::string &path, const std::vector<AnimationClip> &clips);
+
+        /**
+         * Append the clips of a cooked clip file to a list of clips.
+         * @param path Path to the file.
+         * @param clips Destination list; unchanged if the file is missing or invalid.
+         * @return true if the file was read.
+         */
+        static bool loadCooked(const std::string &path, std::vector<AnimationClip> &clips);
+
+        /**
+         * Import every animation of a file and write them to a cooked clip file.
+         * @param path Source file.
+         * @param cookedPath Destination of the cooked file.
+         * @return true if the file has animations and they were written.
+         */
+        static bool cookFile(const std::string &path, const std::string &cookedPath);
+
         [[nodiscard]] const std::string &getName() const { return _name; }
         [[nodiscard]] float getDuration() const { return _duration; }
         [[nodiscard]] float getTicksPerSecond() const { return _ticksPerSecond; }
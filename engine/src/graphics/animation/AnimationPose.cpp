@@ -0,0 +1,84 @@
+/**
+ * @file    AnimationPose.cpp
+ * @brief   Implementation of local-space pose blending and the per-thread pose pool.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "AnimationPose.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    float scaleRatio(const float value, const float reference) {
+        return std::fabs(reference) > 1e-6f ? value / reference : 1.0f;
+    }
+}
+
+void cbit::AnimationPose::resize(const size_t nodeCount) {
+    translations.resize(nodeCount);
+    rotations.resize(nodeCount);
+    scales.resize(nodeCount);
+}
+
+void cbit::blendPoses(const AnimationPose &from, const AnimationPose &to, const float weight, AnimationPose &out) {
+    const float t = std::clamp(weight, 0.0f, 1.0f);
+    const size_t count = std::min(from.size(), to.size());
+    out.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        out.translations[i] = glm::mix(from.translations[i], to.translations[i], t);
+        out.scales[i] = glm::mix(from.scales[i], to.scales[i], t);
+
+        // Normalized lerp along the shortest arc; cheaper than slerp and indistinguishable for blending.
+        const glm::quat target = glm::dot(from.rotations[i], to.rotations[i]) < 0.0f
+                                     ? -to.rotations[i]
+                                     : to.rotations[i];
+        out.rotations[i] = glm::normalize(from.rotations[i] * (1.0f - t) + target * t);
+    }
+}
+
+void cbit::addPose(AnimationPose &base,
+                   const AnimationPose &additive,
+                   const AnimationPose &reference,
+                   const float weight) {
+    const size_t count = std::min({base.size(), additive.size(), reference.size()});
+    const glm::quat identity(1.0f, 0.0f, 0.0f, 0.0f);
+
+    for (size_t i = 0; i < count; ++i) {
+        base.translations[i] += (additive.translations[i] - reference.translations[i]) * weight;
+
+        const glm::vec3 ratio(scaleRatio(additive.scales[i].x, reference.scales[i].x),
+                              scaleRatio(additive.scales[i].y, reference.scales[i].y),
+                              scaleRatio(additive.scales[i].z, reference.scales[i].z));
+        base.scales[i] *= glm::mix(glm::vec3(1.0f), ratio, weight);
+
+        glm::quat delta = glm::inverse(reference.rotations[i]) * additive.rotations[i];
+        if (delta.w < 0.0f) {
+            delta = -delta;
+        }
+        const glm::quat weighted = glm::normalize(identity * (1.0f - weight) + delta * weight);
+        base.rotations[i] = glm::normalize(base.rotations[i] * weighted);
+    }
+}
+
+cbit::PosePool &cbit::PosePool::local() {
+    thread_local PosePool pool;
+    return pool;
+}
+
+cbit::AnimationPose &cbit::PosePool::acquire(const size_t nodeCount) {
+    if (_used == _poses.size()) {
+        _poses.emplace_back();
+    }
+    AnimationPose &pose = _poses[_used++];
+    pose.resize(nodeCount);
+    return pose;
+}
+
+void cbit::PosePool::release() {
+    if (_used > 0) {
+        --_used;
+    }
+}
@@ -0,0 +1,102 @@
+/**
+ * @file    AnimationPose.h
+ * @brief   Local-space skeleton poses and blending helpers.
+ * @details A pose stores one translation, rotation and scale per skeleton node in separate arrays, which is the
+ *          space in which clips are sampled, cross-faded and layered before being composed into bone matrices.
+ *          Temporary poses come from a per-thread PosePool so steady-state blending does not allocate.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_ANIMATIONPOSE_H
+#define CBIT_ANIMATIONPOSE_H
+
+#include <deque>
+#include <vector>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace cbit {
+    /**
+     * @struct AnimationPose
+     * @brief  Structure-of-arrays local transforms for every node of a skeleton.
+     */
+    struct AnimationPose {
+        std::vector<glm::vec3> translations;
+        std::vector<glm::quat> rotations;
+        std::vector<glm::vec3> scales;
+
+        /**
+         * Resize the pose; capacity is kept, so resizing to a previously seen size does not allocate.
+         * @param nodeCount Number of skeleton nodes.
+         */
+        void resize(size_t nodeCount);
+
+        [[nodiscard]] size_t size() const { return translations.size(); }
+    };
+
+    /**
+     * Blend two poses: out = mix(from, to, weight).
+     * @param from Pose at weight 0.
+     * @param to Pose at weight 1.
+     * @param weight Blend factor in [0, 1].
+     * @param out Destination; may alias from or to.
+     */
+    void blendPoses(const AnimationPose &from, const AnimationPose &to, float weight, AnimationPose &out);
+
+    /**
+     * Apply an additive pose on top of a base pose.
+     * @param base Pose to modify.
+     * @param additive Sampled additive clip.
+     * @param reference Reference pose of the additive clip (usually its first frame).
+     * @param weight Strength of the additive layer.
+     */
+    void addPose(AnimationPose &base, const AnimationPose &additive, const AnimationPose &reference, float weight);
+
+    /**
+     * @class PosePool
+     * @brief Per-thread stack of scratch poses.
+     * @details Poses are acquired and released in LIFO order (use ScopedPose). Released poses keep their memory,
+     *          so once the deepest blend of a frame has been seen no further allocation happens on that thread.
+     */
+    class PosePool {
+    public:
+        /**
+         * Get the pool of the calling thread.
+         * @return Reference to the thread-local pool.
+         */
+        static PosePool &local();
+
+        AnimationPose &acquire(size_t nodeCount);
+        void release();
+
+    private:
+        std::deque<AnimationPose> _poses; // deque keeps acquired poses in place while the pool grows.
+        size_t _used = 0;
+    };
+
+    /**
+     * @class ScopedPose
+     * @brief RAII handle for a pose borrowed from the calling thread's PosePool.
+     */
+    class ScopedPose {
+    public:
+        explicit ScopedPose(const size_t nodeCount)
+            : _pool(PosePool::local()), _pose(&_pool.acquire(nodeCount)) {
+        }
+
+        ~ScopedPose() { _pool.release(); }
+
+        ScopedPose(const ScopedPose &) = delete;
+        ScopedPose &operator=(const ScopedPose &) = delete;
+
+        AnimationPose &operator*() const { return *_pose; }
+        AnimationPose *operator->() const { return _pose; }
+
+    private:
+        PosePool &_pool;
+        AnimationPose *_pose;
+    };
+}
+
+#endif //CBIT_ANIMATIONPOSE_H
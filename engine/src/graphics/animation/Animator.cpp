@@ -9,12 +9,16 @@
 
 #include <algorithm>
 #include <cmath>
-#include <glm/gtc/matrix_transform.hpp>
-#define GLM_ENABLE_EXPERIMENTAL
-#include <glm/gtx/quaternion.hpp>
+#include <utility>
+#include <glm/gtc/quaternion.hpp>
 
 namespace {
     constexpr float kDefaultTicksPerSecond = 25.0f;
+
+    // Channel binding slots; layer i binds into kFirstLayerSlot + i.
+    constexpr size_t kPrimarySlot = 0;
+    constexpr size_t kFadeSlot = 1;
+    constexpr size_t kFirstLayerSlot = 2;
 }
 
 void cbit::Animator::update(const AnimationClip *clip,
@@ -26,77 +30,235 @@ void cbit::Animator::update(const AnimationClip *clip,
         return;
     }
 
-    if (_finalBoneMatrices.size() != mesh.getBoneCount()) {
-        _finalBoneMatrices.assign(mesh.getBoneCount(), glm::mat4(1.0f));
+    advance(*clip, deltaTime, loop, speed);
+    evaluate(*clip, mesh);
+}
+
+void cbit::Animator::advance(const AnimationClip &clip, const float deltaTime, const bool loop, const float speed) {
+    _currentTime = advanceTime(clip, _currentTime, deltaTime, loop, speed, &_finished);
+    _currentLoop = loop;
+
+    if (_fadeClip) {
+        _fadeTime = advanceTime(*_fadeClip, _fadeTime, deltaTime, _fadeLoop, speed);
+        _fadeElapsed += deltaTime;
+        if (_fadeElapsed >= _fadeDuration) {
+            _fadeClip = nullptr;
+        }
     }
+}
 
-    const float ticksPerSecond = clip->getTicksPerSecond() > 0.0f ? clip->getTicksPerSecond() : kDefaultTicksPerSecond;
-    _currentTime += deltaTime * ticksPerSecond * speed;
-    _finished = false;
+float cbit::Animator::advanceTime(const AnimationClip &clip,
+                                  float time,
+                                  const float deltaTime,
+                                  const bool loop,
+                                  const float speed,
+                                  bool *finished) {
+    const float ticksPerSecond = clip.getTicksPerSecond() > 0.0f ? clip.getTicksPerSecond() : kDefaultTicksPerSecond;
+    time += deltaTime * ticksPerSecond * speed;
+    if (finished) {
+        *finished = false;
+    }
 
-    const float duration = clip->getDuration();
+    const float duration = clip.getDuration();
     if (duration > 0.0f) {
         if (loop) {
-            _currentTime = std::fmod(_currentTime, duration);
-        } else if (_currentTime >= duration) {
-            _currentTime = duration;
-            _finished = true;
+            time = std::fmod(time, duration);
+        } else if (time >= duration) {
+            time = duration;
+            if (finished) {
+                *finished = true;
+            }
         }
     }
+    return time;
+}
+
+void cbit::Animator::evaluate(const AnimationClip &clip,
+                              const SkinnedMesh &mesh,
+                              const AnimationLayerState *layers,
+                              const size_t layerCount) {
+    if (mesh.getRootNodeIndex() < 0) {
+        return;
+    }
 
-    _calculateBoneTransform(mesh.getRootNodeIndex(), glm::mat4(1.0f), *clip, mesh);
+    _calculateBoneTransforms(clip, mesh, layers, layerCount, _finalBoneMatrices);
+    _keyframesValid = false;
+}
+
+void cbit::Animator::evaluateKeyframe(const AnimationClip &clip,
+                                      const SkinnedMesh &mesh,
+                                      const AnimationLayerState *layers,
+                                      const size_t layerCount) {
+    if (mesh.getRootNodeIndex() < 0) {
+        return;
+    }
+
+    if (!_keyframesValid) {
+        // Entering reduced rate: start from the current pose without interpolating from stale data.
+        _calculateBoneTransforms(clip, mesh, layers, layerCount, _latestKeyframe);
+        _previousKeyframe = _latestKeyframe;
+        _keyframesValid = true;
+    } else {
+        std::swap(_previousKeyframe, _latestKeyframe);
+        _calculateBoneTransforms(clip, mesh, layers, layerCount, _latestKeyframe);
+    }
+}
+
+void cbit::Animator::interpolateKeyframes(const float alpha) {
+    if (!_keyframesValid) {
+        return;
+    }
+
+    const size_t boneCount = _latestKeyframe.size();
+    if (_finalBoneMatrices.size() != boneCount) {
+        _finalBoneMatrices.resize(boneCount);
+    }
+
+    const float t = std::clamp(alpha, 0.0f, 1.0f);
+    for (size_t i = 0; i < boneCount; ++i) {
+        _finalBoneMatrices[i] = _previousKeyframe[i] * (1.0f - t) + _latestKeyframe[i] * t;
+    }
+}
+
+void cbit::Animator::crossFade(const AnimationClip *fromClip, const float duration) {
+    if (!fromClip || duration <= 0.0f) {
+        reset();
+        _fadeClip = nullptr;
+        return;
+    }
+
+    // The outgoing clip keeps its playback time, the incoming one starts from the beginning.
+    _fadeClip = fromClip;
+    _fadeTime = _currentTime;
+    _fadeLoop = _currentLoop;
+    _fadeElapsed = 0.0f;
+    _fadeDuration = duration;
+    _currentTime = 0.0f;
+    _finished = false;
 }
 
 void cbit::Animator::reset() {
     _currentTime = 0.0f;
     _finished = false;
+    _keyframesValid = false;
 }
 
-void cbit::Animator::_calculateBoneTransform(const int nodeIndex,
-                                             const glm::mat4 &parentTransform,
-                                             const AnimationClip &clip,
-                                             const SkinnedMesh &mesh) {
+void cbit::Animator::_calculateBoneTransforms(const AnimationClip &clip,
+                                              const SkinnedMesh &mesh,
+                                              const AnimationLayerState *layers,
+                                              const size_t layerCount,
+                                              std::vector<glm::mat4> &boneMatrices) {
+    // Global node transforms for the skeleton being evaluated on this thread. The buffer only grows, so once
+    // it fits the largest skeleton no further allocation happens.
+    thread_local std::vector<glm::mat4> globalTransforms;
+
+    if (boneMatrices.size() != mesh.getBoneCount()) {
+        boneMatrices.assign(mesh.getBoneCount(), glm::mat4(1.0f));
+    }
+
     const auto &nodes = mesh.getSkeletonNodes();
-    if (nodeIndex < 0 || nodeIndex >= static_cast<int>(nodes.size())) {
-        return;
+    if (globalTransforms.size() < nodes.size()) {
+        globalTransforms.resize(nodes.size());
     }
 
-    const auto &node = nodes[nodeIndex];
-    glm::mat4 nodeTransform = node.transform;
+    ScopedPose pose(nodes.size());
+    _samplePose(clip, mesh, _currentTime, kPrimarySlot, *pose);
 
-    const auto &channels = clip.getChannels();
-    const auto channelIt = channels.find(node.name);
-    if (channelIt != channels.end()) {
-        nodeTransform = _interpolateChannel(channelIt->second, _currentTime);
+    if (_fadeClip) {
+        ScopedPose fadePose(nodes.size());
+        _samplePose(*_fadeClip, mesh, _fadeTime, kFadeSlot, *fadePose);
+        const float weight = _fadeDuration > 0.0f ? std::clamp(_fadeElapsed / _fadeDuration, 0.0f, 1.0f) : 1.0f;
+        blendPoses(*fadePose, *pose, weight, *pose);
+    }
+
+    for (size_t i = 0; i < layerCount; ++i) {
+        const AnimationLayerState &layer = layers[i];
+        if (!layer.clip || layer.weight <= 0.0f) {
+            continue;
+        }
+
+        ScopedPose layerPose(nodes.size());
+        _samplePose(*layer.clip, mesh, layer.time, kFirstLayerSlot + i, *layerPose);
+        if (layer.additive) {
+            ScopedPose referencePose(nodes.size());
+            _samplePose(*layer.clip, mesh, 0.0f, kFirstLayerSlot + i, *referencePose);
+            addPose(*pose, *layerPose, *referencePose, layer.weight);
+        } else {
+            blendPoses(*pose, *layerPose, std::min(layer.weight, 1.0f), *pose);
+        }
     }
 
-    const glm::mat4 globalTransform = parentTransform * nodeTransform;
+    const auto &boneInfo = mesh.getBoneInfo();
+    const glm::mat4 &globalInverseTransform = mesh.getGlobalInverseTransform();
 
-    const auto &boneMap = mesh.getBoneMap();
-    const auto boneIt = boneMap.find(node.name);
-    if (boneIt != boneMap.end()) {
-        const int boneIndex = boneIt->second;
-        const auto &boneInfo = mesh.getBoneInfo();
-        if (boneIndex >= 0 && boneIndex < static_cast<int>(boneInfo.size())) {
-            _finalBoneMatrices[boneIndex] =
-                mesh.getGlobalInverseTransform() * globalTransform * boneInfo[boneIndex].offset;
+    // Nodes are stored depth-first, so every parent has been evaluated before its children.
+    for (size_t nodeIndex = 0; nodeIndex < nodes.size(); ++nodeIndex) {
+        const auto &node = nodes[nodeIndex];
+
+        glm::mat4 nodeTransform = glm::mat4_cast(pose->rotations[nodeIndex]);
+        nodeTransform[0] *= pose->scales[nodeIndex].x;
+        nodeTransform[1] *= pose->scales[nodeIndex].y;
+        nodeTransform[2] *= pose->scales[nodeIndex].z;
+        nodeTransform[3] = glm::vec4(pose->translations[nodeIndex], 1.0f);
+
+        globalTransforms[nodeIndex] = node.parent >= 0
+                                          ? globalTransforms[node.parent] * nodeTransform
+                                          : nodeTransform;
+
+        if (node.boneIndex >= 0 && node.boneIndex < static_cast<int>(boneInfo.size())) {
+            boneMatrices[node.boneIndex] =
+                globalInverseTransform * globalTransforms[nodeIndex] * boneInfo[node.boneIndex].offset;
         }
     }
+}
 
-    for (const int childIndex: node.children) {
-        _calculateBoneTransform(childIndex, globalTransform, clip, mesh);
+void cbit::Animator::_samplePose(const AnimationClip &clip,
+                                 const SkinnedMesh &mesh,
+                                 const float time,
+                                 const size_t slot,
+                                 AnimationPose &pose) {
+    const auto &nodes = mesh.getSkeletonNodes();
+    const auto &channels = _bindChannels(clip, mesh, slot);
+
+    for (size_t nodeIndex = 0; nodeIndex < nodes.size(); ++nodeIndex) {
+        const AnimationChannel *channel = channels[nodeIndex];
+        if (channel) {
+            pose.translations[nodeIndex] = _interpolatePosition(*channel, time);
+            pose.rotations[nodeIndex] = _interpolateRotation(*channel, time);
+            pose.scales[nodeIndex] = _interpolateScale(*channel, time);
+        } else {
+            const auto &node = nodes[nodeIndex];
+            pose.translations[nodeIndex] = node.bindTranslation;
+            pose.rotations[nodeIndex] = node.bindRotation;
+            pose.scales[nodeIndex] = node.bindScale;
+        }
     }
 }
 
-glm::mat4 cbit::Animator::_interpolateChannel(const AnimationChannel &channel, const float animationTime) const {
-    const glm::vec3 translation = _interpolatePosition(channel, animationTime);
-    const glm::quat rotation = _interpolateRotation(channel, animationTime);
-    const glm::vec3 scale = _interpolateScale(channel, animationTime);
+const std::vector<const cbit::AnimationChannel *> &cbit::Animator::_bindChannels(const AnimationClip &clip,
+                                                                                const SkinnedMesh &mesh,
+                                                                                const size_t slot) {
+    if (slot >= _channelBindings.size()) {
+        _channelBindings.resize(slot + 1);
+    }
+
+    auto &binding = _channelBindings[slot];
+    if (binding.clip == &clip && binding.mesh == &mesh) {
+        return binding.channels;
+    }
 
-    const glm::mat4 translationMatrix = glm::translate(glm::mat4(1.0f), translation);
-    const glm::mat4 rotationMatrix = glm::toMat4(rotation);
-    const glm::mat4 scaleMatrix = glm::scale(glm::mat4(1.0f), scale);
-    return translationMatrix * rotationMatrix * scaleMatrix;
+    const auto &nodes = mesh.getSkeletonNodes();
+    const auto &channels = clip.getChannels();
+    binding.clip = &clip;
+    binding.mesh = &mesh;
+    binding.channels.assign(nodes.size(), nullptr);
+    for (size_t nodeIndex = 0; nodeIndex < nodes.size(); ++nodeIndex) {
+        const auto channelIt = channels.find(nodes[nodeIndex].name);
+        if (channelIt != channels.end()) {
+            binding.channels[nodeIndex] = &channelIt->second;
+        }
+    }
+    return binding.channels;
 }
 
 glm::vec3 cbit::Animator::_interpolatePosition(const AnimationChannel &channel, const float animationTime) const {
@@ -12,25 +12,133 @@
 #include <vector>
 #include <glm/glm.hpp>
 #include "AnimationClip.h"
+#include "AnimationPose.h"
 #include "graphics/meshes/SkinnedMesh.h"
 
 namespace cbit {
+    /**
+     * @struct AnimationLayerState
+     * @brief  A clip layered on top of the primary clip for one evaluation.
+     * @details Override layers blend towards the layer pose by weight, in order, which also gives weighted
+     *          multi-clip blends. Additive layers add the difference between the layer pose and the clip's first
+     *          frame.
+     */
+    struct AnimationLayerState {
+        const AnimationClip *clip = nullptr;
+        float time = 0.0f; // Ticks.
+        float weight = 1.0f;
+        bool additive = false;
+    };
+
+    /**
+     * @class Animator
+     * @brief Advances playback time and evaluates a clip into final bone matrices.
+     * @details An Animator only writes to its own state, so different animators may be updated concurrently.
+     *          Clips are sampled into local-space poses, cross-faded and layered there, then composed into bone
+     *          matrices. Scratch poses and node transforms come from per-thread buffers that are reused between
+     *          updates, so steady-state evaluation does not allocate.
+     */
     class Animator {
     public:
         Animator() = default;
 
+        /**
+         * Advance playback and evaluate the skeleton.
+         * @param clip Clip to play.
+         * @param mesh Skinned mesh providing the skeleton.
+         * @param deltaTime Time since the last update in seconds.
+         * @param loop Wrap around at the end of the clip.
+         * @param speed Playback speed multiplier.
+         */
         void update(const AnimationClip *clip, const SkinnedMesh &mesh, float deltaTime, bool loop, float speed);
+
+        /**
+         * Advance playback time without touching the bone palette.
+         * @param clip Clip being played.
+         * @param deltaTime Time since the last update in seconds.
+         * @param loop Wrap around at the end of the clip.
+         * @param speed Playback speed multiplier.
+         */
+        void advance(const AnimationClip &clip, float deltaTime, bool loop, float speed);
+
+        /**
+         * Evaluate the skeleton at the current time into the final bone matrices.
+         * @param clip Primary clip.
+         * @param mesh Skinned mesh providing the skeleton.
+         * @param layers Optional layers applied on top of the primary clip, in order.
+         * @param layerCount Number of layers.
+         */
+        void evaluate(const AnimationClip &clip,
+                      const SkinnedMesh &mesh,
+                      const AnimationLayerState *layers = nullptr,
+                      size_t layerCount = 0);
+
+        /**
+         * Evaluate a reduced-rate keyframe.
+         * @details The previous keyframe becomes the start of the interpolation range and the new evaluation its
+         *          end, so the palette trails playback by one reduced-rate interval but moves without steps.
+         *          Call interpolateKeyframes() afterwards to refresh the final bone matrices.
+         */
+        void evaluateKeyframe(const AnimationClip &clip,
+                              const SkinnedMesh &mesh,
+                              const AnimationLayerState *layers = nullptr,
+                              size_t layerCount = 0);
+
+        /**
+         * Blend between the last two reduced-rate keyframes.
+         * @param alpha 0 for the previous keyframe, 1 for the latest one.
+         */
+        void interpolateKeyframes(float alpha);
+
+        /**
+         * Forget the reduced-rate keyframes so the next keyframe starts a fresh interpolation range.
+         */
+        void discardKeyframes() { _keyframesValid = false; }
+
+        /**
+         * Start a cross-fade from the clip that was playing to the next one.
+         * @param fromClip Clip being faded out; its current playback time is kept.
+         * @param duration Fade length in seconds; a non-positive duration snaps like reset().
+         * @details Playback of the new clip restarts from zero. Starting a fade while another one is running
+         *          fades out from the clip that was the primary one.
+         */
+        void crossFade(const AnimationClip *fromClip, float duration);
+
+        /**
+         * Advance a playback time for a clip.
+         * @param clip Clip being played.
+         * @param time Current time in ticks.
+         * @param deltaTime Time since the last update in seconds.
+         * @param loop Wrap around at the end of the clip.
+         * @param speed Playback speed multiplier.
+         * @param finished Optional; set to true when a non-looping clip reached its end.
+         * @return New time in ticks.
+         */
+        static float advanceTime(const AnimationClip &clip, float time, float deltaTime, bool loop, float speed,
+                                 bool *finished = nullptr);
+
         void reset();
         [[nodiscard]] bool isFinished() const { return _finished; }
+        [[nodiscard]] bool isCrossFading() const { return _fadeClip != nullptr; }
         [[nodiscard]] const std::vector<glm::mat4> &getFinalBoneMatrices() const { return _finalBoneMatrices; }
 
     private:
-        void _calculateBoneTransform(int nodeIndex,
-                                     const glm::mat4 &parentTransform,
-                                     const AnimationClip &clip,
-                                     const SkinnedMesh &mesh);
+        struct ChannelBinding {
+            const AnimationClip *clip = nullptr;
+            const SkinnedMesh *mesh = nullptr;
+            std::vector<const AnimationChannel *> channels; // Indexed by skeleton node.
+        };
+
+        void _calculateBoneTransforms(const AnimationClip &clip,
+                                      const SkinnedMesh &mesh,
+                                      const AnimationLayerState *layers,
+                                      size_t layerCount,
+                                      std::vector<glm::mat4> &boneMatrices);
 
-        glm::mat4 _interpolateChannel(const AnimationChannel &channel, float animationTime) const;
+        void _samplePose(const AnimationClip &clip, const SkinnedMesh &mesh, float time, size_t slot,
+                         AnimationPose &pose);
+        const std::vector<const AnimationChannel *> &_bindChannels(const AnimationClip &clip, const SkinnedMesh &mesh,
+                                                                   size_t slot);
         glm::vec3 _interpolatePosition(const AnimationChannel &channel, float animationTime) const;
         glm::vec3 _interpolateScale(const AnimationChannel &channel, float animationTime) const;
         glm::quat _interpolateRotation(const AnimationChannel &channel, float animationTime) const;
@@ -40,8 +148,25 @@ namespace cbit {
         int _getScaleIndex(const AnimationChannel &channel, float animationTime) const;
 
         float _currentTime = 0.0f;
+        bool _currentLoop = true;
         bool _finished = false;
         std::vector<glm::mat4> _finalBoneMatrices;
+
+        // Cross-fade source; null when no fade is running.
+        const AnimationClip *_fadeClip = nullptr;
+        float _fadeTime = 0.0f;
+        bool _fadeLoop = true;
+        float _fadeElapsed = 0.0f;
+        float _fadeDuration = 0.0f;
+
+        // Node-to-channel lookups, one per sampling slot: the primary clip, the cross-fade source, then each layer.
+        // A slot only rebinds when its clip changes, so sampling does not hash node names per frame.
+        std::vector<ChannelBinding> _channelBindings;
+
+        // Reduced-rate keyframes; only populated while the owning entity is animated below full rate.
+        std::vector<glm::mat4> _previousKeyframe;
+        std::vector<glm::mat4> _latestKeyframe;
+        bool _keyframesValid = false;
     };
 }
 
@@ -0,0 +1,128 @@
+/**
+ * @file    BakedAnimation.cpp
+ * @brief   Implementation of the BakedAnimation bone-matrix texture.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "BakedAnimation.h"
+
+#include <algorithm>
+#include <cmath>
+#include "Animator.h"
+#include "core/MemoryTracker.h"
+#include "graphics/meshes/SkinnedMesh.h"
+#include "graphics/renderers/GLCalls.h"
+#include "graphics/renderers/GLThread.h"
+#include "utilities/Logger.h"
+
+namespace {
+    constexpr int kTexelsPerBone = 3;
+    constexpr float kDefaultTicksPerSecond = 25.0f;
+}
+
+cbit::BakedAnimation::~BakedAnimation() {
+    MemoryTracker::trackGpu(MemoryCategory::Animation, -_gpuBytes);
+    GLThread::release(GLObjectType::Texture, _texture);
+}
+
+bool cbit::BakedAnimation::bake(const SkinnedMesh &mesh,
+                                const std::vector<const AnimationClip *> &clips,
+                                const float sampleRate) {
+    if (mesh.getBoneCount() == 0 || clips.empty() || sampleRate <= 0.0f) {
+        Logger::log()->error("Cannot bake animation: mesh has no bones, no clips were given or the rate is invalid.");
+        return false;
+    }
+    if (clips.size() > static_cast<size_t>(kMaxBakedClips)) {
+        Logger::log()->error("Cannot bake {} clips; the instanced path supports at most {}.", clips.size(),
+                             kMaxBakedClips);
+        return false;
+    }
+
+    _boneCount = static_cast<int>(mesh.getBoneCount());
+    _sampleRate = sampleRate;
+    _clips.clear();
+
+    int totalFrames = 0;
+    for (const auto *clip: clips) {
+        const float ticksPerSecond = clip->getTicksPerSecond() > 0.0f ? clip->getTicksPerSecond() : kDefaultTicksPerSecond;
+        BakedClipInfo info;
+        info.name = clip->getName();
+        info.duration = clip->getDuration() / ticksPerSecond;
+        info.firstFrame = totalFrames;
+        info.frameCount = std::max(1, static_cast<int>(std::ceil(info.duration * sampleRate)) + 1);
+        totalFrames += info.frameCount;
+        _clips.push_back(info);
+    }
+
+    const int width = _boneCount * kTexelsPerBone;
+    GLint maxTextureSize = 0;
+    GLThread::run([&maxTextureSize] { glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize); });
+    if (width > maxTextureSize || totalFrames > maxTextureSize) {
+        Logger::log()->error("Baked animation of {}x{} texels exceeds GL_MAX_TEXTURE_SIZE ({}).",
+                             width, totalFrames, maxTextureSize);
+        return false;
+    }
+
+    std::vector<float> texels(static_cast<size_t>(width) * totalFrames * 4);
+    Animator animator;
+
+    for (size_t clipIndex = 0; clipIndex < clips.size(); ++clipIndex) {
+        const auto &clip = *clips[clipIndex];
+        const auto &info = _clips[clipIndex];
+
+        for (int frame = 0; frame < info.frameCount; ++frame) {
+            animator.reset();
+            animator.advance(clip, std::min(frame / sampleRate, info.duration), false, 1.0f);
+            animator.evaluate(clip, mesh);
+
+            const auto &palette = animator.getFinalBoneMatrices();
+            float *row = texels.data() + static_cast<size_t>(info.firstFrame + frame) * width * 4;
+            for (int bone = 0; bone < _boneCount; ++bone) {
+                const glm::mat4 &matrix = bone < static_cast<int>(palette.size()) ? palette[bone] : glm::mat4(1.0f);
+                for (int r = 0; r < kTexelsPerBone; ++r) {
+                    float *texel = row + (bone * kTexelsPerBone + r) * 4;
+                    texel[0] = matrix[0][r];
+                    texel[1] = matrix[1][r];
+                    texel[2] = matrix[2][r];
+                    texel[3] = matrix[3][r];
+                }
+            }
+        }
+    }
+
+    MemoryTracker::trackGpu(MemoryCategory::Animation, -_gpuBytes);
+    _gpuBytes = static_cast<std::int64_t>(texels.size() * sizeof(float));
+    MemoryTracker::trackGpu(MemoryCategory::Animation, _gpuBytes);
+
+    GLThread::run([&] {
+        if (_texture == 0) {
+            glGenTextures(1, &_texture);
+        }
+        glBindTexture(GL_TEXTURE_2D, _texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, width, totalFrames, 0, GL_RGBA, GL_FLOAT, texels.data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+    });
+
+    Logger::log()->info("Baked {} clips into a {}x{} bone texture at {} fps.", _clips.size(), width, totalFrames,
+                        sampleRate);
+    return true;
+}
+
+int cbit::BakedAnimation::findClip(const std::string &name) const {
+    for (size_t i = 0; i < _clips.size(); ++i) {
+        if (_clips[i].name == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void cbit::BakedAnimation::bind(const GLuint unit) const {
+    glActiveTexture(GL_TEXTURE0 + unit);
+    gl::bindTexture(GL_TEXTURE_2D, _texture);
+}
@@ -0,0 +1,89 @@
+/**
+ * @file    BakedAnimation.h
+ * @brief   Bone-matrix texture baked from skeletal animation clips.
+ * @details Samples (skeleton, clip) pairs at a fixed rate into a float texture so that crowds of identical
+ *          units can be skinned on the GPU from a single instanced draw, without a per-unit Animator.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_BAKEDANIMATION_H
+#define CBIT_BAKEDANIMATION_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "OpenGLInclude.h"
+
+namespace cbit {
+    class AnimationClip;
+    class SkinnedMesh;
+
+    /**
+     * Maximum number of clips a baked animation can hold; matches MAX_CLIPS in skinned_instanced.vert.
+     */
+    constexpr int kMaxBakedClips = 16;
+
+    /**
+     * @struct BakedClipInfo
+     * @brief  Location of one clip inside the bone-matrix texture.
+     */
+    struct BakedClipInfo {
+        std::string name;
+        int firstFrame = 0;
+        int frameCount = 0;
+        float duration = 0.0f; // Seconds.
+        bool loop = true;
+    };
+
+    /**
+     * @class BakedAnimation
+     * @brief GPU texture of pre-sampled bone palettes.
+     * @details Each texture row is one sampled frame; each bone takes three RGBA32F texels holding the first
+     *          three rows of its (affine) skinning matrix. Clips are stacked vertically.
+     */
+    class BakedAnimation {
+    public:
+        BakedAnimation() = default;
+        ~BakedAnimation();
+
+        BakedAnimation(const BakedAnimation &) = delete;
+        BakedAnimation &operator=(const BakedAnimation &) = delete;
+
+        /**
+         * Sample clips for a skeleton and upload the result.
+         * @param mesh Skinned mesh providing the skeleton and bone offsets.
+         * @param clips Clips to bake; their order defines the clip IDs used by instances.
+         * @param sampleRate Frames sampled per second of animation.
+         * @return true if the texture was created.
+         */
+        bool bake(const SkinnedMesh &mesh, const std::vector<const AnimationClip *> &clips, float sampleRate = 30.0f);
+
+        /**
+         * Find the clip ID for a clip name.
+         * @param name Clip name as reported by AnimationClip::getName().
+         * @return Clip ID, or -1 if the clip was not baked.
+         */
+        [[nodiscard]] int findClip(const std::string &name) const;
+
+        /**
+         * Bind the bone texture to a texture unit.
+         * @param unit Texture unit index (0-based).
+         */
+        void bind(GLuint unit) const;
+
+        [[nodiscard]] bool isBaked() const { return _texture != 0; }
+        [[nodiscard]] int getBoneCount() const { return _boneCount; }
+        [[nodiscard]] float getSampleRate() const { return _sampleRate; }
+        [[nodiscard]] const std::vector<BakedClipInfo> &getClips() const { return _clips; }
+
+    private:
+        GLuint _texture = 0;
+        std::int64_t _gpuBytes = 0;
+        int _boneCount = 0;
+        float _sampleRate = 30.0f;
+        std::vector<BakedClipInfo> _clips;
+    };
+}
+
+#endif //CBIT_BAKEDANIMATION_H
@@ -8,7 +8,8 @@
  */
 #include "Circle.h"
 
-cbit::Circle::Circle(float radius, int segments) {
+cbit::Circle::Circle(float radius, int segments, const GeometryRetention retention)
+    : Mesh(retention) {
     // Reserve enough space: 1 center vertex + (segments + 1) ring vertices
     // (the extra +1 vertex repeats the first ring vertex so the fan closes)
     vertices.reserve(segments + 2);
@@ -45,12 +46,14 @@ cbit::Circle::Circle(float radius, int segments) {
 
 cbit::Circle::~Circle() = default;
 
-// Override draw():
-void cbit::Circle::draw() {
-    if (!loaded) return;
-
-    glBindVertexArray(VAO);
-    // For a filled circle, use GL_TRIANGLE_FAN
-    glDrawArrays(GL_TRIANGLE_FAN, 0, static_cast<GLsizei>(vertices.size()));
-    glBindVertexArray(0);
+cbit::MeshDrawCall cbit::Circle::getDrawCall() const {
+    MeshDrawCall drawCall;
+    if (loaded) {
+        drawCall.vertexArray = VAO;
+        // For a filled circle, use GL_TRIANGLE_FAN
+        drawCall.mode = GL_TRIANGLE_FAN;
+        drawCall.count = static_cast<GLsizei>(vertexCount);
+        drawCall.indexed = false;
+    }
+    return drawCall;
 }
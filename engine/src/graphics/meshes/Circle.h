@@ -25,12 +25,13 @@ namespace cbit {
      */
     class Circle final : public Mesh {
     public:
-        explicit Circle(float radius = 1.0f, int segments = 32);
+        explicit Circle(float radius = 1.0f, int segments = 32,
+                        GeometryRetention retention = GeometryRetention::Discard);
 
         ~Circle() override;
 
-        // Override the draw function
-        void draw() override;
+        // Filled circles draw as a non-indexed triangle fan
+        [[nodiscard]] MeshDrawCall getDrawCall() const override;
     };
 }
 
@@ -0,0 +1,344 @@
+/**
+ * @file    CookedMesh.cpp
+ * @brief   Implementation of the CookedMesh class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "CookedMesh.h"
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <tuple>
+#include <utility>
+#include <glm/gtc/type_ptr.hpp>
+#include "utilities/AtomicFile.h"
+#include "utilities/Logger.h"
+
+namespace {
+    constexpr std::uint64_t kSectionAlignment = 16;
+
+    struct CookedLod {
+        std::uint32_t indexOffset;
+        std::uint32_t indexCount;
+        float error;
+    };
+
+    struct CookedSubmesh {
+        std::uint32_t nameOffset;
+        std::uint32_t nameLength;
+        std::uint32_t indexOffset;
+        std::uint32_t indexCount;
+        std::uint32_t materialIndex;
+    };
+
+    struct CookedNode {
+        std::uint32_t nameOffset;
+        std::uint32_t nameLength;
+        std::int32_t parent;
+        std::int32_t boneIndex;
+        float transform[16];
+        float bindTranslation[3];
+        float bindRotation[4]; // w, x, y, z
+        float bindScale[3];
+    };
+
+    struct CookedBone {
+        std::uint32_t nameOffset;
+        std::uint32_t nameLength;
+        float offset[16];
+    };
+
+    std::uint64_t alignSection(const std::uint64_t size) {
+        return (size + kSectionAlignment - 1) & ~(kSectionAlignment - 1);
+    }
+
+    void writeBytes(std::ostream &file, const void *data, const std::uint64_t size) {
+        if (size > 0) {
+            file.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+        }
+    }
+
+    void padSection(std::ostream &file, const std::uint64_t size) {
+        constexpr char kPadding[kSectionAlignment] = {};
+        file.write(kPadding, static_cast<std::streamsize>(alignSection(size) - size));
+    }
+
+    template<typename T>
+    void writeSection(std::ostream &file, const std::vector<T> &records) {
+        writeBytes(file, records.data(), records.size() * sizeof(T));
+        padSection(file, records.size() * sizeof(T));
+    }
+
+    // Records are copied out instead of cast in place; the mapping gives no alignment guarantee for their members.
+    template<typename T>
+    T readRecord(const std::byte *data, const std::uint64_t offset, const std::size_t index) {
+        T record;
+        std::memcpy(&record, data + offset + index * sizeof(T), sizeof(T));
+        return record;
+    }
+}
+
+bool cbit::CookedMesh::write(const std::string &path, const CookedMeshSource &source) {
+    std::string strings;
+    const auto addString = [&strings](const std::string &text) {
+        const auto offset = static_cast<std::uint32_t>(strings.size());
+        strings += text;
+        return std::make_pair(offset, static_cast<std::uint32_t>(text.size()));
+    };
+
+    std::vector<CookedLod> lods;
+    lods.reserve(source.lods.size());
+    for (const MeshLod &lod: source.lods) {
+        lods.push_back({lod.indexOffset, lod.indexCount, lod.error});
+    }
+
+    std::vector<CookedSubmesh> submeshes;
+    submeshes.reserve(source.submeshes.size());
+    for (const SkinnedSubmesh &submesh: source.submeshes) {
+        const auto [nameOffset, nameLength] = addString(submesh.name);
+        submeshes.push_back({nameOffset, nameLength, submesh.indexOffset, submesh.indexCount, submesh.materialIndex});
+    }
+
+    std::vector<CookedNode> nodes(source.nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const SkeletonNode &node = source.nodes[i];
+        CookedNode &cooked = nodes[i];
+        std::tie(cooked.nameOffset, cooked.nameLength) = addString(node.name);
+        cooked.parent = node.parent;
+        cooked.boneIndex = node.boneIndex;
+        std::memcpy(cooked.transform, glm::value_ptr(node.transform), sizeof(cooked.transform));
+        std::memcpy(cooked.bindTranslation, glm::value_ptr(node.bindTranslation), sizeof(cooked.bindTranslation));
+        cooked.bindRotation[0] = node.bindRotation.w;
+        cooked.bindRotation[1] = node.bindRotation.x;
+        cooked.bindRotation[2] = node.bindRotation.y;
+        cooked.bindRotation[3] = node.bindRotation.z;
+        std::memcpy(cooked.bindScale, glm::value_ptr(node.bindScale), sizeof(cooked.bindScale));
+    }
+
+    // Bones are stored by index; the name map is rebuilt from their names on load.
+    std::vector<CookedBone> bones(source.bones.size(), CookedBone{});
+    for (size_t i = 0; i < bones.size(); ++i) {
+        std::memcpy(bones[i].offset, glm::value_ptr(source.bones[i].offset), sizeof(bones[i].offset));
+    }
+    for (const auto &[name, index]: source.boneMap) {
+        if (index >= 0 && static_cast<size_t>(index) < bones.size()) {
+            std::tie(bones[index].nameOffset, bones[index].nameLength) = addString(name);
+        }
+    }
+
+    const std::uint64_t vertexBytes = static_cast<std::uint64_t>(source.vertexCount) * source.vertexStride;
+    const std::uint64_t indexBytes = source.indexCount * sizeof(unsigned int);
+    const std::uint64_t lodIndexBytes = source.lodIndexCount * sizeof(unsigned int);
+
+    CookedMeshHeader header{};
+    std::memcpy(header.magic, kCookedMeshMagic, sizeof(header.magic));
+    header.version = kCookedMeshVersion;
+    header.vertexStride = source.vertexStride;
+    header.vertexCount = static_cast<std::uint32_t>(source.vertexCount);
+    header.indexCount = static_cast<std::uint32_t>(source.indexCount);
+    header.lodIndexCount = static_cast<std::uint32_t>(source.lodIndexCount);
+    header.lodCount = static_cast<std::uint32_t>(lods.size());
+    header.submeshCount = static_cast<std::uint32_t>(submeshes.size());
+    header.nodeCount = static_cast<std::uint32_t>(nodes.size());
+    header.boneCount = static_cast<std::uint32_t>(bones.size());
+    header.rootNodeIndex = source.rootNodeIndex;
+    std::memcpy(header.boundsMin, glm::value_ptr(source.boundsMin), sizeof(header.boundsMin));
+    std::memcpy(header.boundsMax, glm::value_ptr(source.boundsMax), sizeof(header.boundsMax));
+    std::memcpy(header.globalInverseTransform, glm::value_ptr(source.globalInverseTransform),
+                sizeof(header.globalInverseTransform));
+
+    std::uint64_t offset = alignSection(sizeof(CookedMeshHeader));
+    const auto placeSection = [&offset](const std::uint64_t size) {
+        const std::uint64_t start = offset;
+        offset += alignSection(size);
+        return start;
+    };
+    header.vertexOffset = placeSection(vertexBytes);
+    header.indexOffset = placeSection(indexBytes + lodIndexBytes);
+    header.lodOffset = placeSection(lods.size() * sizeof(CookedLod));
+    header.submeshOffset = placeSection(submeshes.size() * sizeof(CookedSubmesh));
+    header.nodeOffset = placeSection(nodes.size() * sizeof(CookedNode));
+    header.boneOffset = placeSection(bones.size() * sizeof(CookedBone));
+    header.stringOffset = placeSection(strings.size());
+    header.stringSize = strings.size();
+
+    return writeFileAtomically(path, [&](std::ostream &file) {
+        writeBytes(file, &header, sizeof(header));
+        padSection(file, sizeof(header));
+        writeBytes(file, source.vertices, vertexBytes);
+        padSection(file, vertexBytes);
+        writeBytes(file, source.indices, indexBytes);
+        writeBytes(file, source.lodIndices, lodIndexBytes);
+        padSection(file, indexBytes + lodIndexBytes);
+        writeSection(file, lods);
+        writeSection(file, submeshes);
+        writeSection(file, nodes);
+        writeSection(file, bones);
+        writeBytes(file, strings.data(), strings.size());
+        padSection(file, strings.size());
+        return static_cast<bool>(file);
+    });
+}
+
+bool cbit::CookedMesh::open(const std::string &path, const std::uint32_t vertexStride) {
+    _header = {};
+    if (!_file.open(path)) {
+        return false;
+    }
+
+    if (_file.size() >= sizeof(CookedMeshHeader)) {
+        std::memcpy(&_header, _file.data(), sizeof(CookedMeshHeader));
+    }
+    if (!_validate(vertexStride)) {
+        Logger::log()->error("{} is not a version {} cooked mesh with {}-byte vertices", path, kCookedMeshVersion,
+                             vertexStride);
+        _file.close();
+        _header = {};
+        return false;
+    }
+    return true;
+}
+
+const void *cbit::CookedMesh::getVertices() const {
+    return _file.data() + _header.vertexOffset;
+}
+
+const unsigned int *cbit::CookedMesh::getIndices() const {
+    return reinterpret_cast<const unsigned int *>(_file.data() + _header.indexOffset);
+}
+
+std::vector<cbit::MeshLod> cbit::CookedMesh::readLods() const {
+    std::vector<MeshLod> lods;
+    lods.reserve(_header.lodCount);
+    for (std::uint32_t i = 0; i < _header.lodCount; ++i) {
+        const auto lod = readRecord<CookedLod>(_file.data(), _header.lodOffset, i);
+        lods.push_back({lod.indexOffset, lod.indexCount, lod.error});
+    }
+    return lods;
+}
+
+std::vector<cbit::SkinnedSubmesh> cbit::CookedMesh::readSubmeshes() const {
+    std::vector<SkinnedSubmesh> submeshes;
+    submeshes.reserve(_header.submeshCount);
+    for (std::uint32_t i = 0; i < _header.submeshCount; ++i) {
+        const auto cooked = readRecord<CookedSubmesh>(_file.data(), _header.submeshOffset, i);
+        SkinnedSubmesh submesh;
+        submesh.name = _readString(cooked.nameOffset, cooked.nameLength);
+        submesh.indexOffset = cooked.indexOffset;
+        submesh.indexCount = cooked.indexCount;
+        submesh.materialIndex = cooked.materialIndex;
+        submeshes.push_back(std::move(submesh));
+    }
+    return submeshes;
+}
+
+std::vector<cbit::SkeletonNode> cbit::CookedMesh::readNodes() const {
+    std::vector<SkeletonNode> nodes(_header.nodeCount);
+    for (std::uint32_t i = 0; i < _header.nodeCount; ++i) {
+        const auto cooked = readRecord<CookedNode>(_file.data(), _header.nodeOffset, i);
+        SkeletonNode &node = nodes[i];
+        node.name = _readString(cooked.nameOffset, cooked.nameLength);
+        node.transform = glm::make_mat4(cooked.transform);
+        node.bindTranslation = glm::make_vec3(cooked.bindTranslation);
+        node.bindRotation = glm::quat(cooked.bindRotation[0], cooked.bindRotation[1], cooked.bindRotation[2],
+                                      cooked.bindRotation[3]);
+        node.bindScale = glm::make_vec3(cooked.bindScale);
+        node.parent = cooked.parent;
+        node.boneIndex = cooked.boneIndex;
+
+        // Nodes are depth-first, so appending in node order restores the original child order.
+        if (node.parent >= 0) {
+            nodes[node.parent].children.push_back(static_cast<int>(i));
+        }
+    }
+    return nodes;
+}
+
+void cbit::CookedMesh::readBones(std::vector<BoneInfo> &bones, std::unordered_map<std::string, int> &boneMap) const {
+    bones.clear();
+    boneMap.clear();
+    bones.reserve(_header.boneCount);
+    boneMap.reserve(_header.boneCount);
+    for (std::uint32_t i = 0; i < _header.boneCount; ++i) {
+        const auto cooked = readRecord<CookedBone>(_file.data(), _header.boneOffset, i);
+        BoneInfo bone;
+        bone.offset = glm::make_mat4(cooked.offset);
+        bones.push_back(bone);
+        boneMap.emplace(_readString(cooked.nameOffset, cooked.nameLength), static_cast<int>(i));
+    }
+}
+
+bool cbit::CookedMesh::_validate(const std::uint32_t vertexStride) const {
+    // A different vertex size means the file was cooked for another vertex layout, e.g. skinned for static.
+    if (std::memcmp(_header.magic, kCookedMeshMagic, sizeof(kCookedMeshMagic)) != 0 ||
+        _header.version != kCookedMeshVersion || _header.vertexStride != vertexStride) {
+        return false;
+    }
+
+    const std::uint64_t fileSize = _file.size();
+    const auto sectionFits = [fileSize](const std::uint64_t offset, const std::uint64_t count,
+                                        const std::uint64_t recordSize) {
+        return offset % kSectionAlignment == 0 && offset <= fileSize && count <= (fileSize - offset) / recordSize;
+    };
+    const std::uint64_t totalIndexCount = static_cast<std::uint64_t>(_header.indexCount) + _header.lodIndexCount;
+    if (_header.vertexCount == 0 || _header.indexCount == 0 ||
+        !sectionFits(_header.vertexOffset, _header.vertexCount, _header.vertexStride) ||
+        !sectionFits(_header.indexOffset, totalIndexCount, sizeof(unsigned int)) ||
+        !sectionFits(_header.lodOffset, _header.lodCount, sizeof(CookedLod)) ||
+        !sectionFits(_header.submeshOffset, _header.submeshCount, sizeof(CookedSubmesh)) ||
+        !sectionFits(_header.nodeOffset, _header.nodeCount, sizeof(CookedNode)) ||
+        !sectionFits(_header.boneOffset, _header.boneCount, sizeof(CookedBone)) ||
+        !sectionFits(_header.stringOffset, _header.stringSize, 1) ||
+        _header.rootNodeIndex >= static_cast<std::int64_t>(_header.nodeCount)) {
+        return false;
+    }
+
+    const auto stringFits = [this](const std::uint32_t offset, const std::uint32_t length) {
+        return offset <= _header.stringSize && length <= _header.stringSize - offset;
+    };
+    for (std::uint32_t i = 0; i < _header.lodCount; ++i) {
+        const auto lod = readRecord<CookedLod>(_file.data(), _header.lodOffset, i);
+        if (lod.indexOffset > totalIndexCount || lod.indexCount > totalIndexCount - lod.indexOffset) {
+            return false;
+        }
+    }
+    // An index past the vertex count would make the GPU read outside the vertex buffer.
+    std::uint32_t maxIndex = 0;
+    const std::byte *indices = _file.data() + _header.indexOffset;
+    for (std::uint64_t i = 0; i < totalIndexCount; ++i) {
+        std::uint32_t index;
+        std::memcpy(&index, indices + i * sizeof(index), sizeof(index));
+        maxIndex = std::max(maxIndex, index);
+    }
+    if (maxIndex >= _header.vertexCount) {
+        return false;
+    }
+    for (std::uint32_t i = 0; i < _header.submeshCount; ++i) {
+        const auto submesh = readRecord<CookedSubmesh>(_file.data(), _header.submeshOffset, i);
+        if (!stringFits(submesh.nameOffset, submesh.nameLength) || submesh.indexOffset > _header.indexCount ||
+            submesh.indexCount > _header.indexCount - submesh.indexOffset) {
+            return false;
+        }
+    }
+    for (std::uint32_t i = 0; i < _header.nodeCount; ++i) {
+        const auto node = readRecord<CookedNode>(_file.data(), _header.nodeOffset, i);
+        if (!stringFits(node.nameOffset, node.nameLength) || node.parent < -1 ||
+            node.parent >= static_cast<std::int64_t>(i) || node.boneIndex < -1 ||
+            node.boneIndex >= static_cast<std::int64_t>(_header.boneCount)) {
+            return false;
+        }
+    }
+    for (std::uint32_t i = 0; i < _header.boneCount; ++i) {
+        const auto bone = readRecord<CookedBone>(_file.data(), _header.boneOffset, i);
+        if (!stringFits(bone.nameOffset, bone.nameLength)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string cbit::CookedMesh::_readString(const std::uint32_t offset, const std::uint32_t length) const {
+    return {reinterpret_cast<const char *>(_file.data() + _header.stringOffset + offset), length};
+}
@@ -0,0 +1,175 @@
+/**
+ * @file    CookedMesh.h
+ * @brief   Header file for the CookedMesh class.
+ * @details Engine-native binary mesh format. Vertex and index data are stored in the layout the GPU buffers use, so
+ *          loading a cooked mesh maps the file and passes the blobs straight to glBufferData. Assimp and the OBJ parser
+ *          only run when a source asset is imported and cooked.
+ *
+ *          Layout, in host byte order: a CookedMeshHeader followed by the sections it points to, each aligned to 16
+ *          bytes: vertices, indices (level 0 followed by the other levels of detail), levels of detail, submeshes,
+ *          skeleton nodes, bones and a table of the strings they name.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_COOKEDMESH_H
+#define CBIT_COOKEDMESH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Mesh.h"
+#include "SkinnedMesh.h"
+#include "utilities/MappedFile.h"
+
+namespace cbit {
+    constexpr char kCookedMeshMagic[4] = {'C', 'B', 'M', 'S'};
+    constexpr std::uint32_t kCookedMeshVersion = 1;
+    constexpr const char *kCookedMeshExtension = ".cbmesh";
+    constexpr const char *kCookedSkinnedMeshExtension = ".cbskin"; // Kept apart so a static cook never shadows it.
+
+    /**
+     * @struct CookedMeshHeader
+     * @brief  Start of a cooked mesh file. Offsets are in bytes from the start of the file.
+     */
+    struct CookedMeshHeader {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t vertexStride; // sizeof the vertex type, so files cooked with another vertex layout are rejected.
+        std::uint32_t vertexCount;
+        std::uint32_t indexCount; // Level 0 only.
+        std::uint32_t lodIndexCount; // Levels 1+, stored right after level 0.
+        std::uint32_t lodCount;
+        std::uint32_t submeshCount;
+        std::uint32_t nodeCount;
+        std::uint32_t boneCount;
+        std::int32_t rootNodeIndex;
+        float boundsMin[3];
+        float boundsMax[3];
+        float globalInverseTransform[16];
+        std::uint64_t vertexOffset;
+        std::uint64_t indexOffset;
+        std::uint64_t lodOffset;
+        std::uint64_t submeshOffset;
+        std::uint64_t nodeOffset;
+        std::uint64_t boneOffset;
+        std::uint64_t stringOffset;
+        std::uint64_t stringSize;
+    };
+
+    /**
+     * @struct CookedMeshSource
+     * @brief  Imported geometry to write to a cooked file. The skeleton members are left empty for static meshes.
+     */
+    struct CookedMeshSource {
+        const void *vertices = nullptr;
+        std::uint32_t vertexStride = 0;
+        std::size_t vertexCount = 0;
+        const unsigned int *indices = nullptr;
+        std::size_t indexCount = 0;
+        const unsigned int *lodIndices = nullptr;
+        std::size_t lodIndexCount = 0;
+        std::vector<MeshLod> lods;
+        glm::vec3 boundsMin{0.0f};
+        glm::vec3 boundsMax{0.0f};
+        std::vector<SkinnedSubmesh> submeshes;
+        std::vector<SkeletonNode> nodes;
+        std::vector<BoneInfo> bones;
+        std::unordered_map<std::string, int> boneMap;
+        glm::mat4 globalInverseTransform{1.0f};
+        int rootNodeIndex = -1;
+    };
+
+    /**
+     * @class   CookedMesh
+     * @brief   Reader and writer of cooked mesh files.
+     * @details A CookedMesh maps its file on open(); the pointers it returns stay valid until it is destroyed.
+     *          Section bounds and string references are validated when the file is opened, so a truncated or foreign
+     *          file is rejected instead of read past its end.
+     */
+    class CookedMesh {
+    public:
+        /**
+         * Write a cooked mesh file, replacing any previous one once the new file is complete.
+         * @param path Destination path; missing directories are created.
+         * @param source Geometry to write.
+         * @return true if the file was written.
+         */
+        static bool write(const std::string &path, const CookedMeshSource &source);
+
+        /**
+         * Map and validate a cooked mesh file.
+         * @param path Path to the file.
+         * @param vertexStride Size of the vertex type the caller uploads.
+         * @return true if the file is a valid cooked mesh of the current version with that vertex size.
+         */
+        bool open(const std::string &path, std::uint32_t vertexStride);
+
+        [[nodiscard]] const CookedMeshHeader &getHeader() const { return _header; }
+
+        /**
+         * Vertex blob in GPU layout; getHeader().vertexCount vertices of getHeader().vertexStride bytes.
+         */
+        [[nodiscard]] const void *getVertices() const;
+
+        /**
+         * Index blob; level 0 followed by the other levels of detail.
+         */
+        [[nodiscard]] const unsigned int *getIndices() const;
+
+        [[nodiscard]] std::vector<MeshLod> readLods() const;
+        [[nodiscard]] std::vector<SkinnedSubmesh> readSubmeshes() const;
+
+        /**
+         * Read the skeleton; children lists are rebuilt from the parent indices.
+         */
+        [[nodiscard]] std::vector<SkeletonNode> readNodes() const;
+
+        /**
+         * Read the bone offsets and the map from bone names to bone indices.
+         */
+        void readBones(std::vector<BoneInfo> &bones, std::unordered_map<std::string, int> &boneMap) const;
+
+        /**
+         * Copy the geometry a retention policy keeps out of the mapping; nothing is copied for Discard.
+         * @tparam VertexType Vertex type the file was opened with.
+         * @param retention Policy of the mesh being loaded.
+         * @param vertices Receives the vertices for KeepFull.
+         * @param positions Receives the vertex positions for KeepPositions.
+         * @param indices Receives the level 0 indices unless the policy is Discard.
+         */
+        template<typename VertexType>
+        void retainGeometry(const GeometryRetention retention,
+                            TrackedVector<VertexType, MemoryCategory::Meshes> &vertices,
+                            TrackedVector<glm::vec3, MemoryCategory::Meshes> &positions,
+                            TrackedVector<unsigned int, MemoryCategory::Meshes> &indices) const {
+            const auto *vertexBytes = static_cast<const unsigned char *>(getVertices());
+            if (retention == GeometryRetention::KeepFull) {
+                vertices.resize(_header.vertexCount);
+                std::memcpy(vertices.data(), vertexBytes, vertices.size() * sizeof(VertexType));
+            } else if (retention == GeometryRetention::KeepPositions) {
+                positions.resize(_header.vertexCount);
+                for (std::size_t i = 0; i < positions.size(); ++i) {
+                    std::memcpy(&positions[i], vertexBytes + i * sizeof(VertexType) + offsetof(VertexType, position),
+                                sizeof(glm::vec3));
+                }
+            }
+            if (retention != GeometryRetention::Discard) {
+                indices.assign(getIndices(), getIndices() + _header.indexCount);
+            }
+        }
+
+    private:
+        [[nodiscard]] bool _validate(std::uint32_t vertexStride) const;
+        [[nodiscard]] std::string _readString(std::uint32_t offset, std::uint32_t length) const;
+
+        MappedFile _file;
+        CookedMeshHeader _header{};
+    };
+}
+
+#endif //CBIT_COOKEDMESH_H
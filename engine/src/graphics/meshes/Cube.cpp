@@ -9,7 +9,12 @@
 #include "Cube.h"
 #include <glm/glm.hpp>
 
-cbit::Cube::Cube() {
+cbit::Cube::Cube()
+    : Cube(GeometryRetention::Discard) {
+}
+
+cbit::Cube::Cube(const GeometryRetention retention)
+    : Mesh(retention) {
    // Define 36 unique vertices (6 faces × 2 triangles × 3 vertices)
     vertices = {
         // Front face (+Z)
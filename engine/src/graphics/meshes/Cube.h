@@ -22,6 +22,8 @@ namespace cbit {
     public:
         Cube();
 
+        explicit Cube(GeometryRetention retention);
+
         ~Cube() override;
     };
 }
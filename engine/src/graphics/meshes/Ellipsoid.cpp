@@ -13,7 +13,8 @@
 #include "glm/ext/scalar_constants.hpp"
 
 cbit::Ellipsoid::Ellipsoid(const float radiusX, const float radiusY, const float radiusZ, const int sectorCount,
-                           const int stackCount) {
+                           const int stackCount, const GeometryRetention retention)
+    : Mesh(retention) {
     vertices.clear();
 
     for (int i = 0; i <= stackCount; ++i) {
@@ -58,7 +59,7 @@ cbit::Ellipsoid::Ellipsoid(const float radiusX, const float radiusY, const float
         }
     }
 
-    this->indices = indices; // you'll need to add this to your Mesh class
+    this->indices.assign(indices.begin(), indices.end());
     initializeBuffers();
     loaded = true;
 }
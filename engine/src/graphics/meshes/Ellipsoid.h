@@ -52,8 +52,10 @@ namespace cbit {
          * @param radiusZ     Semi-axis length along the Z axis.
          * @param sectorCount Number of sectors (longitude divisions). Default is 36.
          * @param stackCount  Number of stacks (latitude divisions). Default is 18.
+         * @param retention   CPU geometry to keep after upload. Default is to keep none.
          */
-        Ellipsoid(float radiusX, float radiusY, float radiusZ, int sectorCount = 36, int stackCount = 18);
+        Ellipsoid(float radiusX, float radiusY, float radiusZ, int sectorCount = 36, int stackCount = 18,
+                  GeometryRetention retention = GeometryRetention::Discard);
     };
 }
 
@@ -10,12 +10,21 @@
 #include "Mesh.h"
 #include <algorithm>
 #include <cctype>
+#include <cstddef>
+#include <cstring>
 #include <sstream>
 #include <fstream>
-#include <numeric>
+#include <map>
+#include <tuple>
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
+#include <glm/gtc/type_ptr.hpp>
+#include "CookedMesh.h"
+#include "MeshSimplifier.h"
+#include "graphics/renderers/GLCalls.h"
+#include "graphics/renderers/GLThread.h"
+#include "utilities/AssetPaths.h"
 #include "utilities/Logger.h"
 
 /**
@@ -46,19 +55,41 @@ std::string toLowerCase(std::string value) {
 }
 
 cbit::Mesh::Mesh()
-    : loaded(false),
+    : Mesh(GeometryRetention::Discard) {
+}
+
+cbit::Mesh::Mesh(const GeometryRetention retention)
+    : boundsMin(0.0f),
+      boundsMax(0.0f),
+      vertexCount(0),
+      indexCount(0),
+      retention(retention),
+      loaded(false),
       VAO(0),
       VBO(0),
-      EBO(0) {
+      EBO(0),
+      gpuBytes(0) {
 }
 
 cbit::Mesh::~Mesh() {
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-    glDeleteBuffers(1, &EBO);
+    MemoryTracker::trackGpu(MemoryCategory::Meshes, -gpuBytes);
+    GLThread::release(GLObjectType::VertexArray, VAO);
+    GLThread::release(GLObjectType::Buffer, VBO);
+    GLThread::release(GLObjectType::Buffer, EBO);
 }
 
 bool cbit::Mesh::loadObj(const std::string &filename) {
+    if (!importObj(filename)) {
+        return false;
+    }
+
+    // Create and initialize the buffers
+    generateLods();
+    initializeBuffers();
+    return loaded = true;
+}
+
+bool cbit::Mesh::importObj(const std::string &filename) {
     if (filename.find(".obj") != std::string::npos) {
         std::vector<glm::vec3> tempNormals;
         std::vector<glm::vec2> tempUVs;
@@ -137,8 +168,23 @@ bool cbit::Mesh::loadObj(const std::string &filename) {
         // close file
         fin.close();
 
+        vertices.clear();
+        indices.clear();
+
+        // Corners with the same position, UV and normal share one vertex, so the mesh is indexed like the file.
+        std::map<std::tuple<unsigned int, unsigned int, unsigned int>, unsigned int> cornerVertices;
+
         // For each vertex of each triangle
         for (unsigned int i = 0; i < vertexIndices.size(); i++) {
+            const unsigned int uvIndex = tempUVs.empty() ? 0 : uvIndices[i];
+            const unsigned int normalIndex = tempNormals.empty() ? 0 : normalIndices[i];
+            const auto [corner, inserted] = cornerVertices.emplace(
+                std::make_tuple(vertexIndices[i], uvIndex, normalIndex), static_cast<unsigned int>(vertices.size()));
+            indices.push_back(corner->second);
+            if (!inserted) {
+                continue;
+            }
+
             Vertex meshVertex{};
 
             // Get the attributes using the indices
@@ -161,22 +207,87 @@ bool cbit::Mesh::loadObj(const std::string &filename) {
             vertices.push_back(meshVertex);
         }
 
-        indices.resize(vertices.size());
-        std::iota(indices.begin(), indices.end(), 0u);
-
-        // Create and initialize the buffers
-        initializeBuffers();
-
-        return loaded = true;
+        return true;
     }
 
     return false;
 }
 
 bool cbit::Mesh::loadFromFile(const std::string &filename) {
+    const std::string cookedPath = AssetPaths::getCookedPath(filename, kCookedMeshExtension);
+    if (AssetPaths::isCookedCurrent(filename, cookedPath) && loadCooked(cookedPath)) {
+        return true;
+    }
+
+    if (!importFile(filename)) {
+        return false;
+    }
+    if (saveCooked(cookedPath)) {
+        Logger::log()->info("Cooked {} to {}", filename, cookedPath);
+    }
+    initializeBuffers();
+    loaded = true;
+    return true;
+}
+
+bool cbit::Mesh::cookFile(const std::string &filename, const std::string &cookedPath) {
+    return importFile(filename) && saveCooked(cookedPath);
+}
+
+bool cbit::Mesh::loadCooked(const std::string &path) {
+    CookedMesh cooked;
+    if (!cooked.open(path, sizeof(Vertex))) {
+        return false;
+    }
+
+    const CookedMeshHeader &header = cooked.getHeader();
+    lods = cooked.readLods();
+    boundsMin = glm::make_vec3(header.boundsMin);
+    boundsMax = glm::make_vec3(header.boundsMax);
+    // Swapping with an empty vector frees the memory; clear() alone keeps the capacity.
+    decltype(vertices)().swap(vertices);
+    decltype(indices)().swap(indices);
+    decltype(positions)().swap(positions);
+    decltype(lodIndices)().swap(lodIndices);
+
+    const unsigned int *cookedIndices = cooked.getIndices();
+    uploadBuffers(cooked.getVertices(), header.vertexCount, cookedIndices, header.indexCount,
+                  cookedIndices + header.indexCount, header.lodIndexCount);
+
+    cooked.retainGeometry(retention, vertices, positions, indices);
+
+    Logger::log()->info("Loaded cooked mesh {} ({} vertices, {} levels of detail)", path, vertexCount, getLodCount());
+    return loaded = true;
+}
+
+bool cbit::Mesh::saveCooked(const std::string &path) const {
+    if (vertices.empty() || indices.empty()) {
+        return false;
+    }
+
+    CookedMeshSource source;
+    source.vertices = vertices.data();
+    source.vertexStride = sizeof(Vertex);
+    source.vertexCount = vertices.size();
+    source.indices = indices.data();
+    source.indexCount = indices.size();
+    source.lodIndices = lodIndices.data();
+    source.lodIndexCount = lodIndices.size();
+    source.lods = lods;
+    source.boundsMin = boundsMin;
+    source.boundsMax = boundsMax;
+    return CookedMesh::write(path, source);
+}
+
+bool cbit::Mesh::importFile(const std::string &filename) {
     const std::string lowerFilename = toLowerCase(filename);
     if (lowerFilename.find(".obj") != std::string::npos) {
-        return loadObj(filename);
+        if (!importObj(filename)) {
+            return false;
+        }
+        generateLods();
+        computeBounds();
+        return true;
     }
 
     Assimp::Importer importer;
@@ -229,43 +340,179 @@ bool cbit::Mesh::loadFromFile(const std::string &filename) {
         indices.push_back(face.mIndices[2]);
     }
 
-    initializeBuffers();
-    loaded = true;
+    generateLods();
+    computeBounds();
     return true;
 }
 
 void cbit::Mesh::initializeBuffers() {
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
+    computeBounds();
+    uploadBuffers(vertices.data(), vertices.size(), indices.data(), indices.size(), lodIndices.data(),
+                  lodIndices.size());
+    decltype(lodIndices)().swap(lodIndices);
+    applyRetention();
+}
 
-    glBindVertexArray(VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, static_cast<int>(vertices.size() * sizeof(Vertex)), &vertices[0], GL_STATIC_DRAW);
+void cbit::Mesh::computeBounds() {
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        boundsMin = i == 0 ? vertices[i].position : glm::min(boundsMin, vertices[i].position);
+        boundsMax = i == 0 ? vertices[i].position : glm::max(boundsMax, vertices[i].position);
+    }
+}
 
-    glGenBuffers(1, &EBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<int>(indices.size() * sizeof(unsigned int)), &indices[0], GL_STATIC_DRAW);
+void cbit::Mesh::uploadBuffers(const void *vertexData, const size_t vertexCount, const unsigned int *indexData,
+                               const size_t indexCount, const unsigned int *lodIndexData,
+                               const size_t lodIndexCount) {
+    const size_t vertexBytes = vertexCount * sizeof(Vertex);
+    const size_t indexBytes = indexCount * sizeof(unsigned int);
+    const size_t lodIndexBytes = lodIndexCount * sizeof(unsigned int);
+    MemoryTracker::trackGpu(MemoryCategory::Meshes, -gpuBytes);
+    gpuBytes = static_cast<std::int64_t>(vertexBytes + indexBytes + lodIndexBytes);
+    MemoryTracker::trackGpu(MemoryCategory::Meshes, gpuBytes);
+
+    GLThread::run([&] {
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<int>(vertexBytes), vertexData, GL_STATIC_DRAW);
+
+        // Levels of detail follow the full index list in the same buffer.
+        glGenBuffers(1, &EBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<int>(indexBytes + lodIndexBytes), nullptr, GL_STATIC_DRAW);
+        if (indexBytes > 0) {
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, static_cast<int>(indexBytes), indexData);
+        }
+        if (lodIndexBytes > 0) {
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, static_cast<int>(indexBytes), static_cast<int>(lodIndexBytes),
+                            lodIndexData);
+        }
 
-    // Vertex Positions
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), static_cast<GLvoid *>(nullptr));
-    glEnableVertexAttribArray(0);
+        // Vertex Positions
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), static_cast<GLvoid *>(nullptr));
+        glEnableVertexAttribArray(0);
 
-    // Normal attribute
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid *>(3 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(1);
+        // Normal attribute
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid *>(3 * sizeof(GLfloat)));
+        glEnableVertexAttribArray(1);
 
-    // Vertex Texture Coords
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid *>(6 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(2);
+        // Vertex Texture Coords
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid *>(6 * sizeof(GLfloat)));
+        glEnableVertexAttribArray(2);
 
-    // unbind to make sure other code does not change it somewhere else
-    glBindVertexArray(0);
+        // unbind to make sure other code does not change it somewhere else
+        glBindVertexArray(0);
+    });
+
+    this->vertexCount = vertexCount;
+    this->indexCount = indexCount;
+}
+
+void cbit::Mesh::generateLods() {
+    decltype(lodIndices)().swap(lodIndices);
+    MeshSimplifier::buildLodChain(vertices.empty() ? nullptr : &vertices[0].position, vertices.size(),
+                                  sizeof(Vertex), indices.data(), indices.size(), lods, lodIndices);
+    if (lods.empty()) {
+        return;
+    }
+    Logger::log()->info("Generated {} levels of detail: {} down to {} triangles", lods.size() - 1,
+                        lods.front().indexCount / 3, lods.back().indexCount / 3);
+}
+
+void cbit::Mesh::setGeometryRetention(const GeometryRetention retention) {
+    if (vertexCount > 0 && this->retention != retention) {
+        if (this->retention == GeometryRetention::Discard ||
+            (this->retention == GeometryRetention::KeepPositions && retention == GeometryRetention::KeepFull)) {
+            Logger::log()->warn("Mesh geometry was already released; the new retention applies to the next load");
+        }
+    }
+    this->retention = retention;
+    if (vertexCount > 0) {
+        applyRetention();
+    }
+}
+
+void cbit::Mesh::applyRetention() {
+    switch (retention) {
+        case GeometryRetention::KeepFull:
+            decltype(positions)().swap(positions);
+            break;
+        case GeometryRetention::KeepPositions:
+            if (!vertices.empty()) {
+                positions.resize(vertices.size());
+                std::transform(vertices.begin(), vertices.end(), positions.begin(), [](const Vertex &vertex) {
+                    return vertex.position;
+                });
+            }
+            decltype(vertices)().swap(vertices);
+            break;
+        case GeometryRetention::Discard:
+            decltype(vertices)().swap(vertices);
+            decltype(indices)().swap(indices);
+            decltype(positions)().swap(positions);
+            break;
+    }
 }
 
 void cbit::Mesh::draw() {
     if (!loaded) return;
 
-    glBindVertexArray(VAO);
-    glDrawElements(GL_TRIANGLES, static_cast<int>(indices.size()), GL_UNSIGNED_INT, nullptr);
+    getDrawCall().draw();
+}
+
+cbit::MeshDrawCall cbit::Mesh::getDrawCall() const {
+    MeshDrawCall drawCall;
+    if (loaded) {
+        drawCall.vertexArray = VAO;
+        drawCall.count = static_cast<GLsizei>(indexCount);
+    }
+    return drawCall;
+}
+
+cbit::MeshDrawCall cbit::Mesh::getLodDrawCall(const int lod) const {
+    if (lod <= 0 || lods.size() <= 1) {
+        return getDrawCall();
+    }
+
+    const MeshLod &level = lods[std::min(static_cast<size_t>(lod), lods.size() - 1)];
+    MeshDrawCall drawCall = getDrawCall();
+    drawCall.indexOffset = static_cast<GLsizei>(level.indexOffset);
+    drawCall.count = static_cast<GLsizei>(level.indexCount);
+    return drawCall;
+}
+
+int cbit::selectLodLevel(const int lodCount, const int current, const float screenHeight) {
+    if (lodCount <= 1) {
+        return 0;
+    }
+
+    // Level n is meant for screen heights from kLodScreenHeight / 2^n up to twice that; level 0 has no upper bound
+    // and the last level no lower one. Moving to another level requires crossing the boundary by the hysteresis margin.
+    int level = std::clamp(current, 0, lodCount - 1);
+    while (level + 1 < lodCount &&
+           screenHeight < kLodScreenHeight / static_cast<float>(1 << level) * (1.0f - kLodHysteresis)) {
+        ++level;
+    }
+    while (level > 0 &&
+           screenHeight > kLodScreenHeight / static_cast<float>(1 << (level - 1)) * (1.0f + kLodHysteresis)) {
+        --level;
+    }
+    return level;
+}
+
+void cbit::MeshDrawCall::draw() const {
+    if (!isValid()) {
+        return;
+    }
+
+    glBindVertexArray(vertexArray);
+    if (indexed) {
+        gl::drawElements(mode, count, GL_UNSIGNED_INT,
+                         reinterpret_cast<const void *>(static_cast<size_t>(indexOffset) * sizeof(unsigned int)));
+    } else {
+        gl::drawArrays(mode, 0, count);
+    }
     glBindVertexArray(0);
 }
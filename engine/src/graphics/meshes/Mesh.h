@@ -9,12 +9,55 @@
 #ifndef CBIT_MESH_H
 #define CBIT_MESH_H
 
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <glm/glm.hpp>
+#include "MeshSimplifier.h"
 #include "OpenGLInclude.h"
+#include "core/MemoryTracker.h"
 
 namespace cbit {
+    /**
+     * @struct MeshDrawCall
+     * @brief  GL state needed to draw a mesh, copied into render snapshots instead of the mesh itself.
+     */
+    struct MeshDrawCall {
+        GLuint vertexArray = 0;
+        GLenum mode = GL_TRIANGLES;
+        GLsizei count = 0;
+        GLsizei indexOffset = 0; // In indices; ignored for non-indexed draws.
+        bool indexed = true;
+
+        [[nodiscard]] bool isValid() const { return vertexArray != 0 && count > 0; }
+
+        /**
+         * Issue the draw call. Must run on the GL thread.
+         */
+        void draw() const;
+    };
+
+    /**
+     * Projected diameter, as a fraction of the viewport height, below which level 0 gives way to level 1.
+     * The threshold halves for each following level.
+     */
+    constexpr float kLodScreenHeight = 0.25f;
+
+    /**
+     * Fraction past a threshold an object must move before its level changes, so it does not flicker between two
+     * levels at the boundary.
+     */
+    constexpr float kLodHysteresis = 0.2f;
+
+    /**
+     * Pick the level of detail for an object of a given size on screen.
+     * @param lodCount Number of levels the object has.
+     * @param current Level used last frame.
+     * @param screenHeight Projected diameter as a fraction of the viewport height.
+     * @return Level to draw this frame.
+     */
+    int selectLodLevel(int lodCount, int current, float screenHeight);
+
     /**
      * @struct  Vertex
      * @brief   Represents a single vertex in a mesh.
@@ -28,6 +71,16 @@ namespace cbit {
         glm::vec2 textureCoordinates;
     };
 
+    /**
+     * @enum  GeometryRetention
+     * @brief What a mesh keeps in CPU memory once its buffers are uploaded.
+     */
+    enum class GeometryRetention : std::uint8_t {
+        Discard,      // Keep nothing; the GPU copy is the only one. Default for meshes that are only drawn.
+        KeepFull,     // Keep vertices and indices, e.g. for picking or rebuilding the mesh.
+        KeepPositions // Keep positions and indices only, e.g. for collision shapes and raycasts.
+    };
+
     /**
      * @class   Mesh
      * @brief   Represents a 3D mesh loaded from an OBJ file.
@@ -44,6 +97,12 @@ namespace cbit {
          */
         Mesh();
 
+        /**
+         * Constructor for a mesh that keeps some of its geometry after upload.
+         * @param retention CPU geometry to keep once the buffers are initialized.
+         */
+        explicit Mesh(GeometryRetention retention);
+
         /**
          * Destructor.
          * Cleans up OpenGL resources associated with the mesh.
@@ -66,12 +125,29 @@ namespace cbit {
         bool loadObj(const std::string &filename);
 
         /**
-         * @brief   Loads a model file supported by Assimp (e.g. FBX).
+         * @brief   Loads a model file supported by Assimp (e.g. FBX) or a Wavefront OBJ file.
          * @param   filename
          * @return  if the model was loaded successfully.
+         * @details Loads the cooked copy of the file when it is not older than the source. Otherwise the source is
+         *          imported and cooked, so the next load skips the import.
          */
         bool loadFromFile(const std::string &filename);
 
+        /**
+         * @brief   Loads a cooked mesh file, uploading its vertex and index data straight from the mapped file.
+         * @param   path
+         * @return  if the file exists and is a valid cooked mesh.
+         */
+        bool loadCooked(const std::string &path);
+
+        /**
+         * @brief   Imports a model file and writes its cooked copy without creating GPU buffers.
+         * @param   filename Source model, as accepted by loadFromFile().
+         * @param   cookedPath Destination of the cooked file.
+         * @return  if the model was imported and written.
+         */
+        bool cookFile(const std::string &filename, const std::string &cookedPath);
+
         /**
          * @brief   Renders the mesh using OpenGL.
          * @details Binds the vertex array object and draws the mesh using the currently active shader
@@ -79,20 +155,107 @@ namespace cbit {
          */
         virtual void draw();
 
+        /**
+         * @brief   Describes the draw call for this mesh.
+         * @return  Vertex array and ranges; invalid if the mesh is not loaded.
+         */
+        [[nodiscard]] virtual MeshDrawCall getDrawCall() const;
+
+        /**
+         * @brief   Sets what the mesh keeps in CPU memory after upload.
+         * @details Applies to the next load. On a mesh that is already uploaded, geometry can only be dropped further;
+         *          data that was already discarded is not restored.
+         * @param   retention CPU geometry to keep.
+         */
+        void setGeometryRetention(GeometryRetention retention);
+
+        [[nodiscard]] GeometryRetention getGeometryRetention() const { return retention; }
+
+        /**
+         * @brief   Vertices kept with GeometryRetention::KeepFull; empty otherwise.
+         */
+        [[nodiscard]] const TrackedVector<Vertex, MemoryCategory::Meshes> &getVertices() const { return vertices; }
+
+        /**
+         * @brief   Positions kept with GeometryRetention::KeepPositions; empty otherwise.
+         */
+        [[nodiscard]] const TrackedVector<glm::vec3, MemoryCategory::Meshes> &getPositions() const {
+            return positions;
+        }
+
+        /**
+         * @brief   Indices kept with GeometryRetention::KeepFull or KeepPositions; empty otherwise.
+         */
+        [[nodiscard]] const TrackedVector<unsigned int, MemoryCategory::Meshes> &getIndices() const { return indices; }
+
+        [[nodiscard]] size_t getVertexCount() const { return vertexCount; }
+        [[nodiscard]] size_t getIndexCount() const { return indexCount; }
+
+        [[nodiscard]] int getLodCount() const { return lods.empty() ? 1 : static_cast<int>(lods.size()); }
+
+        /**
+         * @brief   Describes the draw call of one level of detail.
+         * @param   lod Level; 0 is the full mesh. Clamped to the levels the mesh has.
+         */
+        [[nodiscard]] MeshDrawCall getLodDrawCall(int lod) const;
+
+        [[nodiscard]] const glm::vec3 &getBoundsMin() const { return boundsMin; }
+        [[nodiscard]] const glm::vec3 &getBoundsMax() const { return boundsMax; }
+
     protected:
         /**
          * @brief   Initializes OpenGL buffers for the mesh.
          * @details Creates and binds a vertex array object (VAO), vertex buffer object (VBO),
-         *          and element buffer object (EBO) to store vertex data and indices.
+         *          and element buffer object (EBO) to store vertex data and indices. Runs on the GL thread, so
+         *          meshes can be created while a render thread owns the context.
          */
         void initializeBuffers();
 
-        std::vector<Vertex> vertices;
-        std::vector<unsigned int> indices;
+        /**
+         * @brief   Creates the GL buffers from vertex and index data and records the uploaded counts.
+         * @details The data is only read during the call, so it may point into a mapped file.
+         */
+        void uploadBuffers(const void *vertexData, size_t vertexCount, const unsigned int *indexData,
+                           size_t indexCount, const unsigned int *lodIndexData, size_t lodIndexCount);
+
+        /**
+         * @brief   Imports a source model into vertices and indices and builds its levels of detail.
+         */
+        bool importFile(const std::string &filename);
+
+        bool importObj(const std::string &filename);
+
+        bool saveCooked(const std::string &path) const;
+
+        void computeBounds();
+
+        /**
+         * @brief   Drops the CPU geometry that the retention policy does not keep.
+         */
+        void applyRetention();
+
+        /**
+         * @brief   Builds simplified levels of detail from vertices and indices.
+         * @details Call before initializeBuffers(). Levels are stored after the full index list in the same element
+         *          buffer; small meshes and meshes that do not simplify get no extra levels.
+         */
+        void generateLods();
+
+        TrackedVector<Vertex, MemoryCategory::Meshes> vertices;
+        TrackedVector<unsigned int, MemoryCategory::Meshes> indices;
+        TrackedVector<glm::vec3, MemoryCategory::Meshes> positions;
+        TrackedVector<unsigned int, MemoryCategory::Meshes> lodIndices; // Levels 1+; freed once uploaded.
+        std::vector<MeshLod> lods; // Level 0 first; empty when the mesh has no generated levels.
+        glm::vec3 boundsMin;
+        glm::vec3 boundsMax;
+        size_t vertexCount; // Counts of the uploaded buffers; the CPU copies may be gone.
+        size_t indexCount;
+        GeometryRetention retention;
         bool loaded;
         GLuint VAO;
         GLuint VBO;
         GLuint EBO;
+        std::int64_t gpuBytes; // Size of VBO and EBO, reported to the MemoryTracker.
     };
 }
 #endif //CBIT_MESH_H
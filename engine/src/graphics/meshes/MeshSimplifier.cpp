@@ -0,0 +1,345 @@
+/**
+ * @file    MeshSimplifier.cpp
+ * @brief   Implementation of the MeshSimplifier class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "MeshSimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+    // Smallest cosine between a triangle's normal before and after a collapse; larger turns, and triangles that
+    // become degenerate, are rejected.
+    constexpr float kMinNormalCosine = 0.25f;
+
+    std::uint64_t edgeKey(const unsigned int a, const unsigned int b) {
+        return (static_cast<std::uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+    }
+
+    glm::dvec3 toDouble(const glm::vec3 &value) {
+        return {value.x, value.y, value.z};
+    }
+}
+
+void cbit::MeshSimplifier::Quadric::addPlane(const glm::dvec3 &normal, const double distance, const double weight) {
+    a00 += weight * normal.x * normal.x;
+    a01 += weight * normal.x * normal.y;
+    a02 += weight * normal.x * normal.z;
+    a03 += weight * normal.x * distance;
+    a11 += weight * normal.y * normal.y;
+    a12 += weight * normal.y * normal.z;
+    a13 += weight * normal.y * distance;
+    a22 += weight * normal.z * normal.z;
+    a23 += weight * normal.z * distance;
+    a33 += weight * distance * distance;
+    totalWeight += weight;
+}
+
+void cbit::MeshSimplifier::Quadric::add(const Quadric &other) {
+    a00 += other.a00;
+    a01 += other.a01;
+    a02 += other.a02;
+    a03 += other.a03;
+    a11 += other.a11;
+    a12 += other.a12;
+    a13 += other.a13;
+    a22 += other.a22;
+    a23 += other.a23;
+    a33 += other.a33;
+    totalWeight += other.totalWeight;
+}
+
+double cbit::MeshSimplifier::Quadric::evaluate(const glm::dvec3 &point) const {
+    if (totalWeight <= 0.0) {
+        return 0.0;
+    }
+    const double x = point.x;
+    const double y = point.y;
+    const double z = point.z;
+    return (a00 * x * x + 2.0 * a01 * x * y + 2.0 * a02 * x * z + 2.0 * a03 * x
+            + a11 * y * y + 2.0 * a12 * y * z + 2.0 * a13 * y
+            + a22 * z * z + 2.0 * a23 * z
+            + a33) / totalWeight;
+}
+
+cbit::MeshSimplifier::MeshSimplifier(const glm::vec3 *positions, const std::size_t vertexCount,
+                                     const std::size_t positionStride, const unsigned int *indices,
+                                     const std::size_t indexCount)
+    : _positions(vertexCount),
+      _indices(indices, indices + indexCount - indexCount % 3),
+      _vertexTriangles(vertexCount),
+      _quadrics(vertexCount),
+      _versions(vertexCount, 0),
+      _triangleAlive(_indices.size() / 3, true),
+      _locked(vertexCount, false),
+      _removed(vertexCount, false) {
+    const auto *bytes = reinterpret_cast<const unsigned char *>(positions);
+    glm::vec3 boundsMin(0.0f);
+    glm::vec3 boundsMax(0.0f);
+    for (std::size_t i = 0; i < vertexCount; ++i) {
+        std::memcpy(&_positions[i], bytes + i * positionStride, sizeof(glm::vec3));
+        boundsMin = i == 0 ? _positions[i] : glm::min(boundsMin, _positions[i]);
+        boundsMax = i == 0 ? _positions[i] : glm::max(boundsMax, _positions[i]);
+    }
+    _extent = std::max(static_cast<double>(glm::length(boundsMax - boundsMin)), 1e-6);
+
+    // Vertices that share a position sit on a seam; collapsing them would tear the surface or smear attributes.
+    std::map<std::tuple<float, float, float>, unsigned int> firstAtPosition;
+    std::vector<unsigned int> welded(vertexCount);
+    std::vector<unsigned int> positionUses(vertexCount, 0);
+    for (unsigned int i = 0; i < vertexCount; ++i) {
+        const auto key = std::make_tuple(_positions[i].x, _positions[i].y, _positions[i].z);
+        welded[i] = firstAtPosition.emplace(key, i).first->second;
+        ++positionUses[welded[i]];
+    }
+
+    std::unordered_map<std::uint64_t, unsigned int> edgeUses;
+    for (std::size_t triangle = 0; triangle < _triangleAlive.size(); ++triangle) {
+        const unsigned int *corner = &_indices[triangle * 3];
+        if (corner[0] >= vertexCount || corner[1] >= vertexCount || corner[2] >= vertexCount ||
+            corner[0] == corner[1] || corner[1] == corner[2] || corner[0] == corner[2]) {
+            _triangleAlive[triangle] = false;
+            continue;
+        }
+        ++_liveTriangles;
+
+        for (int i = 0; i < 3; ++i) {
+            _vertexTriangles[corner[i]].push_back(static_cast<std::uint32_t>(triangle));
+            ++edgeUses[edgeKey(welded[corner[i]], welded[corner[(i + 1) % 3]])];
+        }
+
+        const glm::dvec3 p0 = toDouble(_positions[corner[0]]);
+        const glm::dvec3 cross = glm::cross(toDouble(_positions[corner[1]]) - p0, toDouble(_positions[corner[2]]) - p0);
+        const double length = glm::length(cross);
+        if (length > 0.0) {
+            // Weighted by area, so large flat triangles resist being pulled out of their plane; the quadric divides by
+            // the summed area, which keeps the cost a squared distance.
+            const glm::dvec3 normal = cross / length;
+            for (int i = 0; i < 3; ++i) {
+                _quadrics[corner[i]].addPlane(normal, -glm::dot(normal, p0), length * 0.5);
+            }
+        }
+    }
+
+    std::vector<bool> lockedPosition(vertexCount, false);
+    for (const auto &[key, uses]: edgeUses) {
+        if (uses == 1) {
+            lockedPosition[static_cast<unsigned int>(key >> 32)] = true;
+            lockedPosition[static_cast<unsigned int>(key & 0xFFFFFFFFu)] = true;
+        }
+    }
+    for (unsigned int i = 0; i < vertexCount; ++i) {
+        _locked[i] = positionUses[welded[i]] > 1 || lockedPosition[welded[i]];
+    }
+}
+
+void cbit::MeshSimplifier::buildLodChain(const glm::vec3 *positions, const std::size_t vertexCount,
+                                         const std::size_t positionStride, const unsigned int *indices,
+                                         const std::size_t indexCount, std::vector<MeshLod> &lods,
+                                         TrackedVector<unsigned int, MemoryCategory::Meshes> &lodIndices,
+                                         CollapseFilter filter) {
+    lods.clear();
+    lodIndices.clear();
+    if (indexCount < kMinLodSourceIndices || vertexCount == 0) {
+        return;
+    }
+
+    lods.push_back({0, static_cast<unsigned int>(indexCount), 0.0f});
+    MeshSimplifier simplifier(positions, vertexCount, positionStride, indices, indexCount);
+    simplifier.setCollapseFilter(std::move(filter));
+
+    std::size_t targetIndexCount = indexCount;
+    for (int level = 1; level < kMaxLodLevels; ++level) {
+        targetIndexCount /= 2;
+        const std::vector<unsigned int> levelIndices = simplifier.simplify(targetIndexCount, kLodMaxError);
+        if (static_cast<float>(levelIndices.size()) > static_cast<float>(lods.back().indexCount) * kLodMinReduction) {
+            break;
+        }
+        lods.push_back({static_cast<unsigned int>(indexCount + lodIndices.size()),
+                        static_cast<unsigned int>(levelIndices.size()), simplifier.getError()});
+        lodIndices.insert(lodIndices.end(), levelIndices.begin(), levelIndices.end());
+    }
+
+    if (lods.size() == 1) {
+        lods.clear();
+    }
+}
+
+void cbit::MeshSimplifier::setCollapseFilter(CollapseFilter filter) {
+    _filter = std::move(filter);
+}
+
+std::vector<unsigned int> cbit::MeshSimplifier::simplify(const std::size_t targetIndexCount, const float maxError) {
+    std::vector<Collapse> heap;
+    for (unsigned int vertex = 0; vertex < _positions.size(); ++vertex) {
+        if (!_removed[vertex] && !_locked[vertex]) {
+            _pushCollapses(vertex, heap);
+        }
+    }
+    std::make_heap(heap.begin(), heap.end(), std::greater<>());
+
+    const double maxCost = std::pow(static_cast<double>(maxError) * _extent, 2.0);
+    while (_liveTriangles * 3 > targetIndexCount && !heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<>());
+        const Collapse collapse = heap.back();
+        heap.pop_back();
+
+        if (_removed[collapse.from] || _removed[collapse.to] ||
+            _versions[collapse.from] != collapse.fromVersion || _versions[collapse.to] != collapse.toVersion) {
+            continue;
+        }
+        if (collapse.cost > maxCost) {
+            break;
+        }
+        if (!_canCollapse(collapse.from, collapse.to)) {
+            continue;
+        }
+
+        _collapse(collapse.from, collapse.to);
+        _error = std::max(_error, static_cast<float>(std::sqrt(std::max(collapse.cost, 0.0)) / _extent));
+
+        // Costs around the surviving vertex changed; queue fresh entries, older ones fail the version check.
+        const std::size_t before = heap.size();
+        _pushCollapses(collapse.to, heap);
+        for (const std::uint32_t triangle: _vertexTriangles[collapse.to]) {
+            if (!_triangleAlive[triangle]) {
+                continue;
+            }
+            for (int i = 0; i < 3; ++i) {
+                const unsigned int neighbor = _indices[triangle * 3 + i];
+                if (neighbor != collapse.to && !_locked[neighbor]) {
+                    const double cost = _cost(neighbor, collapse.to);
+                    heap.push_back({cost, neighbor, collapse.to, _versions[neighbor], _versions[collapse.to]});
+                }
+            }
+        }
+        for (std::size_t i = before; i < heap.size(); ++i) {
+            std::push_heap(heap.begin(), heap.begin() + static_cast<std::ptrdiff_t>(i) + 1, std::greater<>());
+        }
+    }
+
+    std::vector<unsigned int> result;
+    result.reserve(_liveTriangles * 3);
+    for (std::size_t triangle = 0; triangle < _triangleAlive.size(); ++triangle) {
+        if (_triangleAlive[triangle]) {
+            result.insert(result.end(), _indices.begin() + triangle * 3, _indices.begin() + triangle * 3 + 3);
+        }
+    }
+    return result;
+}
+
+double cbit::MeshSimplifier::_cost(const unsigned int from, const unsigned int to) const {
+    Quadric quadric = _quadrics[from];
+    quadric.add(_quadrics[to]);
+    return std::max(quadric.evaluate(toDouble(_positions[to])), 0.0);
+}
+
+bool cbit::MeshSimplifier::_canCollapse(const unsigned int from, const unsigned int to) const {
+    // Link condition: the only vertices adjacent to both ends may be the opposite corners of the triangles on the
+    // edge. Any other common neighbor would leave two triangles on the same three vertices after the collapse.
+    std::vector<unsigned int> edgeOpposites;
+    std::vector<unsigned int> fromNeighbors;
+    for (const std::uint32_t triangle: _vertexTriangles[from]) {
+        if (!_triangleAlive[triangle]) {
+            continue;
+        }
+        const unsigned int *corner = &_indices[triangle * 3];
+        const bool onEdge = corner[0] == to || corner[1] == to || corner[2] == to;
+        for (int i = 0; i < 3; ++i) {
+            if (corner[i] != from && corner[i] != to) {
+                (onEdge ? edgeOpposites : fromNeighbors).push_back(corner[i]);
+            }
+        }
+    }
+    if (edgeOpposites.empty()) {
+        return false;
+    }
+    for (const std::uint32_t triangle: _vertexTriangles[to]) {
+        if (!_triangleAlive[triangle]) {
+            continue;
+        }
+        for (int i = 0; i < 3; ++i) {
+            const unsigned int neighbor = _indices[triangle * 3 + i];
+            if (neighbor != from && neighbor != to &&
+                std::find(fromNeighbors.begin(), fromNeighbors.end(), neighbor) != fromNeighbors.end() &&
+                std::find(edgeOpposites.begin(), edgeOpposites.end(), neighbor) == edgeOpposites.end()) {
+                return false;
+            }
+        }
+    }
+
+    for (const std::uint32_t triangle: _vertexTriangles[from]) {
+        if (!_triangleAlive[triangle]) {
+            continue;
+        }
+        const unsigned int *corner = &_indices[triangle * 3];
+        if (corner[0] == to || corner[1] == to || corner[2] == to) {
+            continue;
+        }
+
+        // Triangles that stay must keep facing roughly the same way once "from" moves onto "to". A bare sign test
+        // lets through slivers turned almost edge-on.
+        glm::vec3 before[3];
+        glm::vec3 after[3];
+        for (int i = 0; i < 3; ++i) {
+            before[i] = _positions[corner[i]];
+            after[i] = corner[i] == from ? _positions[to] : before[i];
+        }
+        const glm::vec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+        const glm::vec3 normalAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+        if (glm::dot(normalBefore, normalAfter) <=
+            kMinNormalCosine * glm::length(normalBefore) * glm::length(normalAfter)) {
+            return false;
+        }
+    }
+
+    return !_filter || _filter(from, to);
+}
+
+void cbit::MeshSimplifier::_collapse(const unsigned int from, const unsigned int to) {
+    for (const std::uint32_t triangle: _vertexTriangles[from]) {
+        if (!_triangleAlive[triangle]) {
+            continue;
+        }
+        unsigned int *corner = &_indices[triangle * 3];
+        if (corner[0] == to || corner[1] == to || corner[2] == to) {
+            _triangleAlive[triangle] = false;
+            --_liveTriangles;
+            continue;
+        }
+        std::replace(corner, corner + 3, from, to);
+        _vertexTriangles[to].push_back(triangle);
+    }
+
+    _vertexTriangles[from].clear();
+    _vertexTriangles[from].shrink_to_fit();
+    _quadrics[to].add(_quadrics[from]);
+    _removed[from] = true;
+    ++_versions[from];
+    ++_versions[to];
+}
+
+void cbit::MeshSimplifier::_pushCollapses(const unsigned int vertex, std::vector<Collapse> &heap) const {
+    if (_locked[vertex]) {
+        return;
+    }
+    for (const std::uint32_t triangle: _vertexTriangles[vertex]) {
+        if (!_triangleAlive[triangle]) {
+            continue;
+        }
+        for (int i = 0; i < 3; ++i) {
+            const unsigned int neighbor = _indices[triangle * 3 + i];
+            if (neighbor != vertex) {
+                heap.push_back({_cost(vertex, neighbor), vertex, neighbor, _versions[vertex], _versions[neighbor]});
+            }
+        }
+    }
+}
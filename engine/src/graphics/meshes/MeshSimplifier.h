@@ -0,0 +1,157 @@
+/**
+ * @file    MeshSimplifier.h
+ * @brief   Header file for the MeshSimplifier class.
+ * @details Quadric error metric simplification used to build levels of detail for imported meshes. Levels reuse the
+ *          vertices of the source mesh and only produce new index lists, so every level draws from the same vertex
+ *          buffer.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_MESHSIMPLIFIER_H
+#define CBIT_MESHSIMPLIFIER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include <glm/glm.hpp>
+#include "core/MemoryTracker.h"
+
+namespace cbit {
+    /**
+     * @struct MeshLod
+     * @brief  Index range of one level of detail inside a mesh's element buffer.
+     */
+    struct MeshLod {
+        unsigned int indexOffset = 0;
+        unsigned int indexCount = 0;
+        float error = 0.0f; // Simplification error relative to the mesh size; 0 for the source level.
+    };
+
+    constexpr int kMaxLodLevels = 4;
+
+    // Meshes below this size are cheap enough at full detail.
+    constexpr std::size_t kMinLodSourceIndices = 3 * 512;
+
+    // Largest simplification error, relative to the mesh size, a level may have.
+    constexpr float kLodMaxError = 0.05f;
+
+    // A level must have at most this fraction of the previous level's indices to be worth keeping.
+    constexpr float kLodMinReduction = 0.8f;
+
+    /**
+     * @class   MeshSimplifier
+     * @brief   Progressive edge-collapse simplifier driven by quadric error metrics.
+     * @details Edges are collapsed onto one of their endpoints (half-edge collapse), cheapest first, where the cost is
+     *          the area-weighted mean squared distance of the surviving vertex to the planes of the triangles merged
+     *          into it, so it compares directly against a squared distance. Collapses that would flip a triangle or
+     *          turn it nearly edge-on, or that break the link condition and would fold the surface onto itself, are
+     *          rejected.
+     *
+     *          Vertices are never moved, so attributes stay exact. Vertices on an open boundary and vertices that
+     *          share their position with another vertex (UV or normal seams, submesh borders) are locked, which keeps
+     *          seams and silhouettes intact. A collapse filter can veto further collapses, e.g. between vertices with
+     *          different bone weights.
+     *
+     *          State carries over between simplify() calls, so a chain of levels is built by asking for fewer and fewer
+     *          indices on the same object.
+     */
+    class MeshSimplifier {
+    public:
+        using CollapseFilter = std::function<bool(unsigned int from, unsigned int to)>;
+
+        /**
+         * Build the levels of detail of an imported mesh, each with about half the indices of the previous one.
+         * @details Level 0 is the source index list. The chain stops at kMaxLodLevels, at kLodMaxError, or once a
+         *          level no longer removes enough indices (kLodMinReduction). Meshes below kMinLodSourceIndices get
+         *          no levels.
+         * @param positions First vertex position; vertices are positionStride bytes apart.
+         * @param vertexCount Number of vertices.
+         * @param positionStride Bytes between consecutive positions.
+         * @param indices Source triangle list.
+         * @param indexCount Number of source indices; a multiple of 3.
+         * @param lods Receives every level including the source, or nothing if no coarser level was kept.
+         * @param lodIndices Receives the indices of levels 1 and up; the offsets in lods assume they follow the
+         *                   source indices in the element buffer.
+         * @param filter Optional collapse filter, see setCollapseFilter().
+         */
+        static void buildLodChain(const glm::vec3 *positions, std::size_t vertexCount, std::size_t positionStride,
+                                  const unsigned int *indices, std::size_t indexCount, std::vector<MeshLod> &lods,
+                                  TrackedVector<unsigned int, MemoryCategory::Meshes> &lodIndices,
+                                  CollapseFilter filter = nullptr);
+
+        /**
+         * @param positions First vertex position; vertices are positionStride bytes apart.
+         * @param vertexCount Number of vertices.
+         * @param positionStride Bytes between consecutive positions, e.g. sizeof(Vertex).
+         * @param indices Triangle list.
+         * @param indexCount Number of indices; a multiple of 3.
+         */
+        MeshSimplifier(const glm::vec3 *positions, std::size_t vertexCount, std::size_t positionStride,
+                       const unsigned int *indices, std::size_t indexCount);
+
+        /**
+         * Set a predicate that must allow every collapse.
+         * @param filter Called with the vertex that disappears and the vertex it merges into.
+         */
+        void setCollapseFilter(CollapseFilter filter);
+
+        /**
+         * Collapse edges until the mesh has at most targetIndexCount indices or the next collapse would exceed
+         * maxError.
+         * @param targetIndexCount Index count to reach.
+         * @param maxError Largest allowed error, relative to the diagonal of the mesh bounds.
+         * @return Index list of the simplified mesh.
+         */
+        std::vector<unsigned int> simplify(std::size_t targetIndexCount, float maxError);
+
+        /**
+         * Get the largest error of any collapse so far, relative to the diagonal of the mesh bounds.
+         */
+        [[nodiscard]] float getError() const { return _error; }
+
+    private:
+        struct Quadric {
+            double a00 = 0.0, a01 = 0.0, a02 = 0.0, a03 = 0.0;
+            double a11 = 0.0, a12 = 0.0, a13 = 0.0;
+            double a22 = 0.0, a23 = 0.0;
+            double a33 = 0.0;
+            double totalWeight = 0.0; // Summed plane weights; evaluate() divides by it.
+
+            void addPlane(const glm::dvec3 &normal, double distance, double weight);
+            void add(const Quadric &other);
+            [[nodiscard]] double evaluate(const glm::dvec3 &point) const; // Mean squared distance.
+        };
+
+        struct Collapse {
+            double cost;
+            unsigned int from;
+            unsigned int to;
+            std::uint32_t fromVersion;
+            std::uint32_t toVersion;
+
+            bool operator>(const Collapse &other) const { return cost > other.cost; }
+        };
+
+        [[nodiscard]] double _cost(unsigned int from, unsigned int to) const;
+        [[nodiscard]] bool _canCollapse(unsigned int from, unsigned int to) const;
+        void _collapse(unsigned int from, unsigned int to);
+        void _pushCollapses(unsigned int vertex, std::vector<Collapse> &heap) const;
+
+        std::vector<glm::vec3> _positions;
+        std::vector<unsigned int> _indices;
+        std::vector<std::vector<std::uint32_t> > _vertexTriangles;
+        std::vector<Quadric> _quadrics;
+        std::vector<std::uint32_t> _versions;
+        std::vector<bool> _triangleAlive;
+        std::vector<bool> _locked;
+        std::vector<bool> _removed;
+        CollapseFilter _filter;
+        std::size_t _liveTriangles = 0;
+        double _extent = 1.0;
+        float _error = 0.0f;
+    };
+}
+
+#endif //CBIT_MESHSIMPLIFIER_H
@@ -0,0 +1,212 @@
+/**
+ * @file    PrimitiveRegistry.cpp
+ * @brief   Implementation of the PrimitiveRegistry class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "PrimitiveRegistry.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+#include "Circle.h"
+#include "Cube.h"
+#include "Ellipsoid.h"
+#include "Quad.h"
+#include "Sphere.h"
+
+namespace {
+    // Coarser levels are not built below these counts; fewer segments no longer read as round.
+    constexpr int kMinCircleSegments = 8;
+    constexpr int kMinStacks = 4;
+    constexpr int kMinSlices = 8;
+
+    enum class PrimitiveShape : std::uint8_t {
+        Cube,
+        Quad,
+        Circle,
+        Sphere,
+        Ellipsoid
+    };
+
+    // Shape, three float parameters and two integer parameters; unused slots are zero.
+    using PrimitiveKey = std::tuple<PrimitiveShape, float, float, float, int, int>;
+
+    // Builds level n, or returns nullptr when level n would be too coarse. Level 0 is required.
+    using CreateLevel = std::function<std::unique_ptr<cbit::Mesh>(int)>;
+
+    struct PrimitiveEntry {
+        std::vector<std::unique_ptr<cbit::Mesh> > levels;
+        CreateLevel createLevel; // Set until uploadPending() builds the levels.
+        float boundingRadius = 0.0f;
+    };
+
+    std::mutex sMutex;
+    std::map<PrimitiveKey, std::uint32_t> sHandles;
+    std::vector<PrimitiveEntry> sEntries;
+    std::vector<std::uint32_t> sPending;
+    std::uint32_t sGeneration = 1; // Bumped by clear(); 0 is left to default-constructed handles.
+
+    /**
+     * @brief  Returns the registered primitive for a key, registering it on first use.
+     * @details Only CPU state is touched, so this is safe from job workers: the levels are built by the next
+     *          uploadPending() on the main thread.
+     */
+    cbit::PrimitiveHandle acquire(const PrimitiveKey &key, const float boundingRadius, CreateLevel createLevel) {
+        std::lock_guard lock(sMutex);
+        if (const auto it = sHandles.find(key); it != sHandles.end()) {
+            return cbit::PrimitiveHandle{it->second, sGeneration};
+        }
+
+        PrimitiveEntry entry;
+        entry.boundingRadius = boundingRadius;
+        entry.createLevel = std::move(createLevel);
+
+        const auto index = static_cast<std::uint32_t>(sEntries.size());
+        sEntries.push_back(std::move(entry));
+        sHandles.emplace(key, index);
+        sPending.push_back(index);
+        return cbit::PrimitiveHandle{index, sGeneration};
+    }
+
+    /**
+     * @brief  Halves a segment count once per level; level 0 keeps the requested count.
+     * @return The count for the level, or 0 if it would drop below the minimum.
+     */
+    int levelCount(const int count, const int minimum, const int level) {
+        if (level == 0) {
+            return count;
+        }
+        const int halved = count >> level;
+        return halved >= minimum ? halved : 0;
+    }
+
+    const PrimitiveEntry *findEntry(const cbit::PrimitiveHandle handle) {
+        return handle.isValid() && handle.generation == sGeneration && handle.index < sEntries.size()
+                   ? &sEntries[handle.index]
+                   : nullptr;
+    }
+}
+
+cbit::PrimitiveHandle cbit::PrimitiveRegistry::cube() {
+    // Unit cube: corners at +-0.5.
+    return acquire({PrimitiveShape::Cube, 0.0f, 0.0f, 0.0f, 0, 0}, 0.8660254f,
+                   [](const int level) -> std::unique_ptr<Mesh> {
+                       return level == 0 ? std::make_unique<Cube>() : nullptr;
+                   });
+}
+
+cbit::PrimitiveHandle cbit::PrimitiveRegistry::quad() {
+    // Unit quad: corners at +-0.5.
+    return acquire({PrimitiveShape::Quad, 0.0f, 0.0f, 0.0f, 0, 0}, 0.70710678f,
+                   [](const int level) -> std::unique_ptr<Mesh> {
+                       return level == 0 ? std::make_unique<Quad>() : nullptr;
+                   });
+}
+
+cbit::PrimitiveHandle cbit::PrimitiveRegistry::circle(const float radius, const int segments) {
+    return acquire({PrimitiveShape::Circle, radius, 0.0f, 0.0f, segments, 0}, radius,
+                   [=](const int level) -> std::unique_ptr<Mesh> {
+                       const int levelSegments = levelCount(segments, kMinCircleSegments, level);
+                       return levelSegments > 0 ? std::make_unique<Circle>(radius, levelSegments) : nullptr;
+                   });
+}
+
+cbit::PrimitiveHandle cbit::PrimitiveRegistry::sphere(const float radius, const int stacks, const int slices) {
+    return acquire({PrimitiveShape::Sphere, radius, 0.0f, 0.0f, stacks, slices}, radius,
+                   [=](const int level) -> std::unique_ptr<Mesh> {
+                       const int levelStacks = levelCount(stacks, kMinStacks, level);
+                       const int levelSlices = levelCount(slices, kMinSlices, level);
+                       return levelStacks > 0 && levelSlices > 0
+                                  ? std::make_unique<Sphere>(radius, levelStacks, levelSlices)
+                                  : nullptr;
+                   });
+}
+
+cbit::PrimitiveHandle cbit::PrimitiveRegistry::ellipsoid(const float radiusX, const float radiusY, const float radiusZ,
+                                                         const int sectorCount, const int stackCount) {
+    return acquire({PrimitiveShape::Ellipsoid, radiusX, radiusY, radiusZ, sectorCount, stackCount},
+                   std::max({radiusX, radiusY, radiusZ}),
+                   [=](const int level) -> std::unique_ptr<Mesh> {
+                       const int levelSectors = levelCount(sectorCount, kMinSlices, level);
+                       const int levelStacks = levelCount(stackCount, kMinStacks, level);
+                       return levelSectors > 0 && levelStacks > 0
+                                  ? std::make_unique<Ellipsoid>(radiusX, radiusY, radiusZ, levelSectors, levelStacks)
+                                  : nullptr;
+                   });
+}
+
+cbit::MeshDrawCall cbit::PrimitiveRegistry::getDrawCall(const PrimitiveHandle handle, const int lod) {
+    std::lock_guard lock(sMutex);
+    const PrimitiveEntry *entry = findEntry(handle);
+    if (!entry || entry->levels.empty()) {
+        return {};
+    }
+    const int level = std::clamp(lod, 0, static_cast<int>(entry->levels.size()) - 1);
+    return entry->levels[level]->getDrawCall();
+}
+
+int cbit::PrimitiveRegistry::getLodCount(const PrimitiveHandle handle) {
+    std::lock_guard lock(sMutex);
+    const PrimitiveEntry *entry = findEntry(handle);
+    return entry ? static_cast<int>(entry->levels.size()) : 0;
+}
+
+float cbit::PrimitiveRegistry::getBoundingRadius(const PrimitiveHandle handle) {
+    std::lock_guard lock(sMutex);
+    const PrimitiveEntry *entry = findEntry(handle);
+    return entry ? entry->boundingRadius : 0.0f;
+}
+
+void cbit::PrimitiveRegistry::uploadPending() {
+    std::vector<std::pair<std::uint32_t, CreateLevel> > pending;
+    std::uint32_t generation = 0;
+    {
+        std::lock_guard lock(sMutex);
+        if (sPending.empty()) {
+            return;
+        }
+        generation = sGeneration;
+        pending.reserve(sPending.size());
+        for (const std::uint32_t index: sPending) {
+            pending.emplace_back(index, std::move(sEntries[index].createLevel));
+        }
+        sPending.clear();
+    }
+
+    // Built without the lock: mesh construction waits on the GL thread, which must not wait on the registry.
+    for (auto &[index, createLevel]: pending) {
+        std::vector<std::unique_ptr<Mesh> > levels;
+        for (int level = 0; level < kMaxLodLevels; ++level) {
+            std::unique_ptr<Mesh> mesh = createLevel(level);
+            if (!mesh) {
+                break;
+            }
+            levels.push_back(std::move(mesh));
+        }
+
+        // Dropped if clear() ran meanwhile; the index may already belong to another primitive.
+        std::lock_guard lock(sMutex);
+        if (generation == sGeneration && index < sEntries.size()) {
+            sEntries[index].levels = std::move(levels);
+        }
+    }
+}
+
+std::size_t cbit::PrimitiveRegistry::getCount() {
+    std::lock_guard lock(sMutex);
+    return sEntries.size();
+}
+
+void cbit::PrimitiveRegistry::clear() {
+    std::lock_guard lock(sMutex);
+    sHandles.clear();
+    sEntries.clear();
+    sPending.clear();
+    ++sGeneration;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file    PrimitiveRegistry.h
+ * @brief   Header file for the PrimitiveRegistry class.
+ * @details Procedural primitives (cube, quad, circle, sphere, ellipsoid) are generated once per parameter set and
+ *          shared by every component that uses them. Components store a PrimitiveHandle instead of owning a mesh, so
+ *          they stay trivially copyable and creating an entity does not touch the GPU. Rounded shapes get a chain of
+ *          levels of detail at halved tessellation, picked per entity from their size on screen.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_PRIMITIVEREGISTRY_H
+#define CBIT_PRIMITIVEREGISTRY_H
+
+#include <cstdint>
+#include "Mesh.h"
+
+namespace cbit {
+    /**
+     * @struct PrimitiveHandle
+     * @brief  Reference to shared primitive geometry in the PrimitiveRegistry.
+     * @details The generation is the registry's at the time the handle was handed out. clear() starts a new one, so
+     *          a handle kept across it resolves to nothing instead of to whatever reuses its index.
+     */
+    struct PrimitiveHandle {
+        static constexpr std::uint32_t kInvalid = 0xFFFFFFFFu;
+
+        std::uint32_t index = kInvalid;
+        std::uint32_t generation = 0;
+
+        [[nodiscard]] bool isValid() const { return index != kInvalid; }
+
+        bool operator==(const PrimitiveHandle &other) const {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const PrimitiveHandle &other) const { return !(*this == other); }
+    };
+
+    /**
+     * @class   PrimitiveRegistry
+     * @brief   Cache of procedural primitive meshes keyed by shape and parameters.
+     * @details The first request for a parameter set registers it; later requests return the same handle. Requests
+     *          never touch GL, so components can be built on any thread: the meshes are built and uploaded by
+     *          uploadPending(), which Application calls on the main thread before extracting each frame. Until then
+     *          the primitive has no levels and draws nothing. Geometry lives until clear(), which Application calls
+     *          while the GL context still exists. All functions are thread-safe.
+     *
+     *          Circles, spheres and ellipsoids are built at up to kMaxLodLevels levels and use selectLodLevel(). Each
+     *          level halves the segment counts of the previous one and the chain stops before a level would drop
+     *          below a usable minimum, so coarse primitives may have a single level. Cubes and quads always have one
+     *          level.
+     */
+    class PrimitiveRegistry {
+    public:
+        static PrimitiveHandle cube();
+
+        static PrimitiveHandle quad();
+
+        static PrimitiveHandle circle(float radius = 1.0f, int segments = 32);
+
+        static PrimitiveHandle sphere(float radius = 1.0f, int stacks = 16, int slices = 32);
+
+        static PrimitiveHandle ellipsoid(float radiusX = 1.0f, float radiusY = 1.0f, float radiusZ = 1.0f,
+                                         int sectorCount = 36, int stackCount = 18);
+
+        /**
+         * Get the draw call of shared geometry.
+         * @param handle Handle returned by one of the factory functions.
+         * @param lod Level of detail; clamped to the levels the primitive has.
+         * @return Draw call; invalid if the handle is invalid, the primitive is not uploaded yet or the registry was
+         *         cleared.
+         */
+        static MeshDrawCall getDrawCall(PrimitiveHandle handle, int lod = 0);
+
+        /**
+         * Get the number of levels of detail of a primitive.
+         * @return Level count, or 0 for an invalid handle or a primitive that is not uploaded yet.
+         */
+        static int getLodCount(PrimitiveHandle handle);
+
+        /**
+         * Get the radius of a sphere around the local origin that encloses the primitive.
+         */
+        static float getBoundingRadius(PrimitiveHandle handle);
+
+        /**
+         * Build and upload the primitives registered since the last call. Main thread only; the meshes are created
+         * through GLThread.
+         */
+        static void uploadPending();
+
+        /**
+         * Get the number of distinct primitives that have been registered.
+         */
+        static std::size_t getCount();
+
+        /**
+         * Release every shared mesh. Meant for shutdown; handles handed out before resolve to nothing afterwards,
+         * even once their indices are reused.
+         */
+        static void clear();
+    };
+}
+
+#endif //CBIT_PRIMITIVEREGISTRY_H
@@ -8,7 +8,12 @@
 
 #include "Quad.h"
 
-cbit::Quad::Quad() {
+cbit::Quad::Quad()
+    : Quad(GeometryRetention::Discard) {
+}
+
+cbit::Quad::Quad(const GeometryRetention retention)
+    : Mesh(retention) {
     // 4 corners: pos, normal, uv
     vertices = {
         // top-left
@@ -37,6 +37,12 @@ namespace cbit {
          */
         Quad();
 
+        /**
+         * Constructor for a quad that keeps some of its geometry after upload.
+         * @param retention CPU geometry to keep.
+         */
+        explicit Quad(GeometryRetention retention);
+
         /**
          * Destructor.
          * Cleans up OpenGL resources associated with the quad mesh.
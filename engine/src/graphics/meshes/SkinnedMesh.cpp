@@ -7,16 +7,54 @@
  */
 
 #include "SkinnedMesh.h"
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cfloat>
+#include <cstring>
+#include <iterator>
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <utility>
 #include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include "CookedMesh.h"
+#include "MeshSimplifier.h"
+#include "graphics/animation/AnimationClip.h"
+#include "graphics/renderers/GLCalls.h"
+#include "graphics/renderers/GLThread.h"
+#include "utilities/AssetPaths.h"
 #include "utilities/Logger.h"
 
 namespace {
+    // Largest summed difference of bone weights between two vertices that may be merged. Merging vertices bound to
+    // different bones would make the simplified mesh deform differently from the full one.
+    constexpr float kMaxBoneWeightDifference = 0.25f;
+
+    float boneWeight(const cbit::SkinnedVertex &vertex, const int boneId) {
+        float weight = 0.0f;
+        for (int i = 0; i < cbit::kMaxBoneInfluences; ++i) {
+            if (vertex.boneIds[i] == boneId) {
+                weight += vertex.weights[i];
+            }
+        }
+        return weight;
+    }
+
+    float boneWeightDifference(const cbit::SkinnedVertex &a, const cbit::SkinnedVertex &b) {
+        float difference = 0.0f;
+        for (int i = 0; i < cbit::kMaxBoneInfluences; ++i) {
+            if (a.weights[i] > 0.0f) {
+                difference += std::abs(a.weights[i] - boneWeight(b, a.boneIds[i]));
+            }
+            if (b.weights[i] > 0.0f && boneWeight(a, b.boneIds[i]) == 0.0f) {
+                difference += b.weights[i];
+            }
+        }
+        return difference;
+    }
+
     glm::mat4 toGlmMatrix(const aiMatrix4x4 &matrix) {
     glm::mat4 result;
     result[0][0] = matrix.a1;
@@ -38,17 +76,122 @@ namespace {
         return result;
     }
 
+    void collectMeshTransforms(const aiNode *node, const glm::mat4 &parentTransform,
+                               std::vector<glm::mat4> &meshTransforms) {
+        const glm::mat4 globalTransform = parentTransform * toGlmMatrix(node->mTransformation);
+        for (unsigned int i = 0; i < node->mNumMeshes; ++i) {
+            const unsigned int meshIndex = node->mMeshes[i];
+            if (meshIndex < meshTransforms.size()) {
+                meshTransforms[meshIndex] = globalTransform;
+            }
+        }
+        for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+            collectMeshTransforms(node->mChildren[i], globalTransform, meshTransforms);
+        }
+    }
 }
 
 cbit::SkinnedMesh::SkinnedMesh() = default;
 
 cbit::SkinnedMesh::~SkinnedMesh() {
-    glDeleteVertexArrays(1, &_vao);
-    glDeleteBuffers(1, &_vbo);
-    glDeleteBuffers(1, &_ebo);
+    MemoryTracker::trackGpu(MemoryCategory::Meshes, -_gpuBytes);
+    GLThread::release(GLObjectType::VertexArray, _instancedVao);
+    GLThread::release(GLObjectType::VertexArray, _vao);
+    GLThread::release(GLObjectType::Buffer, _vbo);
+    GLThread::release(GLObjectType::Buffer, _ebo);
 }
 
-bool cbit::SkinnedMesh::loadFromFile(const std::string &filename) {
+bool cbit::SkinnedMesh::loadFromFile(const std::string &filename, std::vector<AnimationClip> *animations) {
+    const std::string cookedPath = AssetPaths::getCookedPath(filename, kCookedSkinnedMeshExtension);
+    if (AssetPaths::isCookedCurrent(filename, cookedPath) && loadCooked(cookedPath)) {
+        if (animations) {
+            // Clips are cooked to their own file; loadAllFromFile() only imports the source if that file is stale.
+            std::vector<AnimationClip> clips = AnimationClip::loadAllFromFile(filename);
+            animations->insert(animations->end(), std::make_move_iterator(clips.begin()),
+                               std::make_move_iterator(clips.end()));
+        }
+        return true;
+    }
+
+    const size_t firstClip = animations ? animations->size() : 0;
+    if (!_importFile(filename, animations)) {
+        return false;
+    }
+    if (_saveCooked(cookedPath)) {
+        Logger::log()->info("Cooked {} to {}", filename, cookedPath);
+    }
+    if (animations && animations->size() > firstClip) {
+        const std::vector<AnimationClip> clips(animations->begin() + static_cast<std::ptrdiff_t>(firstClip),
+                                               animations->end());
+        AnimationClip::saveCooked(AssetPaths::getCookedPath(filename, kCookedClipExtension), clips);
+    }
+    _initializeBuffers();
+    _loaded = true;
+    return true;
+}
+
+bool cbit::SkinnedMesh::cookFile(const std::string &filename, const std::string &cookedPath) {
+    return _importFile(filename, nullptr) && _saveCooked(cookedPath);
+}
+
+bool cbit::SkinnedMesh::loadCooked(const std::string &path) {
+    CookedMesh cooked;
+    if (!cooked.open(path, sizeof(SkinnedVertex))) {
+        return false;
+    }
+
+    const CookedMeshHeader &header = cooked.getHeader();
+    decltype(_vertices)().swap(_vertices);
+    decltype(_indices)().swap(_indices);
+    decltype(_positions)().swap(_positions);
+    decltype(_lodIndices)().swap(_lodIndices);
+    _lods = cooked.readLods();
+    _submeshes = cooked.readSubmeshes();
+    _nodes = cooked.readNodes();
+    cooked.readBones(_boneInfo, _boneMap);
+    _rootNodeIndex = header.rootNodeIndex;
+    _globalInverseTransform = glm::make_mat4(header.globalInverseTransform);
+    _boundsMin = glm::make_vec3(header.boundsMin);
+    _boundsMax = glm::make_vec3(header.boundsMax);
+
+    const unsigned int *cookedIndices = cooked.getIndices();
+    _uploadBuffers(cooked.getVertices(), header.vertexCount, cookedIndices, header.indexCount,
+                   cookedIndices + header.indexCount, header.lodIndexCount);
+
+    cooked.retainGeometry(_retention, _vertices, _positions, _indices);
+
+    Logger::log()->info("Loaded cooked skinned mesh {} ({} vertices, {} bones, {} levels of detail)", path,
+                        _vertexCount, _boneInfo.size(), getLodCount());
+    _loaded = true;
+    return true;
+}
+
+bool cbit::SkinnedMesh::_saveCooked(const std::string &path) const {
+    if (_vertices.empty() || _indices.empty()) {
+        return false;
+    }
+
+    CookedMeshSource source;
+    source.vertices = _vertices.data();
+    source.vertexStride = sizeof(SkinnedVertex);
+    source.vertexCount = _vertices.size();
+    source.indices = _indices.data();
+    source.indexCount = _indices.size();
+    source.lodIndices = _lodIndices.data();
+    source.lodIndexCount = _lodIndices.size();
+    source.lods = _lods;
+    source.boundsMin = _boundsMin;
+    source.boundsMax = _boundsMax;
+    source.submeshes = _submeshes;
+    source.nodes = _nodes;
+    source.bones = _boneInfo;
+    source.boneMap = _boneMap;
+    source.globalInverseTransform = _globalInverseTransform;
+    source.rootNodeIndex = _rootNodeIndex;
+    return CookedMesh::write(path, source);
+}
+
+bool cbit::SkinnedMesh::_importFile(const std::string &filename, std::vector<AnimationClip> *animations) {
     Assimp::Importer importer;
     const unsigned int flags = aiProcess_Triangulate
                                | aiProcess_JoinIdenticalVertices
@@ -60,57 +203,126 @@ bool cbit::SkinnedMesh::loadFromFile(const std::string &filename) {
         return false;
     }
 
-    if (scene->mNumMeshes > 1) {
-        Logger::log()->warn("Assimp model {} has {} meshes; loading first mesh only.", filename, scene->mNumMeshes);
-    }
-
     _vertices.clear();
     _indices.clear();
+    _positions.clear();
+    _lods.clear();
+    _submeshes.clear();
     _boneMap.clear();
     _boneInfo.clear();
     _nodes.clear();
     _rootNodeIndex = -1;
 
-    const aiMesh *mesh = scene->mMeshes[0];
-    _vertices.resize(mesh->mNumVertices);
+    size_t vertexCount = 0;
+    size_t indexCount = 0;
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        vertexCount += scene->mMeshes[i]->mNumVertices;
+        indexCount += scene->mMeshes[i]->mNumFaces * 3;
+    }
+    _vertices.reserve(vertexCount);
+    _indices.reserve(indexCount);
+    _submeshes.reserve(scene->mNumMeshes);
+
+    std::vector<glm::mat4> meshTransforms(scene->mNumMeshes, glm::mat4(1.0f));
+    if (scene->mRootNode) {
+        _globalInverseTransform = glm::inverse(toGlmMatrix(scene->mRootNode->mTransformation));
+        collectMeshTransforms(scene->mRootNode, glm::mat4(1.0f), meshTransforms);
+    }
+
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        // Skinned vertices are placed by the bone palette; static parts need their node transform baked in.
+        _appendSubmesh(*scene->mMeshes[i], _globalInverseTransform * meshTransforms[i], filename);
+    }
+
+    for (auto &vertex: _vertices) {
+        const float totalWeight = vertex.weights.x + vertex.weights.y + vertex.weights.z + vertex.weights.w;
+        if (totalWeight > 0.0f) {
+            vertex.weights /= totalWeight;
+        }
+    }
+
+    if (scene->mRootNode) {
+        _rootNodeIndex = _buildSkeletonNodes(scene->mRootNode, -1);
+        for (auto &node: _nodes) {
+            const auto boneIt = _boneMap.find(node.name);
+            node.boneIndex = boneIt != _boneMap.end() ? boneIt->second : -1;
+        }
+    }
 
     glm::vec3 minPos(FLT_MAX);
     glm::vec3 maxPos(-FLT_MAX);
+    for (const auto &vertex: _vertices) {
+        minPos = glm::min(minPos, vertex.position);
+        maxPos = glm::max(maxPos, vertex.position);
+    }
+    _boundsMin = minPos;
+    _boundsMax = maxPos;
+
+    Logger::log()->info("Skinned mesh {} submeshes={} bones={} bounds min=({}, {}, {}) max=({}, {}, {})",
+                        filename,
+                        _submeshes.size(),
+                        _boneInfo.size(),
+                        minPos.x, minPos.y, minPos.z,
+                        maxPos.x, maxPos.y, maxPos.z);
+
+    if (animations) {
+        AnimationClip::loadAllFromScene(*scene, *animations);
+    }
 
-    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+    _generateLods();
+    return true;
+}
+
+void cbit::SkinnedMesh::_appendSubmesh(const aiMesh &mesh,
+                                       const glm::mat4 &staticTransform,
+                                       const std::string &filename) {
+    const auto baseVertex = static_cast<unsigned int>(_vertices.size());
+    const bool skinned = mesh.HasBones();
+    const glm::mat3 normalTransform = glm::inverseTranspose(glm::mat3(staticTransform));
+
+    for (unsigned int i = 0; i < mesh.mNumVertices; ++i) {
         SkinnedVertex vertex{};
-        const auto &position = mesh->mVertices[i];
+        const auto &position = mesh.mVertices[i];
         vertex.position = glm::vec3(position.x, position.y, position.z);
 
-        if (mesh->HasNormals()) {
-            const auto &normal = mesh->mNormals[i];
+        if (mesh.HasNormals()) {
+            const auto &normal = mesh.mNormals[i];
             vertex.normal = glm::vec3(normal.x, normal.y, normal.z);
         }
 
-        if (mesh->HasTextureCoords(0)) {
-            const auto &uv = mesh->mTextureCoords[0][i];
+        if (mesh.HasTextureCoords(0)) {
+            const auto &uv = mesh.mTextureCoords[0][i];
             vertex.textureCoordinates = glm::vec2(uv.x, uv.y);
         }
 
-        _vertices[i] = vertex;
+        if (!skinned) {
+            vertex.position = glm::vec3(staticTransform * glm::vec4(vertex.position, 1.0f));
+            vertex.normal = glm::normalize(normalTransform * vertex.normal);
+        }
 
-        minPos = glm::min(minPos, vertex.position);
-        maxPos = glm::max(maxPos, vertex.position);
+        _vertices.push_back(vertex);
     }
 
-    _indices.reserve(mesh->mNumFaces * 3);
-    for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
-        const aiFace &face = mesh->mFaces[i];
+    SkinnedSubmesh submesh;
+    submesh.name = mesh.mName.C_Str();
+    submesh.indexOffset = static_cast<unsigned int>(_indices.size());
+    submesh.materialIndex = mesh.mMaterialIndex;
+
+    for (unsigned int i = 0; i < mesh.mNumFaces; ++i) {
+        const aiFace &face = mesh.mFaces[i];
         if (face.mNumIndices != 3) {
             continue;
         }
-        _indices.push_back(face.mIndices[0]);
-        _indices.push_back(face.mIndices[1]);
-        _indices.push_back(face.mIndices[2]);
+        _indices.push_back(baseVertex + face.mIndices[0]);
+        _indices.push_back(baseVertex + face.mIndices[1]);
+        _indices.push_back(baseVertex + face.mIndices[2]);
     }
 
-    for (unsigned int boneIndex = 0; boneIndex < mesh->mNumBones; ++boneIndex) {
-        const aiBone *bone = mesh->mBones[boneIndex];
+    submesh.indexCount = static_cast<unsigned int>(_indices.size()) - submesh.indexOffset;
+    _submeshes.push_back(std::move(submesh));
+
+    for (unsigned int boneIndex = 0; boneIndex < mesh.mNumBones; ++boneIndex) {
+        const aiBone *bone = mesh.mBones[boneIndex];
         const std::string boneName = bone->mName.C_Str();
 
         int boneId = 0;
@@ -132,55 +344,169 @@ bool cbit::SkinnedMesh::loadFromFile(const std::string &filename) {
 
         for (unsigned int weightIndex = 0; weightIndex < bone->mNumWeights; ++weightIndex) {
             const aiVertexWeight &weight = bone->mWeights[weightIndex];
-            if (weight.mVertexId < _vertices.size()) {
-                _setVertexBoneData(_vertices[weight.mVertexId], boneId, weight.mWeight);
+            const size_t vertexIndex = baseVertex + weight.mVertexId;
+            if (weight.mVertexId < mesh.mNumVertices && vertexIndex < _vertices.size()) {
+                _setVertexBoneData(_vertices[vertexIndex], boneId, weight.mWeight);
             }
         }
     }
+}
 
-    for (auto &vertex: _vertices) {
-        const float totalWeight = vertex.weights.x + vertex.weights.y + vertex.weights.z + vertex.weights.w;
-        if (totalWeight > 0.0f) {
-            vertex.weights /= totalWeight;
-        }
+void cbit::SkinnedMesh::draw() const {
+    getDrawCall().draw();
+}
+
+void cbit::SkinnedMesh::drawSubmesh(const size_t index) const {
+    if (!_loaded || index >= _submeshes.size()) return;
+    const auto &submesh = _submeshes[index];
+    MeshDrawCall drawCall = getDrawCall();
+    drawCall.count = static_cast<GLsizei>(submesh.indexCount);
+    drawCall.indexOffset = static_cast<GLsizei>(submesh.indexOffset);
+    drawCall.draw();
+}
+
+cbit::MeshDrawCall cbit::SkinnedMesh::getLodDrawCall(const int lod) const {
+    MeshDrawCall drawCall = getDrawCall();
+    if (lod > 0 && _lods.size() > 1) {
+        const MeshLod &level = _lods[std::min(static_cast<size_t>(lod), _lods.size() - 1)];
+        drawCall.indexOffset = static_cast<GLsizei>(level.indexOffset);
+        drawCall.count = static_cast<GLsizei>(level.indexCount);
     }
+    return drawCall;
+}
 
-    if (scene->mRootNode) {
-        _globalInverseTransform = glm::inverse(toGlmMatrix(scene->mRootNode->mTransformation));
-        _rootNodeIndex = _buildSkeletonNodes(scene->mRootNode);
+cbit::MeshDrawCall cbit::SkinnedMesh::getDrawCall() const {
+    MeshDrawCall drawCall;
+    if (_loaded) {
+        // Submesh ranges are contiguous, so the whole model is a single draw.
+        drawCall.vertexArray = _vao;
+        drawCall.count = static_cast<GLsizei>(_indexCount);
     }
+    return drawCall;
+}
 
-    Logger::log()->info("Skinned mesh {} bounds min=({}, {}, {}) max=({}, {}, {})",
-                        filename,
-                        minPos.x, minPos.y, minPos.z,
-                        maxPos.x, maxPos.y, maxPos.z);
+void cbit::SkinnedMesh::drawInstanced(const GLuint instanceBuffer, const GLsizei instanceCount) {
+    if (!_loaded || instanceCount <= 0) return;
 
-    _initializeBuffers();
-    _loaded = true;
-    return true;
-}
+    if (_instancedVao == 0 || _instancedVaoBuffer != instanceBuffer) {
+        if (_instancedVao == 0) {
+            glGenVertexArrays(1, &_instancedVao);
+        }
+        glBindVertexArray(_instancedVao);
+        glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ebo);
+        _setVertexAttributes();
+
+        glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+        for (int column = 0; column < 4; ++column) {
+            const GLuint location = 5 + column;
+            glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(SkinnedInstance),
+                                  reinterpret_cast<GLvoid *>(offsetof(SkinnedInstance, model) +
+                                                             sizeof(glm::vec4) * column));
+            glEnableVertexAttribArray(location);
+            glVertexAttribDivisor(location, 1);
+        }
+        glVertexAttribPointer(9, 4, GL_FLOAT, GL_FALSE, sizeof(SkinnedInstance),
+                              reinterpret_cast<GLvoid *>(offsetof(SkinnedInstance, animation)));
+        glEnableVertexAttribArray(9);
+        glVertexAttribDivisor(9, 1);
+        for (int column = 0; column < 3; ++column) {
+            const GLuint location = 10 + column;
+            glVertexAttribPointer(location, 3, GL_FLOAT, GL_FALSE, sizeof(SkinnedInstance),
+                                  reinterpret_cast<GLvoid *>(offsetof(SkinnedInstance, normalMatrix) +
+                                                             sizeof(glm::vec3) * column));
+            glEnableVertexAttribArray(location);
+            glVertexAttribDivisor(location, 1);
+        }
 
-void cbit::SkinnedMesh::draw() const {
-    if (!_loaded) return;
-    glBindVertexArray(_vao);
-    glDrawElements(GL_TRIANGLES, static_cast<int>(_indices.size()), GL_UNSIGNED_INT, nullptr);
+        _instancedVaoBuffer = instanceBuffer;
+    } else {
+        glBindVertexArray(_instancedVao);
+    }
+
+    gl::drawElementsInstanced(GL_TRIANGLES, static_cast<int>(_indexCount), GL_UNSIGNED_INT, nullptr,
+                              instanceCount);
     glBindVertexArray(0);
 }
 
 void cbit::SkinnedMesh::_initializeBuffers() {
-    glGenVertexArrays(1, &_vao);
-    glGenBuffers(1, &_vbo);
+    _uploadBuffers(_vertices.data(), _vertices.size(), _indices.data(), _indices.size(), _lodIndices.data(),
+                   _lodIndices.size());
+    decltype(_lodIndices)().swap(_lodIndices);
+    _applyRetention();
+}
 
-    glBindVertexArray(_vao);
-    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
-    glBufferData(GL_ARRAY_BUFFER, static_cast<int>(_vertices.size() * sizeof(SkinnedVertex)), _vertices.data(),
-                 GL_STATIC_DRAW);
+void cbit::SkinnedMesh::_uploadBuffers(const void *vertexData, const size_t vertexCount,
+                                       const unsigned int *indexData, const size_t indexCount,
+                                       const unsigned int *lodIndexData, const size_t lodIndexCount) {
+    const size_t vertexBytes = vertexCount * sizeof(SkinnedVertex);
+    const size_t indexBytes = indexCount * sizeof(unsigned int);
+    const size_t lodIndexBytes = lodIndexCount * sizeof(unsigned int);
+    MemoryTracker::trackGpu(MemoryCategory::Meshes, -_gpuBytes);
+    _gpuBytes = static_cast<std::int64_t>(vertexBytes + indexBytes + lodIndexBytes);
+    MemoryTracker::trackGpu(MemoryCategory::Meshes, _gpuBytes);
+
+    GLThread::run([&] {
+        glGenVertexArrays(1, &_vao);
+        glGenBuffers(1, &_vbo);
+
+        glBindVertexArray(_vao);
+        glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<int>(vertexBytes), vertexData, GL_STATIC_DRAW);
+
+        // Levels of detail follow the full index list in the same buffer.
+        glGenBuffers(1, &_ebo);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ebo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<int>(indexBytes + lodIndexBytes), nullptr, GL_STATIC_DRAW);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, static_cast<int>(indexBytes), indexData);
+        if (lodIndexBytes > 0) {
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, static_cast<int>(indexBytes), static_cast<int>(lodIndexBytes),
+                            lodIndexData);
+        }
+
+        _setVertexAttributes();
+
+        glBindVertexArray(0);
+    });
+
+    _vertexCount = vertexCount;
+    _indexCount = indexCount;
+}
 
-    glGenBuffers(1, &_ebo);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<int>(_indices.size() * sizeof(unsigned int)), _indices.data(),
-                 GL_STATIC_DRAW);
+void cbit::SkinnedMesh::_generateLods() {
+    decltype(_lodIndices)().swap(_lodIndices);
+
+    // Simplified in the bind pose; seams between submeshes are locked because their vertices share positions.
+    MeshSimplifier::buildLodChain(_vertices.empty() ? nullptr : &_vertices[0].position, _vertices.size(),
+                                  sizeof(SkinnedVertex), _indices.data(), _indices.size(), _lods, _lodIndices,
+                                  [this](const unsigned int from, const unsigned int to) {
+                                      return boneWeightDifference(_vertices[from], _vertices[to]) <=
+                                             kMaxBoneWeightDifference;
+                                  });
+    if (_lods.empty()) {
+        return;
+    }
+    Logger::log()->info("Generated {} skinned levels of detail: {} down to {} triangles", _lods.size() - 1,
+                        _lods.front().indexCount / 3, _lods.back().indexCount / 3);
+}
 
+void cbit::SkinnedMesh::_applyRetention() {
+    // Swapping with an empty vector frees the memory; clear() alone keeps the capacity.
+    if (_retention == GeometryRetention::KeepPositions) {
+        _positions.resize(_vertices.size());
+        std::transform(_vertices.begin(), _vertices.end(), _positions.begin(), [](const SkinnedVertex &vertex) {
+            return vertex.position;
+        });
+    }
+    if (_retention != GeometryRetention::KeepFull) {
+        decltype(_vertices)().swap(_vertices);
+    }
+    if (_retention == GeometryRetention::Discard) {
+        decltype(_indices)().swap(_indices);
+    }
+}
+
+void cbit::SkinnedMesh::_setVertexAttributes() const {
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(SkinnedVertex),
                           reinterpret_cast<GLvoid *>(offsetof(SkinnedVertex, position)));
     glEnableVertexAttribArray(0);
@@ -200,8 +526,6 @@ void cbit::SkinnedMesh::_initializeBuffers() {
     glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(SkinnedVertex),
                           reinterpret_cast<GLvoid *>(offsetof(SkinnedVertex, weights)));
     glEnableVertexAttribArray(4);
-
-    glBindVertexArray(0);
 }
 
 void cbit::SkinnedMesh::_setVertexBoneData(SkinnedVertex &vertex, const int boneId, const float weight) {
@@ -217,16 +541,25 @@ void cbit::SkinnedMesh::_setVertexBoneData(SkinnedVertex &vertex, const int bone
     }
 }
 
-int cbit::SkinnedMesh::_buildSkeletonNodes(const aiNode *node) {
+int cbit::SkinnedMesh::_buildSkeletonNodes(const aiNode *node, const int parentIndex) {
     SkeletonNode newNode;
     newNode.name = node->mName.C_Str();
     newNode.transform = toGlmMatrix(node->mTransformation);
+    newNode.parent = parentIndex;
+
+    aiVector3D scaling;
+    aiQuaternion rotation;
+    aiVector3D position;
+    node->mTransformation.Decompose(scaling, rotation, position);
+    newNode.bindTranslation = glm::vec3(position.x, position.y, position.z);
+    newNode.bindRotation = glm::quat(rotation.w, rotation.x, rotation.y, rotation.z);
+    newNode.bindScale = glm::vec3(scaling.x, scaling.y, scaling.z);
     const int nodeIndex = static_cast<int>(_nodes.size());
     _nodes.push_back(std::move(newNode));
     _nodes[nodeIndex].children.reserve(node->mNumChildren);
 
     for (unsigned int i = 0; i < node->mNumChildren; ++i) {
-        int childIndex = _buildSkeletonNodes(node->mChildren[i]);
+        int childIndex = _buildSkeletonNodes(node->mChildren[i], nodeIndex);
         _nodes[nodeIndex].children.push_back(childIndex);
     }
 
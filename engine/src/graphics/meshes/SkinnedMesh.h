@@ -13,8 +13,10 @@
 #include <unordered_map>
 #include <vector>
 #include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
 #include <assimp/scene.h>
 #include "OpenGLInclude.h"
+#include "graphics/meshes/Mesh.h"
 
 namespace cbit {
     constexpr int kMaxBoneInfluences = 4;
@@ -28,13 +30,46 @@ namespace cbit {
         glm::vec4 weights{0.0f};
     };
 
+    /**
+     * @struct SkinnedInstance
+     * @brief  Per-instance data for the baked-animation instanced draw path.
+     */
+    struct SkinnedInstance {
+        glm::mat4 model{1.0f};
+        glm::mat3 normalMatrix{1.0f}; // Inverse transpose of the model's upper 3x3, so the shader needs no inverse.
+        glm::vec4 animation{0.0f}; // x = baked clip id, y = playback time in seconds.
+    };
+
     struct BoneInfo {
         glm::mat4 offset{1.0f};
     };
 
+    class AnimationClip;
+
+    /**
+     * @struct SkinnedSubmesh
+     * @brief  Draw range of one imported mesh inside the shared vertex and index buffers.
+     */
+    struct SkinnedSubmesh {
+        std::string name;
+        unsigned int indexOffset = 0;
+        unsigned int indexCount = 0;
+        unsigned int materialIndex = 0;
+    };
+
+    /**
+     * @struct SkeletonNode
+     * @brief Node of the skeleton hierarchy.
+     * @details Nodes are stored depth-first, so a parent always precedes its children in the node array.
+     */
     struct SkeletonNode {
         std::string name;
         glm::mat4 transform{1.0f};
+        glm::vec3 bindTranslation{0.0f};
+        glm::quat bindRotation{1.0f, 0.0f, 0.0f, 0.0f};
+        glm::vec3 bindScale{1.0f};
+        int parent = -1;
+        int boneIndex = -1;
         std::vector<int> children;
     };
 
@@ -50,41 +85,144 @@ namespace cbit {
         /**
          * @brief   Loads a model file supported by Assimp (e.g., FBX) with skinning data.
          * @param   filename
+         * @param   animations Optional; receives every animation clip of the file from the same import.
          * @return  true if the model was loaded successfully.
+         * @details Every mesh of the file is loaded into one vertex and index buffer with a per-submesh draw range.
+         *          All submeshes share the skeleton and bone palette. Meshes without bone weights are baked into
+         *          model space with the transform of the node they are attached to.
+         *
+         *          The cooked copy of the file is loaded when it is not older than the source; otherwise the source
+         *          is imported and cooked. Animation clips are cooked to a separate .cbanim file.
+         */
+        bool loadFromFile(const std::string &filename, std::vector<AnimationClip> *animations = nullptr);
+
+        /**
+         * @brief   Loads a cooked mesh file, uploading its vertex and index data straight from the mapped file.
+         * @param   path
+         * @return  true if the file exists and is a valid cooked skinned mesh.
          */
-        bool loadFromFile(const std::string &filename);
+        bool loadCooked(const std::string &path);
 
         /**
-         * @brief   Renders the skinned mesh using OpenGL.
+         * @brief   Imports a model file and writes its cooked copy without creating GPU buffers.
+         * @param   filename Source model, as accepted by loadFromFile().
+         * @param   cookedPath Destination of the cooked file.
+         * @return  true if the model was imported and written.
+         */
+        bool cookFile(const std::string &filename, const std::string &cookedPath);
+
+        /**
+         * @brief   Renders every submesh of the skinned mesh with a single draw call.
          */
         void draw() const;
 
+        /**
+         * @brief   Renders a single submesh, e.g. when submeshes use different materials.
+         * @param   index Index into getSubmeshes().
+         */
+        void drawSubmesh(size_t index) const;
+
+        /**
+         * @brief   Describes the draw call covering every submesh.
+         * @return  Vertex array and index range; invalid if the mesh is not loaded.
+         */
+        [[nodiscard]] MeshDrawCall getDrawCall() const;
+
+        /**
+         * @brief   Describes the draw call of one level of detail covering every submesh.
+         * @param   lod Level; 0 is the full mesh. Clamped to the levels the mesh has.
+         */
+        [[nodiscard]] MeshDrawCall getLodDrawCall(int lod) const;
+
+        [[nodiscard]] int getLodCount() const { return _lods.empty() ? 1 : static_cast<int>(_lods.size()); }
+
+        /**
+         * @brief   Renders several copies of the mesh in one draw call.
+         * @param   instanceBuffer Vertex buffer holding instanceCount SkinnedInstance records.
+         * @param   instanceCount Number of instances to draw.
+         * @details The instance attributes occupy locations 5-9 of a separate vertex array, so the regular
+         *          draw path is unaffected.
+         */
+        void drawInstanced(GLuint instanceBuffer, GLsizei instanceCount);
+
+        /**
+         * @brief   Sets what the mesh keeps in CPU memory after upload. Applies to the next load.
+         * @param   retention CPU geometry to keep; KeepPositions keeps bind-pose positions and indices.
+         */
+        void setGeometryRetention(const GeometryRetention retention) { _retention = retention; }
+
+        [[nodiscard]] GeometryRetention getGeometryRetention() const { return _retention; }
+
+        /**
+         * @brief   Vertices kept with GeometryRetention::KeepFull; empty otherwise.
+         */
+        [[nodiscard]] const TrackedVector<SkinnedVertex, MemoryCategory::Meshes> &getVertices() const {
+            return _vertices;
+        }
+
+        /**
+         * @brief   Bind-pose positions kept with GeometryRetention::KeepPositions; empty otherwise.
+         */
+        [[nodiscard]] const TrackedVector<glm::vec3, MemoryCategory::Meshes> &getPositions() const {
+            return _positions;
+        }
+
+        /**
+         * @brief   Indices kept with GeometryRetention::KeepFull or KeepPositions; empty otherwise.
+         */
+        [[nodiscard]] const TrackedVector<unsigned int, MemoryCategory::Meshes> &getIndices() const {
+            return _indices;
+        }
+
         [[nodiscard]] const std::unordered_map<std::string, int> &getBoneMap() const { return _boneMap; }
         [[nodiscard]] const std::vector<BoneInfo> &getBoneInfo() const { return _boneInfo; }
         [[nodiscard]] const std::vector<SkeletonNode> &getSkeletonNodes() const { return _nodes; }
         [[nodiscard]] int getRootNodeIndex() const { return _rootNodeIndex; }
         [[nodiscard]] const glm::mat4 &getGlobalInverseTransform() const { return _globalInverseTransform; }
         [[nodiscard]] size_t getBoneCount() const { return _boneInfo.size(); }
-        [[nodiscard]] size_t getVertexCount() const { return _vertices.size(); }
-        [[nodiscard]] size_t getIndexCount() const { return _indices.size(); }
+        [[nodiscard]] size_t getVertexCount() const { return _vertexCount; }
+        [[nodiscard]] size_t getIndexCount() const { return _indexCount; }
+        [[nodiscard]] const std::vector<SkinnedSubmesh> &getSubmeshes() const { return _submeshes; }
+        [[nodiscard]] const glm::vec3 &getBoundsMin() const { return _boundsMin; }
+        [[nodiscard]] const glm::vec3 &getBoundsMax() const { return _boundsMax; }
 
     private:
+        bool _importFile(const std::string &filename, std::vector<AnimationClip> *animations);
+        bool _saveCooked(const std::string &path) const;
         void _initializeBuffers();
+        void _uploadBuffers(const void *vertexData, size_t vertexCount, const unsigned int *indexData,
+                            size_t indexCount, const unsigned int *lodIndexData, size_t lodIndexCount);
+        void _applyRetention();
+        void _generateLods();
+        void _setVertexAttributes() const;
+        void _appendSubmesh(const aiMesh &mesh, const glm::mat4 &staticTransform, const std::string &filename);
         void _setVertexBoneData(SkinnedVertex &vertex, int boneId, float weight);
-        int _buildSkeletonNodes(const aiNode *node);
+        int _buildSkeletonNodes(const aiNode *node, int parentIndex);
 
-        std::vector<SkinnedVertex> _vertices;
-        std::vector<unsigned int> _indices;
+        TrackedVector<SkinnedVertex, MemoryCategory::Meshes> _vertices;
+        TrackedVector<unsigned int, MemoryCategory::Meshes> _indices;
+        TrackedVector<glm::vec3, MemoryCategory::Meshes> _positions;
+        TrackedVector<unsigned int, MemoryCategory::Meshes> _lodIndices; // Levels 1+; freed once uploaded.
+        std::vector<MeshLod> _lods; // Level 0 first; empty when the mesh has no generated levels.
+        size_t _vertexCount = 0; // Counts of the uploaded buffers; the CPU copies may be gone.
+        size_t _indexCount = 0;
+        GeometryRetention _retention = GeometryRetention::Discard;
+        std::vector<SkinnedSubmesh> _submeshes;
         std::unordered_map<std::string, int> _boneMap;
         std::vector<BoneInfo> _boneInfo;
         std::vector<SkeletonNode> _nodes;
         glm::mat4 _globalInverseTransform{1.0f};
         int _rootNodeIndex = -1;
+        glm::vec3 _boundsMin{0.0f};
+        glm::vec3 _boundsMax{0.0f};
 
         bool _loaded = false;
         GLuint _vao = 0;
         GLuint _vbo = 0;
         GLuint _ebo = 0;
+        GLuint _instancedVao = 0;
+        GLuint _instancedVaoBuffer = 0;
+        std::int64_t _gpuBytes = 0;
     };
 }
 
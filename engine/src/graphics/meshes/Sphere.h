@@ -22,7 +22,9 @@ namespace cbit {
     public:
         // Create a sphere of a given radius, subdivided into
         // "stacks" rows (latitude) and "slices" columns (longitude).
-        explicit Sphere(float radius = 1.0f, int stacks = 16, int slices = 32);
+        // "retention" selects the CPU geometry kept after upload.
+        explicit Sphere(float radius = 1.0f, int stacks = 16, int slices = 32,
+                        GeometryRetention retention = GeometryRetention::Discard);
 
         ~Sphere() override;
     };
@@ -0,0 +1,173 @@
+/**
+ * @file    CookedTexture.cpp
+ * @brief   Implementation of the CookedTexture class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "CookedTexture.h"
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <vector>
+#include <stb_image.h>
+#include "utilities/AtomicFile.h"
+#include "utilities/Logger.h"
+
+namespace {
+    constexpr std::uint64_t kSectionAlignment = 16;
+
+    // A 2^31 texel wide image has 32 levels; anything above that means the file is corrupt.
+    constexpr std::uint32_t kMaxLevels = 32;
+
+    struct Image {
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        std::vector<unsigned char> pixels;
+    };
+
+    std::uint64_t alignSection(const std::uint64_t size) {
+        return (size + kSectionAlignment - 1) / kSectionAlignment * kSectionAlignment;
+    }
+
+    Image downsample(const Image &source, const std::uint32_t channels) {
+        Image level;
+        level.width = std::max(1u, source.width / 2);
+        level.height = std::max(1u, source.height / 2);
+        level.pixels.resize(static_cast<size_t>(level.width) * level.height * channels);
+
+        const auto texel = [&source, channels](const std::uint32_t x, const std::uint32_t y, const std::uint32_t c) {
+            const std::uint32_t clampedX = std::min(x, source.width - 1);
+            const std::uint32_t clampedY = std::min(y, source.height - 1);
+            return static_cast<unsigned int>(
+                source.pixels[(static_cast<size_t>(clampedY) * source.width + clampedX) * channels + c]);
+        };
+        for (std::uint32_t y = 0; y < level.height; ++y) {
+            for (std::uint32_t x = 0; x < level.width; ++x) {
+                for (std::uint32_t c = 0; c < channels; ++c) {
+                    const unsigned int sum = texel(2 * x, 2 * y, c) + texel(2 * x + 1, 2 * y, c) +
+                                             texel(2 * x, 2 * y + 1, c) + texel(2 * x + 1, 2 * y + 1, c);
+                    level.pixels[(static_cast<size_t>(y) * level.width + x) * channels + c] =
+                            static_cast<unsigned char>((sum + 2) / 4);
+                }
+            }
+        }
+        return level;
+    }
+}
+
+bool cbit::CookedTexture::cook(const std::string &sourcePath, const std::string &cookedPath) {
+    int width = 0;
+    int height = 0;
+    int sourceChannels = 0;
+    if (!stbi_info(sourcePath.c_str(), &width, &height, &sourceChannels)) {
+        Logger::log()->error("Failed to load texture at path: {}", sourcePath);
+        return false;
+    }
+    const int channels = sourceChannels == 2 || sourceChannels == 4 ? 4 : 3;
+
+    // Flipped on decode so level 0 is already in the row order glTexImage2D expects.
+    stbi_set_flip_vertically_on_load(1);
+    unsigned char *data = stbi_load(sourcePath.c_str(), &width, &height, &sourceChannels, channels);
+    if (!data) {
+        Logger::log()->error("Failed to load texture at path: {}", sourcePath);
+        return false;
+    }
+
+    std::vector<Image> levels(1);
+    levels[0].width = static_cast<std::uint32_t>(width);
+    levels[0].height = static_cast<std::uint32_t>(height);
+    levels[0].pixels.assign(data, data + static_cast<size_t>(width) * height * channels);
+    stbi_image_free(data);
+    while (levels.back().width > 1 || levels.back().height > 1) {
+        levels.push_back(downsample(levels.back(), static_cast<std::uint32_t>(channels)));
+    }
+
+    CookedTextureHeader header{};
+    std::memcpy(header.magic, kCookedTextureMagic, sizeof(kCookedTextureMagic));
+    header.version = kCookedTextureVersion;
+    header.width = levels[0].width;
+    header.height = levels[0].height;
+    header.channels = static_cast<std::uint32_t>(channels);
+    header.levelCount = static_cast<std::uint32_t>(levels.size());
+
+    // Offsets are aligned, so every level starts on a 16-byte boundary of the mapping.
+    std::vector<CookedTextureLevel> records;
+    std::uint64_t offset = alignSection(sizeof(CookedTextureHeader) + levels.size() * sizeof(CookedTextureLevel));
+    for (const Image &level: levels) {
+        records.push_back({level.width, level.height, offset, level.pixels.size()});
+        offset += alignSection(level.pixels.size());
+    }
+
+    return writeFileAtomically(cookedPath, [&](std::ostream &file) {
+        constexpr char kPadding[kSectionAlignment] = {};
+        const std::uint64_t tableSize = sizeof(header) + records.size() * sizeof(CookedTextureLevel);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(records.data()),
+                   static_cast<std::streamsize>(records.size() * sizeof(CookedTextureLevel)));
+        file.write(kPadding, static_cast<std::streamsize>(alignSection(tableSize) - tableSize));
+        for (const Image &level: levels) {
+            file.write(reinterpret_cast<const char *>(level.pixels.data()),
+                       static_cast<std::streamsize>(level.pixels.size()));
+            file.write(kPadding,
+                       static_cast<std::streamsize>(alignSection(level.pixels.size()) - level.pixels.size()));
+        }
+        return static_cast<bool>(file);
+    });
+}
+
+bool cbit::CookedTexture::open(const std::string &path) {
+    _header = {};
+    if (!_file.open(path)) {
+        return false;
+    }
+
+    if (_file.size() >= sizeof(CookedTextureHeader)) {
+        std::memcpy(&_header, _file.data(), sizeof(CookedTextureHeader));
+    }
+    if (!_validate()) {
+        Logger::log()->error("{} is not a version {} cooked texture", path, kCookedTextureVersion);
+        _file.close();
+        _header = {};
+        return false;
+    }
+    return true;
+}
+
+cbit::CookedTextureLevel cbit::CookedTexture::getLevel(const std::uint32_t level) const {
+    CookedTextureLevel record{};
+    std::memcpy(&record, _file.data() + sizeof(CookedTextureHeader) + level * sizeof(CookedTextureLevel),
+                sizeof(CookedTextureLevel));
+    return record;
+}
+
+const unsigned char *cbit::CookedTexture::getPixels(const std::uint32_t level) const {
+    return reinterpret_cast<const unsigned char *>(_file.data() + getLevel(level).offset);
+}
+
+bool cbit::CookedTexture::_validate() const {
+    if (std::memcmp(_header.magic, kCookedTextureMagic, sizeof(kCookedTextureMagic)) != 0 ||
+        _header.version != kCookedTextureVersion || (_header.channels != 3 && _header.channels != 4) ||
+        _header.width == 0 || _header.height == 0 || _header.levelCount == 0 || _header.levelCount > kMaxLevels) {
+        return false;
+    }
+    if (sizeof(CookedTextureHeader) + _header.levelCount * sizeof(CookedTextureLevel) > _file.size()) {
+        return false;
+    }
+
+    std::uint32_t width = _header.width;
+    std::uint32_t height = _header.height;
+    for (std::uint32_t i = 0; i < _header.levelCount; ++i) {
+        const CookedTextureLevel level = getLevel(i);
+        const std::uint64_t expectedSize = static_cast<std::uint64_t>(width) * height * _header.channels;
+        if (level.width != width || level.height != height || level.size != expectedSize ||
+            level.offset % kSectionAlignment != 0 || level.offset > _file.size() ||
+            level.size > _file.size() - level.offset) {
+            return false;
+        }
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+    }
+    return true;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file    CookedTexture.h
+ * @brief   Header file for the CookedTexture class.
+ * @details Engine-native texture format. Images are decoded once when cooked and stored with their full mip chain,
+ *          so loading a cooked texture maps the file and uploads every level without decoding or glGenerateMipmap.
+ *
+ *          Layout, in host byte order: a CookedTextureHeader, a CookedTextureLevel per mip level, then the level
+ *          pixels, each level aligned to 16 bytes. Pixels are 8-bit RGB or RGBA, tightly packed, with the bottom row
+ *          first as OpenGL expects.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_COOKEDTEXTURE_H
+#define CBIT_COOKEDTEXTURE_H
+
+#include <cstdint>
+#include <string>
+#include "utilities/MappedFile.h"
+
+namespace cbit {
+    constexpr char kCookedTextureMagic[4] = {'C', 'B', 'T', 'X'};
+    constexpr std::uint32_t kCookedTextureVersion = 1;
+    constexpr const char *kCookedTextureExtension = ".cbtex";
+
+    /**
+     * @struct CookedTextureHeader
+     * @brief  Start of a cooked texture file; followed by levelCount CookedTextureLevel records.
+     */
+    struct CookedTextureHeader {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t width;
+        std::uint32_t height;
+        std::uint32_t channels; // 3 or 4.
+        std::uint32_t levelCount;
+    };
+
+    /**
+     * @struct CookedTextureLevel
+     * @brief  One mip level. The offset is in bytes from the start of the file.
+     */
+    struct CookedTextureLevel {
+        std::uint32_t width;
+        std::uint32_t height;
+        std::uint64_t offset;
+        std::uint64_t size;
+    };
+
+    /**
+     * @class   CookedTexture
+     * @brief   Reader and writer of cooked texture files.
+     * @details A CookedTexture maps its file on open(); the pointers it returns stay valid until it is destroyed.
+     */
+    class CookedTexture {
+    public:
+        /**
+         * Decode an image, build its mip chain and write it to a cooked texture file.
+         * @param sourcePath Image in a format stb_image reads.
+         * @param cookedPath Destination path; missing directories are created.
+         * @return true if the file was written.
+         * @details Grey images are expanded to RGB and grey-alpha images to RGBA. Each level is a 2x2 box filter of
+         *          the one above it.
+         */
+        static bool cook(const std::string &sourcePath, const std::string &cookedPath);
+
+        /**
+         * Map and validate a cooked texture file.
+         * @param path Path to the file.
+         * @return true if the file is a valid cooked texture of the current version.
+         */
+        bool open(const std::string &path);
+
+        [[nodiscard]] const CookedTextureHeader &getHeader() const { return _header; }
+
+        /**
+         * Get a mip level; level must be less than getHeader().levelCount.
+         */
+        [[nodiscard]] CookedTextureLevel getLevel(std::uint32_t level) const;
+
+        /**
+         * Get the pixels of a mip level, bottom row first.
+         */
+        [[nodiscard]] const unsigned char *getPixels(std::uint32_t level) const;
+
+    private:
+        [[nodiscard]] bool _validate() const;
+
+        MappedFile _file;
+        CookedTextureHeader _header{};
+    };
+}
+
+#endif //CBIT_COOKEDTEXTURE_H
@@ -0,0 +1,80 @@
+/**
+ * @file    GLCalls.h
+ * @brief   Counted wrappers around the GL calls issued while drawing.
+ * @details Draw calls, program binds, texture binds and uniform uploads go through these functions so RenderStats
+ *          can attribute them to the current render pass. Resource creation and uploads call GL directly.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_GLCALLS_H
+#define CBIT_GLCALLS_H
+
+#include "OpenGLInclude.h"
+#include "RenderStats.h"
+
+namespace cbit::gl {
+    inline void useProgram(const GLuint program) {
+        RenderStats::countProgramBind();
+        glUseProgram(program);
+    }
+
+    inline void bindTexture(const GLenum target, const GLuint texture) {
+        RenderStats::countTextureBind();
+        glBindTexture(target, texture);
+    }
+
+    inline void drawArrays(const GLenum mode, const GLint first, const GLsizei count) {
+        RenderStats::countDraw(mode, count);
+        glDrawArrays(mode, first, count);
+    }
+
+    inline void drawElements(const GLenum mode, const GLsizei count, const GLenum type, const void *indices) {
+        RenderStats::countDraw(mode, count);
+        glDrawElements(mode, count, type, indices);
+    }
+
+    inline void drawElementsInstanced(const GLenum mode, const GLsizei count, const GLenum type, const void *indices,
+                                      const GLsizei instanceCount) {
+        RenderStats::countDraw(mode, count, instanceCount);
+        glDrawElementsInstanced(mode, count, type, indices, instanceCount);
+    }
+
+    inline void uniform1i(const GLint location, const GLint value) {
+        RenderStats::countUniformUpload();
+        glUniform1i(location, value);
+    }
+
+    inline void uniform1f(const GLint location, const GLfloat value) {
+        RenderStats::countUniformUpload();
+        glUniform1f(location, value);
+    }
+
+    inline void uniform2f(const GLint location, const GLfloat x, const GLfloat y) {
+        RenderStats::countUniformUpload();
+        glUniform2f(location, x, y);
+    }
+
+    inline void uniform3f(const GLint location, const GLfloat x, const GLfloat y, const GLfloat z) {
+        RenderStats::countUniformUpload();
+        glUniform3f(location, x, y, z);
+    }
+
+    inline void uniform4f(const GLint location, const GLfloat x, const GLfloat y, const GLfloat z, const GLfloat w) {
+        RenderStats::countUniformUpload();
+        glUniform4f(location, x, y, z, w);
+    }
+
+    inline void uniform4fv(const GLint location, const GLsizei count, const GLfloat *values) {
+        RenderStats::countUniformUpload();
+        glUniform4fv(location, count, values);
+    }
+
+    inline void uniformMatrix4fv(const GLint location, const GLsizei count, const GLboolean transpose,
+                                 const GLfloat *values) {
+        RenderStats::countUniformUpload();
+        glUniformMatrix4fv(location, count, transpose, values);
+    }
+}
+
+#endif //CBIT_GLCALLS_H
@@ -0,0 +1,152 @@
+/**
+ * @file    GLThread.cpp
+ * @brief   Implementation of the GLThread class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "GLThread.h"
+
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "core/Profiler.h"
+
+namespace {
+    struct PendingWork {
+        const std::function<void()> *function;
+        std::promise<void> *finished;
+    };
+
+    struct PendingRelease {
+        cbit::GLObjectType type;
+        GLuint handle;
+        std::uint64_t frame; // Published frame count at release time.
+    };
+
+    std::atomic<std::thread::id> sOwner{};
+    std::atomic<std::uint64_t> sPublishedFrames{0};
+    std::atomic<std::uint64_t> sSubmittedFrames{0};
+
+    std::mutex sMutex;
+    std::vector<PendingWork> sWork;
+    std::vector<PendingRelease> sReleases;
+    std::function<void()> sWake;
+
+    void deleteObject(const cbit::GLObjectType type, const GLuint handle) {
+        switch (type) {
+            case cbit::GLObjectType::Buffer:
+                glDeleteBuffers(1, &handle);
+                break;
+            case cbit::GLObjectType::VertexArray:
+                glDeleteVertexArrays(1, &handle);
+                break;
+            case cbit::GLObjectType::Texture:
+                glDeleteTextures(1, &handle);
+                break;
+            case cbit::GLObjectType::Program:
+                glDeleteProgram(handle);
+                break;
+        }
+    }
+}
+
+void cbit::GLThread::makeCurrent() {
+    sOwner.store(std::this_thread::get_id());
+}
+
+bool cbit::GLThread::isCurrent() {
+    const std::thread::id owner = sOwner.load();
+    return owner == std::thread::id{} || owner == std::this_thread::get_id();
+}
+
+void cbit::GLThread::run(const std::function<void()> &function) {
+    if (isCurrent()) {
+        function();
+        return;
+    }
+
+    std::promise<void> finished;
+    std::future<void> done = finished.get_future();
+    std::function<void()> wake;
+    {
+        std::lock_guard lock(sMutex);
+        sWork.push_back({&function, &finished});
+        wake = sWake;
+    }
+    if (wake) {
+        wake();
+    }
+    done.get();
+}
+
+void cbit::GLThread::release(const GLObjectType type, const GLuint handle) {
+    if (handle == 0) {
+        return;
+    }
+
+    const std::uint64_t published = sPublishedFrames.load();
+    if (isCurrent() && sSubmittedFrames.load() >= published) {
+        deleteObject(type, handle);
+        return;
+    }
+
+    std::lock_guard lock(sMutex);
+    sReleases.push_back({type, handle, published});
+}
+
+void cbit::GLThread::framePublished() {
+    sPublishedFrames.fetch_add(1);
+}
+
+void cbit::GLThread::frameSubmitted() {
+    sSubmittedFrames.fetch_add(1);
+}
+
+bool cbit::GLThread::hasPendingWork() {
+    std::lock_guard lock(sMutex);
+    return !sWork.empty();
+}
+
+void cbit::GLThread::executePending() {
+    CBIT_PROFILE_SCOPE("GLThread::executePending");
+    std::vector<PendingWork> work;
+    std::vector<PendingRelease> releases;
+    {
+        std::lock_guard lock(sMutex);
+        work.swap(sWork);
+
+        // Only objects released before the last submitted frame was published are unreferenced.
+        const std::uint64_t submitted = sSubmittedFrames.load();
+        auto kept = sReleases.begin();
+        for (auto &release: sReleases) {
+            if (release.frame <= submitted) {
+                releases.push_back(release);
+            } else {
+                *kept++ = release;
+            }
+        }
+        sReleases.erase(kept, sReleases.end());
+    }
+
+    for (const auto &item: work) {
+        try {
+            (*item.function)();
+            item.finished->set_value();
+        } catch (...) {
+            item.finished->set_exception(std::current_exception());
+        }
+    }
+
+    for (const auto &release: releases) {
+        deleteObject(release.type, release.handle);
+    }
+}
+
+void cbit::GLThread::setWakeCallback(std::function<void()> wake) {
+    std::lock_guard lock(sMutex);
+    sWake = std::move(wake);
+}
@@ -0,0 +1,91 @@
+/**
+ * @file    GLThread.h
+ * @brief   Header file for the GLThread class.
+ * @details Tracks which thread owns the OpenGL context. Resource classes (meshes, shaders, baked animations) create
+ *          their GL objects through run() and release them through release(), so they can be loaded and destroyed
+ *          from the simulation thread while a RenderThread owns the context.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_GLTHREAD_H
+#define CBIT_GLTHREAD_H
+
+#include <functional>
+#include "OpenGLInclude.h"
+
+namespace cbit {
+    /**
+     * @enum  GLObjectType
+     * @brief Kind of GL object passed to GLThread::release().
+     */
+    enum class GLObjectType {
+        Buffer,
+        VertexArray,
+        Texture,
+        Program
+    };
+
+    /**
+     * @class GLThread
+     * @brief Static access to the thread that owns the OpenGL context.
+     * @details Deleting a GL object is deferred until every render snapshot published before the release has been
+     *          submitted, because those snapshots may still reference the object by name. Frames are counted with
+     *          framePublished() on the simulation side and frameSubmitted() on the GL side.
+     */
+    class GLThread {
+    public:
+        /**
+         * Make the calling thread the owner of the GL context. The context must be current on it.
+         */
+        static void makeCurrent();
+
+        /**
+         * Check whether the calling thread owns the GL context.
+         * @return true on the owning thread, or on any thread before an owner was set.
+         */
+        static bool isCurrent();
+
+        /**
+         * Run GL work on the context thread and wait for it to finish.
+         * @param function Work to run; runs inline when called from the context thread.
+         */
+        static void run(const std::function<void()> &function);
+
+        /**
+         * Delete a GL object once no in-flight frame can reference it.
+         * @param type Kind of object.
+         * @param handle Object name; 0 is ignored.
+         */
+        static void release(GLObjectType type, GLuint handle);
+
+        /**
+         * Record that a snapshot was handed to the renderer. Called on the simulation thread.
+         */
+        static void framePublished();
+
+        /**
+         * Record that the oldest published snapshot has been submitted. Called on the context thread.
+         */
+        static void frameSubmitted();
+
+        /**
+         * Check whether work posted with run() is waiting for the context thread.
+         * @return true if executePending() has work to do.
+         */
+        static bool hasPendingWork();
+
+        /**
+         * Run posted work and delete released objects that are no longer referenced. Called on the context thread.
+         */
+        static void executePending();
+
+        /**
+         * Set the callback used to wake the context thread when work is posted.
+         * @param wake Callback, or nullptr to remove it.
+         */
+        static void setWakeCallback(std::function<void()> wake);
+    };
+}
+
+#endif //CBIT_GLTHREAD_H
@@ -0,0 +1,173 @@
+/**
+ * @file    GlyphAtlas.cpp
+ * @brief   Implementation of the GlyphAtlas class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "GlyphAtlas.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <utility>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include "utilities/AssetPaths.h"
+#include "utilities/AtomicFile.h"
+#include "utilities/Logger.h"
+
+namespace {
+    constexpr char kCookedFontMagic[4] = {'C', 'B', 'F', 'N'};
+    constexpr std::uint32_t kCookedFontVersion = 1;
+
+    constexpr std::uint32_t kGlyphCount = 128;
+    constexpr std::uint32_t kMaxAtlasSize = 4096;
+
+    // Empty texels around each glyph, so linear filtering never blends in a neighbour.
+    constexpr std::uint32_t kGlyphPadding = 1;
+
+    template<typename T>
+    void writeValue(std::ostream &file, const T &value) {
+        file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool readValue(std::ifstream &file, T &value) {
+        return static_cast<bool>(file.read(reinterpret_cast<char *>(&value), sizeof(T)));
+    }
+
+    std::uint32_t nextPowerOfTwo(const std::uint32_t value) {
+        std::uint32_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+}
+
+std::string cbit::GlyphAtlas::getCookedPath(const std::string &fontPath, const unsigned int fontSize) {
+    return AssetPaths::getCookedPath(fontPath, "." + std::to_string(fontSize) + kCookedFontExtension);
+}
+
+bool cbit::GlyphAtlas::rasterize(const std::string &fontPath, const unsigned int fontSize) {
+    FT_Library ft;
+    if (FT_Init_FreeType(&ft)) {
+        Logger::log()->error("Could not initialize FreeType Library");
+        return false;
+    }
+    FT_Face face;
+    if (FT_New_Face(ft, fontPath.c_str(), 0, &face)) {
+        Logger::log()->error("Failed to load font: {}", fontPath);
+        FT_Done_FreeType(ft);
+        return false;
+    }
+    FT_Set_Pixel_Sizes(face, 0, fontSize);
+
+    // Sixteen glyph cells per row fit the ASCII set in a roughly square atlas.
+    _width = std::min(kMaxAtlasSize, nextPowerOfTwo(16 * (fontSize + 2 * kGlyphPadding)));
+    _height = 0;
+    _pixels.clear();
+    _glyphs.clear();
+
+    // Glyphs are packed left to right into shelves as tall as the tallest glyph on them.
+    std::uint32_t shelfX = 0;
+    std::uint32_t shelfY = 0;
+    std::uint32_t shelfHeight = 0;
+    for (std::uint32_t c = 0; c < kGlyphCount; ++c) {
+        if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
+            Logger::log()->error("Failed to load Glyph: {}", c);
+            continue;
+        }
+        const FT_Bitmap &bitmap = face->glyph->bitmap;
+        const std::uint32_t cellWidth = bitmap.width + 2 * kGlyphPadding;
+        const std::uint32_t cellHeight = bitmap.rows + 2 * kGlyphPadding;
+        if (cellWidth > _width) {
+            Logger::log()->error("Glyph {} of {} is wider than the glyph atlas", c, fontPath);
+            continue;
+        }
+        if (shelfX + cellWidth > _width) {
+            shelfX = 0;
+            shelfY += shelfHeight;
+            shelfHeight = 0;
+        }
+
+        AtlasGlyph glyph;
+        glyph.code = c;
+        glyph.width = static_cast<std::int32_t>(bitmap.width);
+        glyph.height = static_cast<std::int32_t>(bitmap.rows);
+        glyph.bearingX = face->glyph->bitmap_left;
+        glyph.bearingY = face->glyph->bitmap_top;
+        glyph.advance = static_cast<std::uint32_t>(face->glyph->advance.x);
+        glyph.x = shelfX + kGlyphPadding;
+        glyph.y = shelfY + kGlyphPadding;
+
+        shelfHeight = std::max(shelfHeight, cellHeight);
+        _height = std::max(_height, shelfY + shelfHeight);
+        _pixels.resize(static_cast<size_t>(_width) * _height);
+        for (unsigned int row = 0; row < bitmap.rows; ++row) {
+            std::memcpy(_pixels.data() + static_cast<size_t>(glyph.y + row) * _width + glyph.x,
+                        bitmap.buffer + static_cast<std::ptrdiff_t>(row) * bitmap.pitch, bitmap.width);
+        }
+        shelfX += cellWidth;
+        _glyphs.push_back(glyph);
+    }
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(ft);
+    return true;
+}
+
+bool cbit::GlyphAtlas::save(const std::string &path) const {
+    return writeFileAtomically(path, [&](std::ostream &file) {
+        file.write(kCookedFontMagic, sizeof(kCookedFontMagic));
+        writeValue(file, kCookedFontVersion);
+        writeValue(file, _width);
+        writeValue(file, _height);
+        writeValue(file, static_cast<std::uint32_t>(_glyphs.size()));
+        file.write(reinterpret_cast<const char *>(_glyphs.data()),
+                   static_cast<std::streamsize>(_glyphs.size() * sizeof(AtlasGlyph)));
+        file.write(reinterpret_cast<const char *>(_pixels.data()), static_cast<std::streamsize>(_pixels.size()));
+        return static_cast<bool>(file);
+    });
+}
+
+bool cbit::GlyphAtlas::load(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    char magic[sizeof(kCookedFontMagic)] = {};
+    std::uint32_t version = 0;
+    std::uint32_t width = 0;
+    std::uint32_t height = 0;
+    std::uint32_t glyphCount = 0;
+    bool valid = file.read(magic, sizeof(magic)) && std::memcmp(magic, kCookedFontMagic, sizeof(magic)) == 0 &&
+                 readValue(file, version) && version == kCookedFontVersion && readValue(file, width) &&
+                 readValue(file, height) && readValue(file, glyphCount) && width <= kMaxAtlasSize &&
+                 height <= kMaxAtlasSize && glyphCount <= kGlyphCount;
+
+    std::vector<AtlasGlyph> glyphs(valid ? glyphCount : 0);
+    std::vector<unsigned char> pixels(valid ? static_cast<size_t>(width) * height : 0);
+    valid = valid && file.read(reinterpret_cast<char *>(glyphs.data()),
+                               static_cast<std::streamsize>(glyphs.size() * sizeof(AtlasGlyph))) &&
+            file.read(reinterpret_cast<char *>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+    for (const AtlasGlyph &glyph: glyphs) {
+        valid = valid && glyph.width >= 0 && glyph.height >= 0 &&
+                glyph.x + static_cast<std::uint32_t>(glyph.width) <= width &&
+                glyph.y + static_cast<std::uint32_t>(glyph.height) <= height;
+    }
+
+    if (!valid) {
+        Logger::log()->error("{} is not a version {} cooked font", path, kCookedFontVersion);
+        return false;
+    }
+    _width = width;
+    _height = height;
+    _glyphs = std::move(glyphs);
+    _pixels = std::move(pixels);
+    return true;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file    GlyphAtlas.h
+ * @brief   Header file for the GlyphAtlas class.
+ * @details Rasterizes the ASCII glyphs of a font at one pixel size into a single 8-bit atlas, and reads and writes
+ *          the engine-native .cbfont files that cache it. Loading a cooked atlas needs no FreeType.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_GLYPHATLAS_H
+#define CBIT_GLYPHATLAS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cbit {
+    constexpr const char *kCookedFontExtension = ".cbfont";
+
+    /**
+     * @struct AtlasGlyph
+     * @brief  Placement and metrics of one glyph in the atlas, in pixels.
+     */
+    struct AtlasGlyph {
+        std::uint32_t code = 0;
+        std::int32_t width = 0;
+        std::int32_t height = 0;
+        std::int32_t bearingX = 0;
+        std::int32_t bearingY = 0;
+        std::uint32_t advance = 0; // 1/64 pixels, as FreeType reports it.
+        std::uint32_t x = 0; // Top-left corner in the atlas.
+        std::uint32_t y = 0;
+    };
+
+    /**
+     * @class   GlyphAtlas
+     * @brief   Single-channel texture atlas of the glyphs of a font.
+     * @details Rows are stored top row first, as FreeType renders them.
+     */
+    class GlyphAtlas {
+    public:
+        /**
+         * Get the path of the cooked atlas of a font at a pixel size.
+         */
+        static std::string getCookedPath(const std::string &fontPath, unsigned int fontSize);
+
+        /**
+         * Rasterize character codes 0-127 of a font with FreeType.
+         * @param fontPath Path to a font file FreeType reads.
+         * @param fontSize Pixel height of the glyphs.
+         * @return true if the font was loaded.
+         */
+        bool rasterize(const std::string &fontPath, unsigned int fontSize);
+
+        /**
+         * Write the atlas to a cooked font file.
+         * @param path Destination path; missing directories are created.
+         * @return true if the file was written.
+         */
+        bool save(const std::string &path) const;
+
+        /**
+         * Read a cooked font file.
+         * @param path Path to the file.
+         * @return true if the file is a valid cooked font of the current version.
+         */
+        bool load(const std::string &path);
+
+        [[nodiscard]] std::uint32_t getWidth() const { return _width; }
+        [[nodiscard]] std::uint32_t getHeight() const { return _height; }
+        [[nodiscard]] const std::vector<unsigned char> &getPixels() const { return _pixels; }
+        [[nodiscard]] const std::vector<AtlasGlyph> &getGlyphs() const { return _glyphs; }
+
+    private:
+        std::uint32_t _width = 0;
+        std::uint32_t _height = 0;
+        std::vector<unsigned char> _pixels;
+        std::vector<AtlasGlyph> _glyphs;
+    };
+}
+
+#endif //CBIT_GLYPHATLAS_H
@@ -0,0 +1,63 @@
+/**
+ * @file    RenderSnapshot.cpp
+ * @brief   Implementation of the RenderSnapshot struct.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "RenderSnapshot.h"
+
+namespace {
+    const std::string kEmptyString;
+
+    std::uint32_t appendString(std::vector<std::string> &table, std::size_t &count, const std::string &value) {
+        if (count == table.size()) {
+            table.emplace_back();
+        }
+        table[count] = value;
+        return static_cast<std::uint32_t>(count++);
+    }
+}
+
+std::uint32_t cbit::RenderSnapshot::internPath(const std::string &path) {
+    if (path.empty()) {
+        return kNoSnapshotString;
+    }
+    // A frame references a handful of distinct textures and shaders, so a linear scan beats hashing.
+    for (std::size_t i = 0; i < _pathCount; ++i) {
+        if (_paths[i] == path) {
+            return static_cast<std::uint32_t>(i);
+        }
+    }
+    return appendString(_paths, _pathCount, path);
+}
+
+const std::string &cbit::RenderSnapshot::getPath(const std::uint32_t index) const {
+    return index < _pathCount ? _paths[index] : kEmptyString;
+}
+
+std::uint32_t cbit::RenderSnapshot::addText(const std::string &text) {
+    return appendString(_texts, _textCount, text);
+}
+
+const std::string &cbit::RenderSnapshot::getText(const std::uint32_t index) const {
+    return index < _textCount ? _texts[index] : kEmptyString;
+}
+
+void cbit::RenderSnapshot::clear() {
+    const RenderSnapshot defaults;
+    hasCamera = false;
+    lightDirection = defaults.lightDirection;
+    lightColor = defaults.lightColor;
+    ambientStrength = defaults.ambientStrength;
+    lightIntensity = defaults.lightIntensity;
+    items.clear();
+    bones.clear();
+    instances.clear();
+    batches.clear();
+    uiImages.clear();
+    uiRectangles.clear();
+    uiTexts.clear();
+    _pathCount = 0;
+    _textCount = 0;
+}
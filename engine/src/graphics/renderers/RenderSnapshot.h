@@ -0,0 +1,173 @@
+/**
+ * @file    RenderSnapshot.h
+ * @brief   Header file for the RenderSnapshot struct.
+ * @details A render snapshot is everything the renderer needs to draw one frame, copied out of the scene on the
+ *          simulation thread: draw calls, matrices, bone palettes, instanced batches and UI quads. It references GL
+ *          objects by name only and never touches the registry, so it can be submitted from another thread or
+ *          consumed by a headless renderer.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_RENDERSNAPSHOT_H
+#define CBIT_RENDERSNAPSHOT_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+#include "graphics/meshes/Mesh.h"
+#include "graphics/meshes/SkinnedMesh.h"
+
+namespace cbit {
+    class BakedAnimation;
+
+    /**
+     * Index used for "no path" or "no text" in a snapshot's string tables.
+     */
+    constexpr std::uint32_t kNoSnapshotString = 0xFFFFFFFFu;
+
+    /**
+     * @enum  RenderItemKind
+     * @brief How the renderer sets up a mesh item.
+     */
+    enum class RenderItemKind {
+        Skybox, // Drawn first without depth, oriented by the inverse view rotation.
+        Static,
+        Skinned // Gets the bone palette range of the item.
+    };
+
+    /**
+     * @struct RenderMeshItem
+     * @brief  One mesh draw with its material state.
+     */
+    struct RenderMeshItem {
+        RenderItemKind kind = RenderItemKind::Static;
+        MeshDrawCall drawCall;
+        glm::mat4 model{1.0f};
+        glm::vec3 baseColor{0.83f, 0.83f, 0.83f};
+        std::uint32_t vertexShader = kNoSnapshotString; // Override paths; both must be set to apply.
+        std::uint32_t fragmentShader = kNoSnapshotString;
+        std::uint32_t texture = kNoSnapshotString;
+        bool flipTexture = true;
+        bool useSkinning = false;
+        std::uint32_t boneOffset = 0; // Range in RenderSnapshot::bones.
+        std::uint32_t boneCount = 0;
+    };
+
+    /**
+     * @struct RenderInstanceBatch
+     * @brief  Baked-animation instances sharing a mesh, animation and texture.
+     * @details The shared pointers keep the mesh and bone texture alive until the snapshot has been submitted.
+     */
+    struct RenderInstanceBatch {
+        std::shared_ptr<SkinnedMesh> mesh;
+        std::shared_ptr<const BakedAnimation> animation;
+        std::uint32_t texture = kNoSnapshotString;
+        bool flipTexture = true;
+        std::uint32_t instanceOffset = 0; // Range in RenderSnapshot::instances.
+        std::uint32_t instanceCount = 0;
+    };
+
+    /**
+     * @struct RenderUIQuad
+     * @brief  Screen-space quad in framebuffer pixels, origin bottom-left.
+     */
+    struct RenderUIQuad {
+        glm::vec2 position{0.0f};
+        glm::vec2 size{0.0f};
+        glm::vec4 color{1.0f}; // Fill color, or tint for images.
+        std::uint32_t texture = kNoSnapshotString;
+    };
+
+    /**
+     * @struct RenderUIText
+     * @brief  Screen-space text run.
+     */
+    struct RenderUIText {
+        std::uint32_t text = kNoSnapshotString;
+        glm::vec2 position{0.0f};
+        float scale = 1.0f;
+        glm::vec3 color{1.0f};
+    };
+
+    /**
+     * @struct RenderSnapshot
+     * @brief  Plain-data description of one frame.
+     * @details Snapshots are reused between frames; clear() keeps the capacity of every list and string so a steady
+     *          scene extracts without allocating.
+     */
+    struct RenderSnapshot {
+        std::uint64_t frame = 0;
+        int framebufferWidth = 0;
+        int framebufferHeight = 0;
+        float interpolationAlpha = 1.0f;
+        glm::vec4 clearColor{0.0f, 0.0f, 0.0f, 1.0f};
+        bool wireframe = false;
+
+        // Camera; meshes are skipped when no camera is active.
+        bool hasCamera = false;
+        glm::mat4 view{1.0f};
+        glm::mat4 projection{1.0f};
+        glm::vec3 cameraPosition{0.0f};
+
+        // Directional light.
+        glm::vec3 lightDirection{-10.0f, -10.0f, -1.0f};
+        glm::vec3 lightColor{1.0f, 1.0f, 1.0f};
+        float ambientStrength = 0.25f;
+        float lightIntensity = 1.0f;
+
+        std::vector<RenderMeshItem> items;
+        std::vector<glm::mat4> bones;
+        std::vector<SkinnedInstance> instances;
+        std::vector<RenderInstanceBatch> batches;
+
+        // UI, each list sorted back to front.
+        std::vector<RenderUIQuad> uiImages;
+        std::vector<RenderUIQuad> uiRectangles;
+        std::vector<RenderUIText> uiTexts;
+
+        /**
+         * Add a resource path to the snapshot, reusing the entry of an equal path.
+         * @param path File path; an empty path yields kNoSnapshotString.
+         * @return Index for getPath().
+         */
+        std::uint32_t internPath(const std::string &path);
+
+        /**
+         * Get a path added with internPath().
+         * @param index Index returned by internPath().
+         * @return The path, or an empty string for kNoSnapshotString.
+         */
+        [[nodiscard]] const std::string &getPath(std::uint32_t index) const;
+
+        /**
+         * Add a text run to the snapshot.
+         * @param text Text to copy.
+         * @return Index for getText().
+         */
+        std::uint32_t addText(const std::string &text);
+
+        /**
+         * Get a text added with addText().
+         * @param index Index returned by addText().
+         * @return The text, or an empty string for kNoSnapshotString.
+         */
+        [[nodiscard]] const std::string &getText(std::uint32_t index) const;
+
+        /**
+         * Reset the snapshot for the next frame, keeping allocations.
+         */
+        void clear();
+
+    private:
+        // Strings are overwritten in place, so the tables only grow and only the first count entries are live.
+        std::vector<std::string> _paths;
+        std::size_t _pathCount = 0;
+        std::vector<std::string> _texts;
+        std::size_t _textCount = 0;
+    };
+}
+
+#endif //CBIT_RENDERSNAPSHOT_H
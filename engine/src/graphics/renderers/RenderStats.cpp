@@ -0,0 +1,125 @@
+/**
+ * @file    RenderStats.cpp
+ * @brief   Implementation of the RenderStats class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "RenderStats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+namespace {
+    std::mutex sMutex;
+    cbit::RenderFrameStats sLastFrame;
+    std::array<float, cbit::RenderStats::kFrameTimeSamples> sFrameTimes{};
+    std::size_t sFrameTimeNext = 0;
+    std::size_t sFrameTimeCount = 0;
+
+    std::uint64_t countTriangles(const GLenum mode, const GLsizei vertexCount) {
+        if (vertexCount < 3) {
+            return 0;
+        }
+        switch (mode) {
+            case GL_TRIANGLES:
+                return static_cast<std::uint64_t>(vertexCount) / 3;
+            case GL_TRIANGLE_STRIP:
+            case GL_TRIANGLE_FAN:
+                return static_cast<std::uint64_t>(vertexCount) - 2;
+            default:
+                return 0;
+        }
+    }
+}
+
+cbit::RenderFrameStats cbit::RenderStats::_current;
+cbit::RenderPass cbit::RenderStats::_pass = cbit::RenderPass::Setup;
+
+cbit::RenderPassStats &cbit::RenderPassStats::operator+=(const RenderPassStats &other) {
+    drawCalls += other.drawCalls;
+    programBinds += other.programBinds;
+    textureBinds += other.textureBinds;
+    uniformUploads += other.uniformUploads;
+    triangles += other.triangles;
+    return *this;
+}
+
+cbit::RenderPassStats cbit::RenderFrameStats::total() const {
+    RenderPassStats sum;
+    for (const auto &pass: passes) {
+        sum += pass;
+    }
+    return sum;
+}
+
+const char *cbit::RenderStats::getPassName(const RenderPass pass) {
+    switch (pass) {
+        case RenderPass::Setup:
+            return "Setup";
+        case RenderPass::Sky:
+            return "Sky";
+        case RenderPass::Meshes:
+            return "Meshes";
+        case RenderPass::Instanced:
+            return "Instanced";
+        case RenderPass::UI:
+            return "UI";
+        case RenderPass::Text:
+            return "Text";
+        default:
+            return "Unknown";
+    }
+}
+
+void cbit::RenderStats::beginFrame(const std::uint64_t frame) {
+    _current = {};
+    _current.frame = frame;
+    _pass = RenderPass::Setup;
+}
+
+void cbit::RenderStats::endFrame() {
+    std::lock_guard lock(sMutex);
+    sLastFrame = _current;
+}
+
+void cbit::RenderStats::setPass(const RenderPass pass) {
+    _pass = pass;
+}
+
+void cbit::RenderStats::countDraw(const GLenum mode, const GLsizei vertexCount, const GLsizei instanceCount) {
+    RenderPassStats &stats = _current.passes[static_cast<std::size_t>(_pass)];
+    ++stats.drawCalls;
+    stats.triangles += countTriangles(mode, vertexCount) * static_cast<std::uint64_t>(std::max(instanceCount, 0));
+}
+
+cbit::RenderFrameStats cbit::RenderStats::getLastFrame() {
+    std::lock_guard lock(sMutex);
+    return sLastFrame;
+}
+
+void cbit::RenderStats::recordFrameTime(const float seconds) {
+    std::lock_guard lock(sMutex);
+    sFrameTimes[sFrameTimeNext] = seconds;
+    sFrameTimeNext = (sFrameTimeNext + 1) % sFrameTimes.size();
+    sFrameTimeCount = std::min(sFrameTimeCount + 1, sFrameTimes.size());
+}
+
+float cbit::RenderStats::getFrameTimePercentile(const float percentile) {
+    std::vector<float> samples;
+    {
+        std::lock_guard lock(sMutex);
+        samples.assign(sFrameTimes.begin(), sFrameTimes.begin() + static_cast<std::ptrdiff_t>(sFrameTimeCount));
+    }
+    if (samples.empty()) {
+        return 0.0f;
+    }
+
+    // Nearest-rank percentile.
+    const float rank = std::ceil(std::clamp(percentile, 0.0f, 100.0f) / 100.0f * static_cast<float>(samples.size()));
+    const std::size_t index = std::min(samples.size() - 1, static_cast<std::size_t>(std::max(rank, 1.0f)) - 1);
+    std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(index), samples.end());
+    return samples[index];
+}
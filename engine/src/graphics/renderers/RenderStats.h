@@ -0,0 +1,141 @@
+/**
+ * @file    RenderStats.h
+ * @brief   Header file for the RenderStats class.
+ * @details Per-frame counters of the GL work issued by the renderer, split by render pass, and a history of frame
+ *          times. The counters are fed by the wrappers in GLCalls.h; draw code that goes through them is counted
+ *          without further changes.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_RENDERSTATS_H
+#define CBIT_RENDERSTATS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "OpenGLInclude.h"
+
+namespace cbit {
+    /**
+     * @enum  RenderPass
+     * @brief Part of a frame that GL work is attributed to.
+     */
+    enum class RenderPass : std::uint8_t {
+        Setup,
+        Sky,
+        Meshes,
+        Instanced,
+        UI,
+        Text,
+        Count
+    };
+
+    /**
+     * @struct RenderPassStats
+     * @brief  GL work issued by one pass.
+     */
+    struct RenderPassStats {
+        std::uint32_t drawCalls = 0;
+        std::uint32_t programBinds = 0;
+        std::uint32_t textureBinds = 0;
+        std::uint32_t uniformUploads = 0;
+        std::uint64_t triangles = 0;
+
+        RenderPassStats &operator+=(const RenderPassStats &other);
+    };
+
+    /**
+     * @struct RenderFrameStats
+     * @brief  GL work issued by one frame, by pass.
+     */
+    struct RenderFrameStats {
+        std::uint64_t frame = 0;
+        std::array<RenderPassStats, static_cast<std::size_t>(RenderPass::Count)> passes{};
+
+        [[nodiscard]] const RenderPassStats &get(RenderPass pass) const {
+            return passes[static_cast<std::size_t>(pass)];
+        }
+
+        [[nodiscard]] RenderPassStats total() const;
+    };
+
+    /**
+     * @class RenderStats
+     * @brief Static per-frame render counters.
+     * @details The counting functions and beginFrame()/endFrame() must be called on the thread that owns the GL
+     *          context. endFrame() publishes the finished frame; getLastFrame() and the frame time functions may
+     *          be called from any thread.
+     */
+    class RenderStats {
+    public:
+        static constexpr std::size_t kFrameTimeSamples = 240;
+
+        static const char *getPassName(RenderPass pass);
+
+        /**
+         * Reset the counters for a new frame. Work issued before the first setPass() counts as RenderPass::Setup.
+         * @param frame Frame number of the snapshot being drawn.
+         */
+        static void beginFrame(std::uint64_t frame);
+
+        /**
+         * Publish the counters of the current frame.
+         */
+        static void endFrame();
+
+        static void setPass(RenderPass pass);
+        static RenderPass getPass() { return _pass; }
+
+        static void countDraw(GLenum mode, GLsizei vertexCount, GLsizei instanceCount = 1);
+        static void countProgramBind() { ++_current.passes[static_cast<std::size_t>(_pass)].programBinds; }
+        static void countTextureBind() { ++_current.passes[static_cast<std::size_t>(_pass)].textureBinds; }
+        static void countUniformUpload() { ++_current.passes[static_cast<std::size_t>(_pass)].uniformUploads; }
+
+        /**
+         * Get the counters of the last published frame.
+         * @return Copy of the last frame's counters.
+         */
+        static RenderFrameStats getLastFrame();
+
+        /**
+         * Add a frame time to the history used for percentiles.
+         * @param seconds Wall-clock duration of one iteration of the main loop.
+         */
+        static void recordFrameTime(float seconds);
+
+        /**
+         * Get a percentile of the last kFrameTimeSamples frame times.
+         * @param percentile Percentile in [0, 100].
+         * @return Frame time in seconds, or 0 if no frame was recorded.
+         */
+        static float getFrameTimePercentile(float percentile);
+
+    private:
+        static RenderFrameStats _current;
+        static RenderPass _pass;
+    };
+
+    /**
+     * @class RenderPassScope
+     * @brief Attributes the GL work issued in its scope to a pass and restores the previous pass on exit.
+     */
+    class RenderPassScope {
+    public:
+        explicit RenderPassScope(const RenderPass pass) : _previous(RenderStats::getPass()) {
+            RenderStats::setPass(pass);
+        }
+
+        ~RenderPassScope() {
+            RenderStats::setPass(_previous);
+        }
+
+        RenderPassScope(const RenderPassScope &) = delete;
+        RenderPassScope &operator=(const RenderPassScope &) = delete;
+
+    private:
+        RenderPass _previous;
+    };
+}
+
+#endif //CBIT_RENDERSTATS_H
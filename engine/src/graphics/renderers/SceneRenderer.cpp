@@ -0,0 +1,312 @@
+/**
+ * @file    SceneRenderer.cpp
+ * @brief   Implementation of the SceneRenderer class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "SceneRenderer.h"
+
+#include <array>
+#include <glm/ext/matrix_clip_space.hpp>
+#include "RenderStats.h"
+#include "core/MemoryTracker.h"
+#include "graphics/animation/BakedAnimation.h"
+#include "utilities/Logger.h"
+
+cbit::SceneRenderer::SceneRenderer() : _textRenderer(1200, 800) {
+    _shader.loadShaders("resources/shaders/default.vert", "resources/shaders/default.frag");
+    _skinnedShader.loadShaders("resources/shaders/skinned.vert", "resources/shaders/default.frag");
+    _instancedSkinnedShader.loadShaders("resources/shaders/skinned_instanced.vert", "resources/shaders/default.frag");
+    _uiShader.loadShaders("resources/shaders/ui.vert", "resources/shaders/ui.frag");
+    _uiColorShader.loadShaders("resources/shaders/color_ui.vert", "resources/shaders/color_ui.frag");
+    _textRenderer.loadFont("resources/fonts/Amble.ttf", kDefaultFontSize);
+}
+
+cbit::SceneRenderer::~SceneRenderer() {
+    MemoryTracker::trackGpu(MemoryCategory::Render, -_instanceBufferBytes);
+    glDeleteBuffers(1, &_instanceBuffer);
+}
+
+void cbit::SceneRenderer::submit(const RenderSnapshot &snapshot) {
+    CBIT_PROFILE_SCOPE("SceneRenderer::submit");
+    _gpuProfiler.beginFrame();
+    RenderStats::beginFrame(snapshot.frame);
+
+    {
+        CBIT_PROFILE_GPU_SCOPE(_gpuProfiler, "Clear");
+        glViewport(0, 0, snapshot.framebufferWidth, snapshot.framebufferHeight);
+        glPolygonMode(GL_FRONT_AND_BACK, snapshot.wireframe ? GL_LINE : GL_FILL);
+        glClearColor(snapshot.clearColor.r, snapshot.clearColor.g, snapshot.clearColor.b, snapshot.clearColor.a);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    }
+
+    if (snapshot.framebufferWidth > 0 && snapshot.framebufferHeight > 0) {
+        _renderMeshes(snapshot);
+        _renderUI(snapshot);
+    }
+
+    RenderStats::endFrame();
+}
+
+cbit::ShaderProgram *cbit::SceneRenderer::_getShader(const std::string &vertexPath, const std::string &fragmentPath) {
+    if (vertexPath.empty() || fragmentPath.empty()) {
+        return &_shader;
+    }
+
+    auto &shadersForVertex = _shaderCache[vertexPath];
+    const auto found = shadersForVertex.find(fragmentPath);
+    if (found != shadersForVertex.end()) {
+        return found->second.get();
+    }
+
+    auto shader = std::make_unique<ShaderProgram>();
+    if (!shader->loadShaders(vertexPath.c_str(), fragmentPath.c_str())) {
+        CBIT_LOG_ERROR_RATE_LIMITED(1.0, "Failed to load shader override: {} / {}", vertexPath, fragmentPath);
+        return &_shader;
+    }
+
+    auto *shaderPtr = shader.get();
+    shadersForVertex.emplace(fragmentPath, std::move(shader));
+    return shaderPtr;
+}
+
+void cbit::SceneRenderer::_renderMeshes(const RenderSnapshot &snapshot) {
+    if (!snapshot.hasCamera) {
+        return;
+    }
+
+    CBIT_PROFILE_SCOPE("SceneRenderer::meshes");
+    CBIT_PROFILE_GPU_SCOPE(_gpuProfiler, "Meshes");
+
+    ShaderProgram *currentShader = nullptr;
+
+    auto applyShader = [&](ShaderProgram *shader) {
+        if (shader != currentShader) {
+            shader->use();
+
+            if (shader->hasUniform("uView")) {
+                shader->setUniform("uView", snapshot.view);
+            }
+            if (shader->hasUniform("uProjection")) {
+                shader->setUniform("uProjection", snapshot.projection);
+            }
+            if (shader->hasUniform("lightDir")) {
+                shader->setUniform("lightDir", snapshot.lightDirection);
+            }
+            if (shader->hasUniform("lightColor")) {
+                shader->setUniform("lightColor", snapshot.lightColor);
+            }
+            if (shader->hasUniform("baseColor")) {
+                shader->setUniform("baseColor", glm::vec3(0.83f, 0.83f, 0.83f));
+            }
+            if (shader->hasUniform("ambientStrength")) {
+                shader->setUniform("ambientStrength", snapshot.ambientStrength);
+            }
+            if (shader->hasUniform("lightIntensity")) {
+                shader->setUniform("lightIntensity", snapshot.lightIntensity);
+            }
+            if (shader->hasUniform("lightWrap")) {
+                shader->setUniform("lightWrap", 0.35f);
+            }
+
+            currentShader = shader;
+        }
+    };
+
+    auto applyTexture = [&](ShaderProgram *shader, const std::uint32_t texture, const bool flipVertically) {
+        const std::string &path = snapshot.getPath(texture);
+        const bool hasTexture = !path.empty();
+
+        if (shader->hasUniform("uUseTexture")) {
+            shader->setUniform("uUseTexture", hasTexture ? 1 : 0);
+        }
+
+        if (hasTexture && shader->hasUniform("diffuseTexture")) {
+            auto [it, inserted] = _textures.try_emplace(path);
+            if (inserted) {
+                it->second.loadTexture(path, flipVertically);
+            }
+            glActiveTexture(GL_TEXTURE0);
+            it->second.bind();
+            shader->setUniform("diffuseTexture", 0);
+        }
+    };
+
+    const glm::mat4 invViewRot = glm::mat4(glm::transpose(glm::mat3(snapshot.view)));
+    bool drawingSky = false;
+    RenderPassScope pass(RenderPass::Meshes);
+
+    for (const auto &item: snapshot.items) {
+        // Skybox items come first and draw behind everything else.
+        const bool isSky = item.kind == RenderItemKind::Skybox;
+        if (isSky != drawingSky) {
+            glDepthMask(isSky ? GL_FALSE : GL_TRUE);
+            if (isSky) {
+                glDisable(GL_DEPTH_TEST);
+            } else {
+                glEnable(GL_DEPTH_TEST);
+            }
+            drawingSky = isSky;
+            RenderStats::setPass(isSky ? RenderPass::Sky : RenderPass::Meshes);
+        }
+
+        ShaderProgram *shader = item.useSkinning ? &_skinnedShader : &_shader;
+        if (item.vertexShader != kNoSnapshotString && item.fragmentShader != kNoSnapshotString) {
+            shader = _getShader(snapshot.getPath(item.vertexShader), snapshot.getPath(item.fragmentShader));
+        }
+        applyShader(shader);
+
+        if (isSky) {
+            if (shader->hasUniform("uInvViewRot")) {
+                shader->setUniform("uInvViewRot", invViewRot);
+            }
+        } else {
+            if (shader->hasUniform("uModel")) {
+                shader->setUniform("uModel", item.model);
+            }
+            if (shader->hasUniform("baseColor")) {
+                shader->setUniform("baseColor", item.baseColor);
+            }
+        }
+
+        applyTexture(shader, item.texture, item.flipTexture);
+
+        if (item.kind == RenderItemKind::Skinned) {
+            if (shader->hasUniform("uUseSkinning")) {
+                shader->setUniform("uUseSkinning", item.useSkinning ? 1 : 0);
+            }
+
+            if (item.boneCount > 0 && shader->hasUniform("uBones[0]")) {
+                for (std::uint32_t i = 0; i < item.boneCount; ++i) {
+                    const std::string uniformName = "uBones[" + std::to_string(i) + "]";
+                    shader->setUniform(uniformName.c_str(), snapshot.bones[item.boneOffset + i]);
+                }
+            }
+        }
+
+        item.drawCall.draw();
+    }
+
+    if (drawingSky) {
+        glDepthMask(GL_TRUE);
+        glEnable(GL_DEPTH_TEST);
+    }
+
+    // Baked-animation crowds: one instanced draw per batch.
+    if (snapshot.batches.empty()) {
+        return;
+    }
+
+    if (_instanceBuffer == 0) {
+        glGenBuffers(1, &_instanceBuffer);
+    }
+
+    RenderStats::setPass(RenderPass::Instanced);
+
+    ShaderProgram *shader = &_instancedSkinnedShader;
+    applyShader(shader);
+    if (shader->hasUniform("baseColor")) {
+        shader->setUniform("baseColor", glm::vec3(0.83f, 0.83f, 0.83f));
+    }
+
+    constexpr GLuint kBoneTextureUnit = 1;
+    std::array<glm::vec4, kMaxBakedClips> clipInfo{};
+
+    for (const auto &batch: snapshot.batches) {
+        const auto instanceBytes = static_cast<std::int64_t>(batch.instanceCount * sizeof(SkinnedInstance));
+        glBindBuffer(GL_ARRAY_BUFFER, _instanceBuffer);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(instanceBytes),
+                     snapshot.instances.data() + batch.instanceOffset, GL_STREAM_DRAW);
+        MemoryTracker::trackGpu(MemoryCategory::Render, instanceBytes - _instanceBufferBytes);
+        _instanceBufferBytes = instanceBytes;
+
+        const auto &clips = batch.animation->getClips();
+        for (size_t i = 0; i < clips.size() && i < clipInfo.size(); ++i) {
+            clipInfo[i] = glm::vec4(static_cast<float>(clips[i].firstFrame),
+                                    static_cast<float>(clips[i].frameCount),
+                                    clips[i].duration,
+                                    clips[i].loop ? 1.0f : 0.0f);
+        }
+
+        batch.animation->bind(kBoneTextureUnit);
+        shader->setUniform("uBoneTexture", static_cast<GLint>(kBoneTextureUnit));
+        shader->setUniform("uClipInfo[0]", clipInfo.data(), static_cast<GLsizei>(clipInfo.size()));
+        shader->setUniform("uSampleRate", batch.animation->getSampleRate());
+        shader->setUniform("uBoneCount", batch.animation->getBoneCount());
+
+        applyTexture(shader, batch.texture, batch.flipTexture);
+        batch.mesh->drawInstanced(_instanceBuffer, static_cast<GLsizei>(batch.instanceCount));
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+void cbit::SceneRenderer::_renderUI(const RenderSnapshot &snapshot) {
+    CBIT_PROFILE_SCOPE("SceneRenderer::ui");
+    CBIT_PROFILE_GPU_SCOPE(_gpuProfiler, "UI");
+    const glm::mat4 projectionMatrix = glm::ortho(
+        0.0f, static_cast<float>(snapshot.framebufferWidth), // left → right
+        0.0f, static_cast<float>(snapshot.framebufferHeight), // bottom → top
+        -1.0f, 1.0f
+    );
+
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    RenderPassScope pass(RenderPass::UI);
+
+    if (!snapshot.uiImages.empty()) {
+        _uiShader.use();
+        _uiShader.setUniform("uProjection", projectionMatrix);
+        glActiveTexture(GL_TEXTURE0);
+        _uiShader.setUniform("uTexture", 0);
+
+        for (const auto &image: snapshot.uiImages) {
+            const std::string &path = snapshot.getPath(image.texture);
+            auto [it, inserted] = _uiTextures.try_emplace(path); // default‐constructs Texture
+            if (inserted) {
+                if (!it->second.loadTexture(path)) {
+                    CBIT_LOG_ERROR_RATE_LIMITED(1.0, "Failed to load texture: {}", path);
+                    _uiTextures.erase(it);
+                    continue;
+                }
+            }
+            it->second.bind();
+
+            _uiShader.setUniform("uPosition", image.position);
+            _uiShader.setUniform("uSize", image.size);
+            // if ui shader supports tint
+            if (_uiShader.hasUniform("uTint")) {
+                _uiShader.setUniform("uTint", image.color);
+            }
+            _quad2D.draw();
+        }
+    }
+
+    if (!snapshot.uiRectangles.empty()) {
+        _uiColorShader.use();
+        _uiColorShader.setUniform("uProjection", projectionMatrix);
+
+        for (const auto &rectangle: snapshot.uiRectangles) {
+            _uiColorShader.setUniform("uPosition", rectangle.position);
+            _uiColorShader.setUniform("uSize", rectangle.size);
+            _uiColorShader.setUniform("uColor", rectangle.color);
+
+            // draw the unit quad scaled/translated
+            _quad2D.draw();
+        }
+    }
+
+    RenderStats::setPass(RenderPass::Text);
+    _textRenderer.resize(static_cast<GLuint>(snapshot.framebufferWidth),
+                         static_cast<GLuint>(snapshot.framebufferHeight));
+    for (const auto &text: snapshot.uiTexts) {
+        _textRenderer.renderText(snapshot.getText(text.text), text.position.x, text.position.y, text.scale,
+                                 text.color);
+    }
+
+    glDisable(GL_BLEND);
+    glEnable(GL_DEPTH_TEST);
+}
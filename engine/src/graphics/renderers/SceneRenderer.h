@@ -0,0 +1,67 @@
+/**
+ * @file    SceneRenderer.h
+ * @brief   Header file for the SceneRenderer class.
+ * @details Submits render snapshots to OpenGL. Owns every GL object that only the renderer uses: the default,
+ *          skinned and UI shaders, shader overrides, textures, the instance buffer and the text renderer.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_SCENERENDERER_H
+#define CBIT_SCENERENDERER_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "RenderSnapshot.h"
+#include "ShaderProgram.h"
+#include "TextRenderer.h"
+#include "Texture.h"
+#include "core/Profiler.h"
+#include "graphics/ui/Quad2D.h"
+
+namespace cbit {
+    /**
+     * @class SceneRenderer
+     * @brief Draws a RenderSnapshot. Must be created, used and destroyed on the GL thread.
+     */
+    class SceneRenderer {
+    public:
+        SceneRenderer();
+
+        ~SceneRenderer();
+
+        SceneRenderer(const SceneRenderer &) = delete;
+        SceneRenderer &operator=(const SceneRenderer &) = delete;
+
+        /**
+         * Clear the framebuffer and draw the meshes and UI of a snapshot.
+         * @param snapshot Frame to draw.
+         */
+        void submit(const RenderSnapshot &snapshot);
+
+    private:
+        ShaderProgram _shader;
+        ShaderProgram _skinnedShader;
+        ShaderProgram _instancedSkinnedShader;
+        ShaderProgram _uiShader;
+        ShaderProgram _uiColorShader;
+        // Keyed by vertex path, then fragment path, so lookups need no combined key string.
+        std::unordered_map<std::string, std::unordered_map<std::string, std::unique_ptr<ShaderProgram> > > _shaderCache;
+        std::unordered_map<std::string, Texture> _textures;
+        std::unordered_map<std::string, Texture> _uiTextures;
+        TextRenderer _textRenderer;
+        Quad2D _quad2D;
+        GLuint _instanceBuffer = 0;
+        std::int64_t _instanceBufferBytes = 0;
+        GpuProfiler _gpuProfiler;
+
+        ShaderProgram *_getShader(const std::string &vertexPath, const std::string &fragmentPath);
+
+        void _renderMeshes(const RenderSnapshot &snapshot);
+
+        void _renderUI(const RenderSnapshot &snapshot);
+    };
+}
+
+#endif //CBIT_SCENERENDERER_H
@@ -0,0 +1,133 @@
+/**
+ * @file    ShaderBundle.cpp
+ * @brief   Implementation of the ShaderBundle class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "ShaderBundle.h"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+#include "utilities/AssetPaths.h"
+#include "utilities/AtomicFile.h"
+#include "utilities/Logger.h"
+#include "utilities/MappedFile.h"
+
+namespace {
+    constexpr char kShaderBundleMagic[4] = {'C', 'B', 'S', 'H'};
+    constexpr std::uint32_t kShaderBundleVersion = 1;
+    constexpr std::string_view kShaderBundleName = "shaders.cbshaders";
+
+    std::mutex sMutex;
+    bool sOpened = false;
+    cbit::MappedFile sFile;
+    std::unordered_map<std::string, std::string_view> sSources; // Views into sFile.
+
+    // Bundle keys are normalized so "resources/./shaders/a.vert" and "resources/shaders/a.vert" match.
+    std::string bundleKey(const std::string &filename) {
+        return std::filesystem::path(filename).lexically_normal().generic_string();
+    }
+
+    void writeString(std::ostream &file, const std::string &text) {
+        const auto length = static_cast<std::uint32_t>(text.size());
+        file.write(reinterpret_cast<const char *>(&length), sizeof(length));
+        file.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    bool readString(const std::byte *data, const std::size_t size, std::size_t &offset, std::string_view &text) {
+        std::uint32_t length = 0;
+        if (size - offset < sizeof(length)) {
+            return false;
+        }
+        std::memcpy(&length, data + offset, sizeof(length));
+        offset += sizeof(length);
+        if (size - offset < length) {
+            return false;
+        }
+        text = std::string_view(reinterpret_cast<const char *>(data + offset), length);
+        offset += length;
+        return true;
+    }
+
+    /**
+     * @brief  Maps the bundle and indexes its shaders. Called with sMutex held.
+     */
+    void openBundle() {
+        const std::string path = cbit::ShaderBundle::getBundlePath();
+        if (!sFile.open(path)) {
+            return;
+        }
+
+        const std::byte *data = sFile.data();
+        const std::size_t size = sFile.size();
+        std::uint32_t version = 0;
+        std::uint32_t count = 0;
+        std::size_t offset = sizeof(kShaderBundleMagic) + sizeof(version) + sizeof(count);
+        bool valid = size >= offset && std::memcmp(data, kShaderBundleMagic, sizeof(kShaderBundleMagic)) == 0;
+        if (valid) {
+            std::memcpy(&version, data + sizeof(kShaderBundleMagic), sizeof(version));
+            std::memcpy(&count, data + sizeof(kShaderBundleMagic) + sizeof(version), sizeof(count));
+            valid = version == kShaderBundleVersion;
+        }
+        for (std::uint32_t i = 0; valid && i < count; ++i) {
+            std::string_view name;
+            std::string_view source;
+            valid = readString(data, size, offset, name) && readString(data, size, offset, source);
+            sSources.emplace(std::string(name), source);
+        }
+
+        if (!valid) {
+            cbit::Logger::log()->error("{} is not a version {} shader bundle", path, kShaderBundleVersion);
+            sSources.clear();
+            sFile.close();
+        }
+    }
+}
+
+std::string cbit::ShaderBundle::getBundlePath() {
+    return (std::filesystem::path(AssetPaths::getCookedRoot()) / kShaderBundleName).generic_string();
+}
+
+bool cbit::ShaderBundle::write(const std::string &path,
+                               const std::vector<std::pair<std::string, std::string> > &sources) {
+    return writeFileAtomically(path, [&](std::ostream &file) {
+        const auto count = static_cast<std::uint32_t>(sources.size());
+        file.write(kShaderBundleMagic, sizeof(kShaderBundleMagic));
+        file.write(reinterpret_cast<const char *>(&kShaderBundleVersion), sizeof(kShaderBundleVersion));
+        file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+        for (const auto &[name, sourcePath]: sources) {
+            std::ifstream source(sourcePath, std::ios::in | std::ios::binary);
+            if (!source) {
+                Logger::log()->error("Error reading shader filename: {}", sourcePath);
+                return false;
+            }
+            std::stringstream ss;
+            ss << source.rdbuf();
+            writeString(file, bundleKey(name));
+            writeString(file, ss.str());
+        }
+        return static_cast<bool>(file);
+    });
+}
+
+bool cbit::ShaderBundle::find(const std::string &filename, std::string &source) {
+    std::lock_guard lock(sMutex);
+    if (!sOpened) {
+        sOpened = true;
+        openBundle();
+    }
+
+    const auto it = sSources.find(bundleKey(filename));
+    if (it == sSources.end() || !AssetPaths::isCookedCurrent(filename, getBundlePath())) {
+        return false;
+    }
+    source.assign(it->second);
+    return true;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file    ShaderBundle.h
+ * @brief   Header file for the ShaderBundle class.
+ * @details Packs the source of every shader into one cooked file, so programs are built from a single mapped file
+ *          instead of opening each shader on disk. A shader that was edited after the bundle was cooked is still read
+ *          from its own file.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_SHADERBUNDLE_H
+#define CBIT_SHADERBUNDLE_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cbit {
+    /**
+     * @class ShaderBundle
+     * @brief Reader and writer of the cooked shader bundle.
+     */
+    class ShaderBundle {
+    public:
+        /**
+         * Get the path of the bundle, relative to the working directory.
+         */
+        static std::string getBundlePath();
+
+        /**
+         * Write a bundle.
+         * @param path Destination path; missing directories are created.
+         * @param sources Pairs of the path the engine loads a shader by and the file to read it from.
+         * @return true if every shader was read and the bundle was written.
+         */
+        static bool write(const std::string &path, const std::vector<std::pair<std::string, std::string> > &sources);
+
+        /**
+         * Look up a shader in the bundle. The bundle is mapped on the first call.
+         * @param filename Path the shader is loaded by, e.g. resources/shaders/text.vert.
+         * @param source Receives the shader source if found.
+         * @return true if the bundle holds the shader and its file is not newer than the bundle.
+         */
+        static bool find(const std::string &filename, std::string &source);
+    };
+}
+
+#endif //CBIT_SHADERBUNDLE_H
@@ -38,6 +38,9 @@
 #include <fstream>
 #include <sstream>
 #include <glm/gtc/type_ptr.hpp>
+#include "GLCalls.h"
+#include "GLThread.h"
+#include "ShaderBundle.h"
 
 cbit::ShaderProgram::ShaderProgram()
     : _handle(0) {
@@ -49,7 +52,7 @@ cbit::ShaderProgram::ShaderProgram(const char *vsFilename, const char *fsFilenam
 
 
 cbit::ShaderProgram::~ShaderProgram() {
-    glDeleteProgram(_handle);
+    GLThread::release(GLObjectType::Program, _handle);
 }
 
 // Loads vertex and fragment shaders
@@ -57,45 +60,56 @@ bool cbit::ShaderProgram::loadShaders(const char *vsFilename, const char *fsFile
     const std::string vsString = _fileToString(vsFilename);
     const std::string fsString = _fileToString(fsFilename);
 
-    const GLchar *vsSourcePtr = vsString.c_str();
-    const GLchar *fsSourcePtr = fsString.c_str();
+    // Files are read on the calling thread; only compiling and linking needs the GL context.
+    bool linked = false;
+    GLThread::run([&] {
+        const GLchar *vsSourcePtr = vsString.c_str();
+        const GLchar *fsSourcePtr = fsString.c_str();
 
-    const GLuint vs = glCreateShader(GL_VERTEX_SHADER);
-    const GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+        const GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+        const GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
 
-    glShaderSource(vs, 1, &vsSourcePtr, nullptr);
-    glShaderSource(fs, 1, &fsSourcePtr, nullptr);
+        glShaderSource(vs, 1, &vsSourcePtr, nullptr);
+        glShaderSource(fs, 1, &fsSourcePtr, nullptr);
 
-    glCompileShader(vs);
-    _checkCompileErrors(vs, VERTEX);
+        glCompileShader(vs);
+        _checkCompileErrors(vs, VERTEX);
 
-    glCompileShader(fs);
-    _checkCompileErrors(fs, FRAGMENT);
+        glCompileShader(fs);
+        _checkCompileErrors(fs, FRAGMENT);
 
-    _handle = glCreateProgram();
-    if (_handle == 0) {
-        Logger::log()->error("Unable to create shader program!");
-        return false;
-    }
+        _handle = glCreateProgram();
+        if (_handle == 0) {
+            Logger::log()->error("Unable to create shader program!");
+            glDeleteShader(vs);
+            glDeleteShader(fs);
+            return;
+        }
 
-    glAttachShader(_handle, vs);
-    glAttachShader(_handle, fs);
+        glAttachShader(_handle, vs);
+        glAttachShader(_handle, fs);
 
-    glLinkProgram(_handle);
+        glLinkProgram(_handle);
 
-    glDeleteShader(vs);
-    glDeleteShader(fs);
+        glDeleteShader(vs);
+        glDeleteShader(fs);
 
-    _uniformLocations.clear();
+        _uniformLocations.clear();
 
-    _checkCompileErrors(_handle, PROGRAM);
+        _checkCompileErrors(_handle, PROGRAM);
+        linked = true;
+    });
 
-    return true;
+    return linked;
 }
 
 // Opens and reads contents of an ASCII file to a string.  Returns the string.
 // Not good for very large files.
 std::string cbit::ShaderProgram::_fileToString(const std::string &filename) {
+    if (std::string source; ShaderBundle::find(filename, source)) {
+        return source;
+    }
+
     std::stringstream ss;
 
     try {
@@ -120,7 +134,7 @@ std::string cbit::ShaderProgram::_fileToString(const std::string &filename) {
 // Activate the shader program
 void cbit::ShaderProgram::use() const {
     if (_handle > 0) {
-        glUseProgram(_handle);
+        gl::useProgram(_handle);
     }
 }
 
@@ -156,19 +170,25 @@ GLuint cbit::ShaderProgram::getProgram() const {
 // Sets a glm::vec2 shader uniform
 void cbit::ShaderProgram::setUniform(const GLchar *name, const glm::vec2 &vector) {
     const GLint loc = _getUniformLocation(name);
-    glUniform2f(loc, vector.x, vector.y);
+    gl::uniform2f(loc, vector.x, vector.y);
 }
 
 // Sets a glm::vec3 shader uniform
 void cbit::ShaderProgram::setUniform(const GLchar *name, const glm::vec3 &vector) {
     const GLint loc = _getUniformLocation(name);
-    glUniform3f(loc, vector.x, vector.y, vector.z);
+    gl::uniform3f(loc, vector.x, vector.y, vector.z);
 }
 
 // Sets a glm::vec4 shader uniform
 void cbit::ShaderProgram::setUniform(const GLchar *name, const glm::vec4 &vector) {
     const GLint loc = _getUniformLocation(name);
-    glUniform4f(loc, vector.x, vector.y, vector.z, vector.w);
+    gl::uniform4f(loc, vector.x, vector.y, vector.z, vector.w);
+}
+
+// Sets a glm::vec4 shader uniform array
+void cbit::ShaderProgram::setUniform(const GLchar *name, const glm::vec4 *vectors, const GLsizei count) {
+    const GLint loc = _getUniformLocation(name);
+    gl::uniform4fv(loc, count, glm::value_ptr(vectors[0]));
 }
 
 // Sets a glm::mat4 shader uniform
@@ -179,20 +199,20 @@ void cbit::ShaderProgram::setUniform(const GLchar *name, const glm::mat4 &materi
     // count = how many matrices (1 if not an array of mats)
     // transpose = False for opengl because column major
     // value = the matrix to set for the uniform
-    glUniformMatrix4fv(loc, 1, GL_FALSE, glm::value_ptr(material));
+    gl::uniformMatrix4fv(loc, 1, GL_FALSE, glm::value_ptr(material));
 }
 
 // Sets a GLfloat shader uniform
 void cbit::ShaderProgram::setUniform(const GLchar *name, const GLfloat glFloat) {
     const GLint loc = _getUniformLocation(name);
-    glUniform1f(loc, glFloat);
+    gl::uniform1f(loc, glFloat);
 }
 
 
 // Sets a GLint shader uniform
 void cbit::ShaderProgram::setUniform(const GLchar *name, const GLint glLint) {
     const GLint loc = _getUniformLocation(name);
-    glUniform1i(loc, glLint);
+    gl::uniform1i(loc, glLint);
 }
 
 
@@ -201,7 +221,7 @@ void cbit::ShaderProgram::setUniformSampler(const GLchar *name, const GLint &slo
     glActiveTexture(GL_TEXTURE0 + slot);
 
     const GLint loc = _getUniformLocation(name);
-    glUniform1i(loc, slot);
+    gl::uniform1i(loc, slot);
 }
 
 bool cbit::ShaderProgram::hasUniform(const GLchar *name) const {
@@ -105,6 +105,14 @@ namespace cbit {
          */
         void setUniform(const GLchar *name, const glm::vec4 &vector);
 
+        /**
+         * Sets a uniform array in the shader program.
+         * @param name The name of the first array element, e.g. "uClipInfo[0]".
+         * @param vectors Pointer to count glm::vec4 values.
+         * @param count Number of array elements to set.
+         */
+        void setUniform(const GLchar *name, const glm::vec4 *vectors, GLsizei count);
+
         /**
          * Sets a uniform variable in the shader program.
          * @param name The name of the uniform variable.
@@ -143,7 +151,7 @@ namespace cbit {
 
     private:
         /**
-         * Gets the contents of a file as a string.
+         * Gets the contents of a file as a string, from the cooked shader bundle when it holds a current copy.
          * @param filename filename of the shader file to read.
          * @return string containing the contents of the file.
          */
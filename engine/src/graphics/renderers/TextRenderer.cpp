@@ -6,8 +6,11 @@
  */
 
 #include "TextRenderer.h"
-#include <ft2build.h>
-#include FT_FREETYPE_H
+#include <algorithm>
+#include "GLCalls.h"
+#include "GLThread.h"
+#include "GlyphAtlas.h"
+#include "utilities/AssetPaths.h"
 #include "glm/ext/matrix_clip_space.hpp"
 
 cbit::TextRenderer::TextRenderer(const GLuint screenWidth, const GLuint screenHeight) : VAO(0), VBO(0), EBO(0) {
@@ -26,57 +29,67 @@ cbit::TextRenderer::TextRenderer(const GLuint screenWidth, const GLuint screenHe
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
     // 6 vertices, 4 bytes per vertex (x, y, z, w)
     glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 6 * 4, nullptr, GL_DYNAMIC_DRAW);
+    _gpuBytes = sizeof(GLfloat) * 6 * 4;
+    MemoryTracker::trackGpu(MemoryCategory::Glyphs, _gpuBytes);
     // position attribute
     glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), static_cast<void *>(nullptr));
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glEnableVertexAttribArray(0);
 }
 
+cbit::TextRenderer::~TextRenderer() {
+    GLThread::release(GLObjectType::Texture, _atlasTexture);
+    GLThread::release(GLObjectType::VertexArray, VAO);
+    GLThread::release(GLObjectType::Buffer, VBO);
+    MemoryTracker::trackGpu(MemoryCategory::Glyphs, -_gpuBytes);
+}
+
 void cbit::TextRenderer::loadFont(const std::string &fontPath, GLuint fontSize) {
-    FT_Library ft;
-    if (FT_Init_FreeType(&ft)) {
-        Logger::log()->error("Could not initialize FreeType Library");
-        return;
+    GlyphAtlas atlas;
+    const std::string cookedPath = GlyphAtlas::getCookedPath(fontPath, fontSize);
+    if (!AssetPaths::isCookedCurrent(fontPath, cookedPath) || !atlas.load(cookedPath)) {
+        if (!atlas.rasterize(fontPath, fontSize)) {
+            return;
+        }
+        if (atlas.save(cookedPath)) {
+            Logger::log()->info("Cooked {} to {}", fontPath, cookedPath);
+        }
     }
-    FT_Face face;
-    if (FT_New_Face(ft, fontPath.c_str(), 0, &face)) {
-        Logger::log()->error("Failed to load font: {}", fontPath);
-        return;
+
+    if (_atlasTexture == 0) {
+        glGenTextures(1, &_atlasTexture);
     }
-    FT_Set_Pixel_Sizes(face, 0, fontSize);
+    glBindTexture(GL_TEXTURE_2D, _atlasTexture);
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // Disable byte-alignment restriction
-    for (GLubyte c = 0; c < 128; ++c) {
-        if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
-            Logger::log()->error("Failed to load Glyph: {}", c);
-            continue;
-        }
-        GLuint texture;
-        glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
-        glTexImage2D(
-            GL_TEXTURE_2D, 0, GL_RED,
-            face->glyph->bitmap.width,
-            face->glyph->bitmap.rows,
-            0, GL_RED, GL_UNSIGNED_BYTE,
-            face->glyph->bitmap.buffer
-        );
-        // Set texture options
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, static_cast<GLsizei>(atlas.getWidth()),
+                 static_cast<GLsizei>(atlas.getHeight()), 0, GL_RED, GL_UNSIGNED_BYTE, atlas.getPixels().data());
+    // Set texture options
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // One byte per texel; replaces the atlas of any previously loaded font.
+    const auto atlasBytes = static_cast<std::int64_t>(atlas.getWidth()) * atlas.getHeight();
+    MemoryTracker::trackGpu(MemoryCategory::Glyphs, atlasBytes - _atlasBytes);
+    _gpuBytes += atlasBytes - _atlasBytes;
+    _atlasBytes = atlasBytes;
+
+    const glm::vec2 atlasSize(static_cast<float>(std::max(1u, atlas.getWidth())),
+                              static_cast<float>(std::max(1u, atlas.getHeight())));
+    Characters.clear();
+    for (const AtlasGlyph &glyph: atlas.getGlyphs()) {
+        const glm::vec2 origin(static_cast<float>(glyph.x), static_cast<float>(glyph.y));
         Character character = {
-            texture,
-            glm::ivec2(face->glyph->bitmap.width, face->glyph->bitmap.rows),
-            glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top),
-            static_cast<GLuint>(face->glyph->advance.x)
+            _atlasTexture,
+            glm::ivec2(glyph.width, glyph.height),
+            glm::ivec2(glyph.bearingX, glyph.bearingY),
+            glyph.advance,
+            origin / atlasSize,
+            (origin + glm::vec2(static_cast<float>(glyph.width), static_cast<float>(glyph.height))) / atlasSize
         };
-        Characters.insert(std::pair<GLchar, Character>(c, character));
+        Characters.insert(std::pair<GLchar, Character>(static_cast<GLchar>(glyph.code), character));
     }
-
-    FT_Done_Face(face);
-    FT_Done_FreeType(ft);
 }
 
 void cbit::TextRenderer::renderText(const std::string &text, GLfloat x, const GLfloat y, const GLfloat scale,
@@ -84,6 +97,7 @@ void cbit::TextRenderer::renderText(const std::string &text, GLfloat x, const GL
     textShader.use();
     textShader.setUniform("textColor", color);
     glActiveTexture(GL_TEXTURE0);
+    gl::bindTexture(GL_TEXTURE_2D, _atlasTexture);
     glBindVertexArray(VAO);
 
     for (auto c: text) {
@@ -93,7 +107,7 @@ void cbit::TextRenderer::renderText(const std::string &text, GLfloat x, const GL
         }
 
 
-        auto &[textureID, size, bearing, advance] = Characters[c];
+        auto &[textureID, size, bearing, advance, uvMin, uvMax] = it->second;
         const GLfloat xPosition = x + bearing.x * scale;
         const GLfloat yPosition = y + (bearing.y - size.y) * scale;
         const GLfloat width = size.x * scale;
@@ -101,18 +115,17 @@ void cbit::TextRenderer::renderText(const std::string &text, GLfloat x, const GL
 
         // update VBO for each character quad
         const GLfloat vertices[6][4] = {
-            {xPosition, yPosition + height, 0.0f, 0.0f},
-            {xPosition, yPosition, 0.0f, 1.0f},
-            {xPosition + width, yPosition, 1.0f, 1.0f},
+            {xPosition, yPosition + height, uvMin.x, uvMin.y},
+            {xPosition, yPosition, uvMin.x, uvMax.y},
+            {xPosition + width, yPosition, uvMax.x, uvMax.y},
 
-            {xPosition, yPosition + height, 0.0f, 0.0f},
-            {xPosition + width, yPosition, 1.0f, 1.0f},
-            {xPosition + width, yPosition + height, 1.0f, 0.0f}
+            {xPosition, yPosition + height, uvMin.x, uvMin.y},
+            {xPosition + width, yPosition, uvMax.x, uvMax.y},
+            {xPosition + width, yPosition + height, uvMax.x, uvMin.y}
         };
-        glBindTexture(GL_TEXTURE_2D, textureID);
         glBindBuffer(GL_ARRAY_BUFFER, VBO);
         glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
+        gl::drawArrays(GL_TRIANGLES, 0, 6);
         x += (advance >> 6) * scale; // advance is in 1/64 pixels
     }
 
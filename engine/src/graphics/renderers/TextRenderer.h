@@ -26,18 +26,24 @@
 
 #include "ShaderProgram.h"
 #include "OpenGLInclude.h"
+#include "core/MemoryTracker.h"
 #include "glm/vec2.hpp"
 
 namespace cbit {
+    // Pixel size of the UI font. The asset cooker builds glyph atlases at this size by default.
+    constexpr GLuint kDefaultFontSize = 50;
+
     /**
      * @struct Character
      * @brief  Represents a single character glyph.
      */
     struct Character {
-        GLuint textureID; // ID handle of glyph texture
+        GLuint textureID; // ID handle of the glyph atlas
         glm::ivec2 size; // Size of glyph
         glm::ivec2 bearing; // Offset from baseline to left/top of glyph
         GLuint advance; // Horizontal offset to advance to next glyph
+        glm::vec2 uvMin; // Top-left corner of the glyph in the atlas
+        glm::vec2 uvMax; // Bottom-right corner of the glyph in the atlas
     };
 
     /**
@@ -61,7 +67,8 @@ namespace cbit {
      */
     class TextRenderer {
     public:
-        std::map<GLchar, Character> Characters;
+        std::map<GLchar, Character, std::less<GLchar>,
+            TrackedAllocator<std::pair<const GLchar, Character>, MemoryCategory::Glyphs> > Characters;
         ShaderProgram textShader;
         GLuint VAO, VBO, EBO;
 
@@ -72,10 +79,20 @@ namespace cbit {
          */
         TextRenderer(GLuint screenWidth, GLuint screenHeight);
 
+        /**
+         * @brief Releases the glyph textures and the quad buffer.
+         */
+        ~TextRenderer();
+
+        TextRenderer(const TextRenderer &) = delete;
+        TextRenderer &operator=(const TextRenderer &) = delete;
+
         /**
          * @brief loads a font from the specified file path and size.
          * @param fontPath The path to the font file.
          * @param fontSize The size of the font to load.
+         * @details All glyphs share one atlas texture. The atlas is read from its cooked file when that is not older
+         *          than the font; otherwise the font is rasterized with FreeType and the atlas is cooked.
          */
         void loadFont(const std::string &fontPath, GLuint fontSize);
 
@@ -95,6 +112,11 @@ namespace cbit {
          * @param height The new height of the viewport.
          */
         void resize(GLuint width, GLuint height);
+
+    private:
+        GLuint _atlasTexture = 0;
+        std::int64_t _atlasBytes = 0;
+        std::int64_t _gpuBytes = 0; // Glyph atlas and quad buffer, reported to the MemoryTracker.
     };
 }
 
@@ -12,13 +12,29 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
+#include <cstring>
+#include <vector>
+
+#include "CookedTexture.h"
+#include "GLCalls.h"
+#include "core/MemoryTracker.h"
+#include "utilities/AssetPaths.h"
 #include "utilities/Logger.h"
 
-cbit::Texture::Texture() : _textureID(0) {
+cbit::Texture::Texture() : _textureID(0), _gpuBytes(0) {
 }
 
 cbit::Texture::~Texture() {
-    glDeleteTextures(1, &_textureID);
+    _release();
+}
+
+void cbit::Texture::_release() {
+    MemoryTracker::trackGpu(MemoryCategory::Textures, -_gpuBytes);
+    _gpuBytes = 0;
+    if (_textureID) {
+        glDeleteTextures(1, &_textureID);
+        _textureID = 0;
+    }
 }
 
 bool cbit::Texture::loadTexture(const std::string &path, const bool flipVertically) {
@@ -34,12 +50,24 @@ bool cbit::Texture::loadTexture(const std::string &path, const bool flipVertical
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
+    CookedTexture cooked;
+    const std::string cookedPath = AssetPaths::getCookedPath(path, kCookedTextureExtension);
+    if (AssetPaths::isCookedCurrent(path, cookedPath) && cooked.open(cookedPath)) {
+        _uploadCooked(cooked, flipVertically);
+        return true;
+    }
+
     int width, height, nrChannels;
     unsigned char *data = stbi_load(path.c_str(), &width, &height, &nrChannels, 0);
     if (data) {
         glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, nrChannels == 4 ? GL_RGBA : GL_RGB, GL_UNSIGNED_BYTE,
                      data);
         glGenerateMipmap(GL_TEXTURE_2D);
+
+        // RGB storage plus a third for the mip chain.
+        MemoryTracker::trackGpu(MemoryCategory::Textures, -_gpuBytes);
+        _gpuBytes = static_cast<std::int64_t>(width) * height * 3 * 4 / 3;
+        MemoryTracker::trackGpu(MemoryCategory::Textures, _gpuBytes);
     } else {
         Logger::log()->error("Failed to load texture at path: {}", path);
         return false;
@@ -48,6 +76,38 @@ bool cbit::Texture::loadTexture(const std::string &path, const bool flipVertical
     return true;
 }
 
+void cbit::Texture::_uploadCooked(const CookedTexture &cooked, const bool flipVertically) {
+    const CookedTextureHeader &header = cooked.getHeader();
+    const GLenum format = header.channels == 4 ? GL_RGBA : GL_RGB;
+
+    // Cooked levels are tightly packed and stored bottom row first, which is the flipped orientation; unflipped
+    // loads reverse the rows of each level into a scratch buffer.
+    std::vector<unsigned char> rows;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    std::int64_t gpuBytes = 0;
+    for (std::uint32_t i = 0; i < header.levelCount; ++i) {
+        const CookedTextureLevel level = cooked.getLevel(i);
+        const unsigned char *pixels = cooked.getPixels(i);
+        if (!flipVertically) {
+            const size_t rowSize = static_cast<size_t>(level.width) * header.channels;
+            rows.resize(static_cast<size_t>(level.size));
+            for (std::uint32_t y = 0; y < level.height; ++y) {
+                std::memcpy(rows.data() + y * rowSize, pixels + (level.height - 1 - y) * rowSize, rowSize);
+            }
+            pixels = rows.data();
+        }
+        glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), GL_RGB, static_cast<GLsizei>(level.width),
+                     static_cast<GLsizei>(level.height), 0, format, GL_UNSIGNED_BYTE, pixels);
+        gpuBytes += static_cast<std::int64_t>(level.width) * level.height * 3;
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(header.levelCount - 1));
+
+    MemoryTracker::trackGpu(MemoryCategory::Textures, -_gpuBytes);
+    _gpuBytes = gpuBytes;
+    MemoryTracker::trackGpu(MemoryCategory::Textures, _gpuBytes);
+}
+
 void cbit::Texture::bind() const {
-    glBindTexture(GL_TEXTURE_2D, _textureID);
+    gl::bindTexture(GL_TEXTURE_2D, _textureID);
 }
@@ -12,9 +12,12 @@
 #define CBIT_TEXTURE_H
 
 #include "OpenGLInclude.h"
+#include <cstdint>
 #include <string>
 
 namespace cbit {
+    class CookedTexture;
+
     /**
      * @class Texture
      * @brief Represents a texture in the game.
@@ -47,14 +50,18 @@ namespace cbit {
 
         // enable move
         Texture(Texture &&o) noexcept
-            : _textureID(o._textureID) { o._textureID = 0; }
+            : _textureID(o._textureID), _gpuBytes(o._gpuBytes) {
+            o._textureID = 0;
+            o._gpuBytes = 0;
+        }
 
         Texture &operator=(Texture &&o) noexcept {
             if (this != &o) {
-                if (_textureID)
-                    glDeleteTextures(1, &_textureID);
+                _release();
                 _textureID = o._textureID;
+                _gpuBytes = o._gpuBytes;
                 o._textureID = 0;
+                o._gpuBytes = 0;
             }
             return *this;
         }
@@ -65,6 +72,8 @@ namespace cbit {
          * @return True if the texture was loaded successfully, false otherwise.
          * @details This method uses stb_image to load the texture image and creates an OpenGL texture object.
          *          It sets the texture parameters such as wrapping and filtering options.
+         *          A cooked copy of the image is uploaded with its prebuilt mip chain instead when it is not older
+         *          than the source.
          */
         bool loadTexture(const std::string &path, bool flipVertically = true);
 
@@ -84,6 +93,11 @@ namespace cbit {
 
     private:
         GLuint _textureID;
+        std::int64_t _gpuBytes; // Reported to the MemoryTracker, mipmaps included.
+
+        void _release();
+
+        void _uploadCooked(const CookedTexture &cooked, bool flipVertically);
     };
 }
 #endif //CBIT_TEXTURE_H
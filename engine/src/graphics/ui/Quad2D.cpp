@@ -8,6 +8,8 @@
 // UIQuad.cpp
 #include "Quad2D.h"
 
+#include "graphics/renderers/GLCalls.h"
+
 // 6 vertices × (2 pos + 2 uv)
 static constexpr float quadVertices[] = {
     //  pos      uv
@@ -42,6 +44,6 @@ cbit::Quad2D::~Quad2D() {
 
 void cbit::Quad2D::draw() const {
     glBindVertexArray(VAO);
-    glDrawArrays(GL_TRIANGLES, 0, 6);
+    gl::drawArrays(GL_TRIANGLES, 0, 6);
     glBindVertexArray(0);
 }
@@ -0,0 +1,68 @@
+/**
+ * @file    AssetPaths.cpp
+ * @brief   Implementation of the AssetPaths class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "AssetPaths.h"
+
+#include <cstdio>
+#include <filesystem>
+#include "Hash.h"
+
+namespace {
+    constexpr std::string_view kCookedRoot = "cooked";
+
+    // Sources outside the working directory are cooked here under a hashed name.
+    constexpr std::string_view kExternalDirectory = "external";
+
+    /**
+     * @brief  Returns the path of a source below the working directory, or an empty path if it is not below it.
+     */
+    std::filesystem::path workingRelativePath(const std::filesystem::path &normalPath) {
+        std::filesystem::path relative = normalPath;
+        if (normalPath.has_root_path()) {
+            std::error_code error;
+            const std::filesystem::path workingDirectory = std::filesystem::current_path(error);
+            if (error) {
+                return {};
+            }
+            relative = normalPath.lexically_relative(workingDirectory.lexically_normal());
+        }
+        // Normalized paths only have ".." at the front.
+        if (relative.empty() || relative.has_root_path() || *relative.begin() == "..") {
+            return {};
+        }
+        return relative;
+    }
+}
+
+std::string_view cbit::AssetPaths::getCookedRoot() {
+    return kCookedRoot;
+}
+
+std::string cbit::AssetPaths::getCookedPath(const std::string &sourcePath, const std::string_view extension) {
+    const std::filesystem::path normalPath = std::filesystem::path(sourcePath).lexically_normal();
+    std::filesystem::path relative = workingRelativePath(normalPath);
+    if (relative.empty()) {
+        // Mirroring "../" or an absolute path would write outside the cooked root.
+        char hash[17];
+        std::snprintf(hash, sizeof(hash), "%016llx",
+                      static_cast<unsigned long long>(hashString(normalPath.generic_string())));
+        relative = std::filesystem::path(kExternalDirectory) /
+                   (normalPath.filename().string() + "-" + hash);
+    }
+    relative += std::string(extension);
+    return (std::filesystem::path(kCookedRoot) / relative).generic_string();
+}
+
+bool cbit::AssetPaths::isCookedCurrent(const std::string &sourcePath, const std::string &cookedPath) {
+    std::error_code error;
+    const auto cookedTime = std::filesystem::last_write_time(cookedPath, error);
+    if (error) {
+        return false;
+    }
+    const auto sourceTime = std::filesystem::last_write_time(sourcePath, error);
+    return error || cookedTime >= sourceTime;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file    AssetPaths.h
+ * @brief   Header file for the AssetPaths class.
+ * @details Maps source assets to the engine-native files cooked from them. Cooked files mirror the source tree under
+ *          a single root, e.g. assets/models/fox.glb is cooked to cooked/assets/models/fox.glb.cbmesh.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_ASSETPATHS_H
+#define CBIT_ASSETPATHS_H
+
+#include <string>
+#include <string_view>
+
+namespace cbit {
+    /**
+     * @class AssetPaths
+     * @brief Locations of cooked assets.
+     */
+    class AssetPaths {
+    public:
+        /**
+         * Get the directory cooked files are written to, relative to the working directory.
+         */
+        static std::string_view getCookedRoot();
+
+        /**
+         * Get the path of the cooked file for a source asset.
+         * @param sourcePath Path to the source asset, as passed to its loader.
+         * @param extension Extension of the cooked format, including the dot.
+         * @return Path under the cooked root. Sources below the working directory mirror their relative path;
+         *         others, e.g. "../shared/rock.obj", go to the external directory under a name hashed from the path.
+         */
+        static std::string getCookedPath(const std::string &sourcePath, std::string_view extension);
+
+        /**
+         * Check if a cooked file can be used instead of its source.
+         * @param sourcePath Path to the source asset.
+         * @param cookedPath Path to the cooked file.
+         * @return true if the cooked file exists and is not older than the source. A missing source counts as
+         *         current, so builds can ship cooked files only.
+         */
+        static bool isCookedCurrent(const std::string &sourcePath, const std::string &cookedPath);
+    };
+}
+
+#endif //CBIT_ASSETPATHS_H
@@ -0,0 +1,183 @@
+/**
+ * @file    AsyncRingSink.cpp
+ * @brief   Implementation of the AsyncRingSink class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "AsyncRingSink.h"
+
+#include <chrono>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/fmt/fmt.h>
+
+namespace {
+    constexpr auto kIdleWait = std::chrono::milliseconds(10);
+    constexpr auto kFlushInterval = std::chrono::seconds(1);
+    constexpr char kLoggerName[] = "Logger";
+}
+
+cbit::AsyncRingSink::AsyncRingSink(std::vector<spdlog::sink_ptr> sinks)
+    : _sinks(std::move(sinks)), _slots(std::make_unique<Slot[]>(kCapacity)) {
+    for (std::size_t i = 0; i < kCapacity; ++i) {
+        _slots[i].sequence.store(i, std::memory_order_relaxed);
+        _slots[i].payload.reserve(kReservedMessageSize);
+    }
+    _thread = std::thread(&AsyncRingSink::_run, this);
+}
+
+cbit::AsyncRingSink::~AsyncRingSink() {
+    {
+        std::lock_guard lock(_mutex);
+        _stopping = true;
+    }
+    _wake.notify_one();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void cbit::AsyncRingSink::log(const spdlog::details::log_msg &message) {
+    // Bounded queue of Dmitry Vyukov: a slot is free for position p when its sequence equals p, and ready for the
+    // consumer when it equals p + 1.
+    std::size_t position = _enqueuePosition.load(std::memory_order_relaxed);
+    Slot *slot = nullptr;
+    while (true) {
+        slot = &_slots[position % kCapacity];
+        const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+        if (difference == 0) {
+            if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // Full. Chatty levels are dropped; warnings and errors wait for the background thread to catch up.
+            if (message.level < spdlog::level::warn) {
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                _droppedTotal.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            _wake.notify_one();
+            std::this_thread::yield();
+            position = _enqueuePosition.load(std::memory_order_relaxed);
+        } else {
+            position = _enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->time = message.time;
+    slot->level = message.level;
+    slot->loggerName = message.logger_name;
+    slot->threadId = message.thread_id;
+    slot->payload.assign(message.payload.data(), message.payload.size());
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    if (_sleeping.load(std::memory_order_seq_cst)) {
+        _wake.notify_one();
+    }
+}
+
+void cbit::AsyncRingSink::flush() {
+    const std::size_t target = _enqueuePosition.load(std::memory_order_acquire);
+    std::unique_lock lock(_mutex);
+    _wake.notify_one();
+    _drained.wait(lock, [&] {
+        return _written.load(std::memory_order_acquire) >= target || _stopping;
+    });
+}
+
+void cbit::AsyncRingSink::set_pattern(const std::string &pattern) {
+    // The background thread writes to the wrapped sinks while holding the mutex.
+    std::lock_guard lock(_mutex);
+    for (const auto &sink: _sinks) {
+        sink->set_pattern(pattern);
+    }
+}
+
+void cbit::AsyncRingSink::set_formatter(std::unique_ptr<spdlog::formatter> formatter) {
+    std::lock_guard lock(_mutex);
+    for (std::size_t i = 0; i < _sinks.size(); ++i) {
+        _sinks[i]->set_formatter(i + 1 == _sinks.size() ? std::move(formatter) : formatter->clone());
+    }
+}
+
+void cbit::AsyncRingSink::_run() {
+    auto lastFlush = std::chrono::steady_clock::now();
+    std::size_t flushedUpTo = 0;
+
+    while (true) {
+        bool urgent;
+        {
+            std::lock_guard lock(_mutex);
+            urgent = _drain();
+        }
+        const std::size_t written = _written.load(std::memory_order_relaxed);
+
+        const auto now = std::chrono::steady_clock::now();
+        if (urgent || (written != flushedUpTo && now - lastFlush >= kFlushInterval)) {
+            std::lock_guard lock(_mutex);
+            _flushSinks();
+            lastFlush = now;
+            flushedUpTo = written;
+        }
+        _drained.notify_all();
+
+        std::unique_lock lock(_mutex);
+        if (_stopping) {
+            _drain();
+            _flushSinks();
+            break;
+        }
+        // A producer that misses the flag is picked up by the timed wait at worst.
+        _sleeping.store(true, std::memory_order_seq_cst);
+        _wake.wait_for(lock, kIdleWait, [&] {
+            return _stopping || _slots[_dequeuePosition % kCapacity].sequence.load(std::memory_order_acquire) ==
+                                _dequeuePosition + 1;
+        });
+        _sleeping.store(false, std::memory_order_relaxed);
+    }
+    _drained.notify_all();
+}
+
+bool cbit::AsyncRingSink::_drain() {
+    bool urgent = false;
+
+    while (true) {
+        Slot &slot = _slots[_dequeuePosition % kCapacity];
+        if (slot.sequence.load(std::memory_order_acquire) != _dequeuePosition + 1) {
+            break;
+        }
+
+        spdlog::details::log_msg message(slot.time, spdlog::source_loc{}, slot.loggerName, slot.level,
+                                         spdlog::string_view_t(slot.payload.data(), slot.payload.size()));
+        message.thread_id = slot.threadId;
+        for (const auto &sink: _sinks) {
+            if (sink->should_log(message.level)) {
+                sink->log(message);
+            }
+        }
+        urgent = urgent || slot.level >= spdlog::level::warn;
+
+        slot.payload.clear();
+        slot.sequence.store(_dequeuePosition + kCapacity, std::memory_order_release);
+        ++_dequeuePosition;
+        _written.store(_dequeuePosition, std::memory_order_release);
+    }
+
+    const std::uint64_t dropped = _dropped.exchange(0, std::memory_order_relaxed);
+    if (dropped != 0) {
+        const std::string text = fmt::format("Log ring full, dropped {} messages", dropped);
+        const spdlog::details::log_msg message(spdlog::source_loc{}, kLoggerName, spdlog::level::warn, text);
+        for (const auto &sink: _sinks) {
+            sink->log(message);
+        }
+        urgent = true;
+    }
+    return urgent;
+}
+
+void cbit::AsyncRingSink::_flushSinks() {
+    for (const auto &sink: _sinks) {
+        sink->flush();
+    }
+}
@@ -0,0 +1,105 @@
+/**
+ * @file    AsyncRingSink.h
+ * @brief   Header file for the AsyncRingSink class.
+ * @details spdlog sink that hands messages to a background thread through a bounded lock-free ring. Logging
+ *          threads only copy the formatted payload into a slot; pattern formatting and console and file I/O happen
+ *          on the background thread.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_ASYNCRINGSINK_H
+#define CBIT_ASYNCRINGSINK_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <spdlog/sinks/sink.h>
+
+namespace cbit {
+    /**
+     * @class AsyncRingSink
+     * @brief Multi-producer, single-consumer log sink backed by a fixed ring of message slots.
+     * @details Producers claim a slot with a compare-and-swap and never take a lock. When the ring is full, trace,
+     *          debug and info messages are dropped and counted, and the background thread reports how many were
+     *          lost; warnings and errors yield until a slot frees up. Slots keep their string buffers, so only
+     *          messages longer than any seen before allocate.
+     *
+     *          The background thread forwards messages to the wrapped sinks in order. It flushes them once a second
+     *          and after any warning or error. flush() waits until every message logged before it was written.
+     */
+    class AsyncRingSink final : public spdlog::sinks::sink {
+    public:
+        static constexpr std::size_t kCapacity = 4096;
+        static constexpr std::size_t kReservedMessageSize = 256;
+
+        /**
+         * Start the background thread.
+         * @param sinks Sinks that receive the messages; they are only called from the background thread.
+         */
+        explicit AsyncRingSink(std::vector<spdlog::sink_ptr> sinks);
+
+        /**
+         * Write every queued message, flush the wrapped sinks and stop the background thread.
+         */
+        ~AsyncRingSink() override;
+
+        AsyncRingSink(const AsyncRingSink &) = delete;
+        AsyncRingSink &operator=(const AsyncRingSink &) = delete;
+
+        void log(const spdlog::details::log_msg &message) override;
+        void flush() override;
+        void set_pattern(const std::string &pattern) override;
+        void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override;
+
+        /**
+         * Get the number of messages below warning level dropped because the ring was full.
+         * @return Messages dropped since construction.
+         */
+        std::uint64_t getDroppedCount() const { return _droppedTotal.load(std::memory_order_relaxed); }
+
+    private:
+        struct Slot {
+            std::atomic<std::size_t> sequence{0};
+            spdlog::log_clock::time_point time;
+            spdlog::level::level_enum level = spdlog::level::info;
+            spdlog::string_view_t loggerName;
+            std::size_t threadId = 0;
+            std::string payload;
+        };
+
+        std::vector<spdlog::sink_ptr> _sinks;
+        std::unique_ptr<Slot[]> _slots;
+
+        alignas(64) std::atomic<std::size_t> _enqueuePosition{0};
+        alignas(64) std::size_t _dequeuePosition = 0;
+        std::atomic<std::size_t> _written{0};
+        std::atomic<std::uint64_t> _dropped{0};
+        std::atomic<std::uint64_t> _droppedTotal{0};
+
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::condition_variable _drained;
+        std::atomic<bool> _sleeping{false};
+        bool _stopping = false;
+        std::thread _thread;
+
+        void _run();
+
+        /**
+         * Forward every message queued so far to the wrapped sinks.
+         * @return true if a warning or more severe message was written.
+         */
+        bool _drain();
+
+        void _flushSinks();
+    };
+}
+
+#endif //CBIT_ASYNCRINGSINK_H
@@ -0,0 +1,45 @@
+/**
+ * @file    AtomicFile.cpp
+ * @brief   Implementation of writing files atomically.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "AtomicFile.h"
+
+#include <fstream>
+#include "utilities/Logger.h"
+
+bool cbit::writeFileAtomically(const std::filesystem::path &path,
+                               const std::function<bool(std::ostream &)> &write) {
+    std::error_code error;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), error);
+    }
+
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += ".tmp";
+    std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        Logger::log()->error("Unable to write {}", path.string());
+        return false;
+    }
+
+    const bool written = write(file);
+    file.close();
+    if (!written || !file) {
+        if (written) {
+            Logger::log()->error("Unable to write {}", path.string());
+        }
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error) {
+        Logger::log()->error("Unable to replace {}: {}", path.string(), error.message());
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,30 @@
+/**
+ * @file    AtomicFile.h
+ * @brief   Header file for writing files atomically.
+ * @details Cooked assets and the cook manifest are written through here so a crash or a failed write never leaves a
+ *          truncated file where a reader expects a complete one.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_ATOMICFILE_H
+#define CBIT_ATOMICFILE_H
+
+#include <filesystem>
+#include <functional>
+#include <ostream>
+
+namespace cbit {
+    /**
+     * Write a file through a temporary next to it, creating parent directories as needed. The data is written to
+     * path + ".tmp" and renamed over the destination, so a reader never maps or sees a half-written file. The
+     * temporary is removed on any failure.
+     * @param path Destination file.
+     * @param write Writes the file contents to the stream; returns false to abandon the write. A failure it reports
+     *              is expected to be logged by the writer itself.
+     * @return True if the destination now holds the new contents.
+     */
+    bool writeFileAtomically(const std::filesystem::path &path, const std::function<bool(std::ostream &)> &write);
+}
+
+#endif //CBIT_ATOMICFILE_H
@@ -0,0 +1,58 @@
+/**
+ * @file    Hash.h
+ * @brief   Compile-time string hashing.
+ * @details FNV-1a over the bytes of a string, usable in constant expressions. TagHash is the interned form of a
+ *          TagComponent tag; the _tag literal hashes a tag at compile time for hot lookups:
+ *          @code
+ *          using namespace cbit::literals;
+ *          auto enemy = world.getGameObject("enemy"_tag);
+ *          @endcode
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_HASH_H
+#define CBIT_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace cbit {
+    /**
+     * Hash a string with 64-bit FNV-1a.
+     * @param text String to hash.
+     * @return Hash value.
+     */
+    constexpr std::uint64_t hashString(const std::string_view text) {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (const char character: text) {
+            hash ^= static_cast<std::uint8_t>(character);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /**
+     * @enum  TagHash
+     * @brief Hashed entity tag.
+     */
+    enum class TagHash : std::uint64_t {};
+
+    /**
+     * Hash an entity tag.
+     * @param tag Tag string.
+     * @return Hashed tag.
+     */
+    constexpr TagHash hashTag(const std::string_view tag) {
+        return static_cast<TagHash>(hashString(tag));
+    }
+
+    namespace literals {
+        constexpr TagHash operator""_tag(const char *text, const std::size_t length) {
+            return hashTag(std::string_view(text, length));
+        }
+    }
+}
+
+#endif //CBIT_HASH_H
@@ -8,7 +8,9 @@
  */
 
 #include "logger.h"
+#include <chrono>
 #include <spdlog/sinks/stdout_color_sinks.h>
+#include "AsyncRingSink.h"
 
 std::shared_ptr<spdlog::logger> cbit::Logger::mLogger;
 
@@ -16,13 +18,34 @@ void cbit::Logger::initialize() {
     const auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
     const auto file_sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>("logs/logfile.txt", true);
 
-    // create a logger with two sinks
-    std::vector<spdlog::sink_ptr> sinks{console_sink, file_sink};
-    mLogger = std::make_shared<spdlog::logger>("Cbit Engine", begin(sinks), end(sinks));
+    // create a logger whose two sinks are written from a background thread
+    const auto async_sink = std::make_shared<cbit::AsyncRingSink>(std::vector<spdlog::sink_ptr>{console_sink, file_sink});
+    mLogger = std::make_shared<spdlog::logger>("Cbit Engine", async_sink);
 
     // set pattern for logging
-    spdlog::set_pattern("%^[%T] %n: %v%$");
+    mLogger->set_pattern("%^[%T] %n: %v%$");
 
     // set the logging level
     mLogger->set_level(spdlog::level::trace);
 }
+
+bool cbit::LogRateLimiter::allow(std::uint64_t &suppressed) {
+    const std::int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    std::int64_t nextAllowed = _nextAllowed.load(std::memory_order_relaxed);
+
+    if (now < nextAllowed) {
+        _suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    const auto interval = static_cast<std::int64_t>(_intervalSeconds * 1e9);
+    if (!_nextAllowed.compare_exchange_strong(nextAllowed, now + interval, std::memory_order_relaxed)) {
+        // Another thread logged this message first.
+        _suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    suppressed = _suppressed.exchange(0, std::memory_order_relaxed);
+    return true;
+}
@@ -3,21 +3,43 @@
  * @brief   Header file for the Logger class.
  * @details This file contains the definition of the Logger class which is responsible for logging messages to the console and a log file.
  *          The Logger class uses the spdlog library to log messages.
+ *          The CBIT_LOG_* macros strip messages below CBIT_LOG_ACTIVE_LEVEL at compile time, and their _RATE_LIMITED
+ *          variants keep per-frame messages from flooding the log.
  * @author  Nur Akmal bin Jalil
  * @date    2024-07-27
  */
 #ifndef CBIT_LOGGER_H
 #define CBIT_LOGGER_H
 
+#include <atomic>
+#include <cstdint>
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/basic_file_sink.h>
 
+#define CBIT_LOG_LEVEL_TRACE 0
+#define CBIT_LOG_LEVEL_DEBUG 1
+#define CBIT_LOG_LEVEL_INFO 2
+#define CBIT_LOG_LEVEL_WARN 3
+#define CBIT_LOG_LEVEL_ERROR 4
+#define CBIT_LOG_LEVEL_CRITICAL 5
+#define CBIT_LOG_LEVEL_OFF 6
+
+// Messages below this level are compiled out by the CBIT_LOG_* macros. Release builds keep info and above.
+#ifndef CBIT_LOG_ACTIVE_LEVEL
+#ifdef NDEBUG
+#define CBIT_LOG_ACTIVE_LEVEL CBIT_LOG_LEVEL_INFO
+#else
+#define CBIT_LOG_ACTIVE_LEVEL CBIT_LOG_LEVEL_TRACE
+#endif
+#endif
+
 namespace cbit {
     /**
      * @class Logger
      * @brief Singleton class for logging messages using spdlog.
      * @details The Logger class provides a global logging instance that can be used throughout the application.
      *          It initializes a console logger and a file logger to log messages to both the console and a log file.
+     *          Both are written by a background thread, so logging never waits on console or file I/O.
      *          The log file is named "cbit_log.txt" and is created in the current working directory.
      */
     class Logger {
@@ -42,13 +64,95 @@ namespace cbit {
          * @brief Get the spdlog logger instance.
          * @return Shared pointer to the spdlog logger.
          */
-        static std::shared_ptr<spdlog::logger> log() { return mLogger; }
+        static const std::shared_ptr<spdlog::logger> &log() { return mLogger; }
 
     private:
         Logger() = default;
 
         static std::shared_ptr<spdlog::logger> mLogger;
     };
+
+    /**
+     * @class LogRateLimiter
+     * @brief Lets one message through per interval and counts the ones it holds back.
+     * @details Used by the CBIT_LOG_*_RATE_LIMITED macros, which give every call site its own limiter.
+     */
+    class LogRateLimiter {
+    public:
+        explicit LogRateLimiter(const double intervalSeconds) : _intervalSeconds(intervalSeconds) {}
+
+        /**
+         * Check whether a message may be logged now.
+         * @param suppressed Set to the number of messages held back since the last one allowed.
+         * @return true if the message should be logged.
+         */
+        bool allow(std::uint64_t &suppressed);
+
+    private:
+        const double _intervalSeconds;
+        std::atomic<std::int64_t> _nextAllowed{0};
+        std::atomic<std::uint64_t> _suppressed{0};
+    };
 }
 
+#define CBIT_LOG_CALL_(level, ...) ::cbit::Logger::log()->level(__VA_ARGS__)
+
+#define CBIT_LOG_RATE_LIMITED_(level, seconds, ...)                                                                   \
+    do {                                                                                                               \
+        static ::cbit::LogRateLimiter cbitLogLimiter_(seconds);                                                       \
+        std::uint64_t cbitLogSuppressed_ = 0;                                                                          \
+        if (cbitLogLimiter_.allow(cbitLogSuppressed_)) {                                                               \
+            ::cbit::Logger::log()->level(__VA_ARGS__);                                                                 \
+            if (cbitLogSuppressed_ != 0) {                                                                             \
+                ::cbit::Logger::log()->level("({} similar messages suppressed)", cbitLogSuppressed_);                  \
+            }                                                                                                          \
+        }                                                                                                              \
+    } while (false)
+
+#if CBIT_LOG_ACTIVE_LEVEL <= CBIT_LOG_LEVEL_TRACE
+#define CBIT_LOG_TRACE(...) CBIT_LOG_CALL_(trace, __VA_ARGS__)
+#define CBIT_LOG_TRACE_RATE_LIMITED(seconds, ...) CBIT_LOG_RATE_LIMITED_(trace, seconds, __VA_ARGS__)
+#else
+#define CBIT_LOG_TRACE(...) static_cast<void>(0)
+#define CBIT_LOG_TRACE_RATE_LIMITED(seconds, ...) static_cast<void>(0)
+#endif
+
+#if CBIT_LOG_ACTIVE_LEVEL <= CBIT_LOG_LEVEL_DEBUG
+#define CBIT_LOG_DEBUG(...) CBIT_LOG_CALL_(debug, __VA_ARGS__)
+#define CBIT_LOG_DEBUG_RATE_LIMITED(seconds, ...) CBIT_LOG_RATE_LIMITED_(debug, seconds, __VA_ARGS__)
+#else
+#define CBIT_LOG_DEBUG(...) static_cast<void>(0)
+#define CBIT_LOG_DEBUG_RATE_LIMITED(seconds, ...) static_cast<void>(0)
+#endif
+
+#if CBIT_LOG_ACTIVE_LEVEL <= CBIT_LOG_LEVEL_INFO
+#define CBIT_LOG_INFO(...) CBIT_LOG_CALL_(info, __VA_ARGS__)
+#define CBIT_LOG_INFO_RATE_LIMITED(seconds, ...) CBIT_LOG_RATE_LIMITED_(info, seconds, __VA_ARGS__)
+#else
+#define CBIT_LOG_INFO(...) static_cast<void>(0)
+#define CBIT_LOG_INFO_RATE_LIMITED(seconds, ...) static_cast<void>(0)
+#endif
+
+#if CBIT_LOG_ACTIVE_LEVEL <= CBIT_LOG_LEVEL_WARN
+#define CBIT_LOG_WARN(...) CBIT_LOG_CALL_(warn, __VA_ARGS__)
+#define CBIT_LOG_WARN_RATE_LIMITED(seconds, ...) CBIT_LOG_RATE_LIMITED_(warn, seconds, __VA_ARGS__)
+#else
+#define CBIT_LOG_WARN(...) static_cast<void>(0)
+#define CBIT_LOG_WARN_RATE_LIMITED(seconds, ...) static_cast<void>(0)
+#endif
+
+#if CBIT_LOG_ACTIVE_LEVEL <= CBIT_LOG_LEVEL_ERROR
+#define CBIT_LOG_ERROR(...) CBIT_LOG_CALL_(error, __VA_ARGS__)
+#define CBIT_LOG_ERROR_RATE_LIMITED(seconds, ...) CBIT_LOG_RATE_LIMITED_(error, seconds, __VA_ARGS__)
+#else
+#define CBIT_LOG_ERROR(...) static_cast<void>(0)
+#define CBIT_LOG_ERROR_RATE_LIMITED(seconds, ...) static_cast<void>(0)
+#endif
+
+#if CBIT_LOG_ACTIVE_LEVEL <= CBIT_LOG_LEVEL_CRITICAL
+#define CBIT_LOG_CRITICAL(...) CBIT_LOG_CALL_(critical, __VA_ARGS__)
+#else
+#define CBIT_LOG_CRITICAL(...) static_cast<void>(0)
+#endif
+
 #endif //CBIT_LOGGER_H
@@ -0,0 +1,126 @@
+/**
+ * @file    MappedFile.cpp
+ * @brief   Implementation of the MappedFile class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "MappedFile.h"
+
+#include <utility>
+#include "utilities/Logger.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <filesystem>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+cbit::MappedFile::~MappedFile() {
+    close();
+}
+
+cbit::MappedFile::MappedFile(MappedFile &&other) noexcept
+    : _data(std::exchange(other._data, nullptr)),
+      _size(std::exchange(other._size, 0)) {
+}
+
+cbit::MappedFile &cbit::MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+        close();
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+    }
+    return *this;
+}
+
+#ifdef _WIN32
+bool cbit::MappedFile::open(const std::string &path) {
+    close();
+
+    const HANDLE file = CreateFileW(std::filesystem::path(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    // Read before CloseHandle, which may overwrite it.
+    const DWORD mapError = view ? 0 : GetLastError();
+
+    // The view keeps the mapping alive; neither handle is needed once it exists.
+    if (mapping) {
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+    if (!view) {
+        Logger::log()->error("Unable to map file {} (error {})", path, mapError);
+        return false;
+    }
+
+    _data = static_cast<const std::byte *>(view);
+    _size = static_cast<std::size_t>(fileSize.QuadPart);
+    return true;
+}
+
+void cbit::MappedFile::close() {
+    if (_data) {
+        UnmapViewOfFile(_data);
+    }
+    _data = nullptr;
+    _size = 0;
+}
+#else
+bool cbit::MappedFile::open(const std::string &path) {
+    close();
+
+    const int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return false;
+    }
+
+    struct stat status{};
+    if (fstat(descriptor, &status) != 0 || status.st_size <= 0) {
+        ::close(descriptor);
+        return false;
+    }
+
+    // The mapping holds its own reference to the file, so the descriptor can be closed right away.
+    void *view = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);
+    if (view == MAP_FAILED) {
+        Logger::log()->error("Unable to map file {}", path);
+        return false;
+    }
+    madvise(view, static_cast<std::size_t>(status.st_size), MADV_WILLNEED);
+
+    _data = static_cast<const std::byte *>(view);
+    _size = static_cast<std::size_t>(status.st_size);
+    return true;
+}
+
+void cbit::MappedFile::close() {
+    if (_data) {
+        munmap(const_cast<std::byte *>(_data), _size);
+    }
+    _data = nullptr;
+    _size = 0;
+}
+#endif
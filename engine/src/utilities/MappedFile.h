@@ -0,0 +1,55 @@
+/**
+ * @file    MappedFile.h
+ * @brief   Header file for the MappedFile class.
+ * @details Read-only memory mapping of a whole file, used to hand cooked asset data to OpenGL without reading it into
+ *          an intermediate buffer first.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_MAPPEDFILE_H
+#define CBIT_MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace cbit {
+    /**
+     * @class   MappedFile
+     * @brief   Read-only view of a file mapped into the address space.
+     * @details Pages are loaded by the OS as they are touched. The view stays valid until close() or destruction;
+     *          pointers into it must not outlive the object.
+     */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        /**
+         * Map a file, closing any file mapped before.
+         * @param path Path to the file.
+         * @return true if the file exists, is not empty and could be mapped.
+         */
+        bool open(const std::string &path);
+
+        /**
+         * Unmap the file. Does nothing if no file is mapped.
+         */
+        void close();
+
+        [[nodiscard]] bool isOpen() const { return _data != nullptr; }
+        [[nodiscard]] const std::byte *data() const { return _data; }
+        [[nodiscard]] std::size_t size() const { return _size; }
+
+    private:
+        const std::byte *_data = nullptr;
+        std::size_t _size = 0;
+    };
+}
+
+#endif //CBIT_MAPPEDFILE_H
@@ -8,37 +8,79 @@
  */
 
 #include "UUIDGenerator.h"
-#include <iomanip>
 #include <random>
 
-std::string cbit::UUIDGenerator::generate() {
-    // Random number generator setup.
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(0, 255);
+namespace {
+    std::uint64_t splitMix64(std::uint64_t &state) {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
 
-    unsigned char uuid[16];
-    for (int i = 0; i < 16; i++) {
-        uuid[i] = static_cast<unsigned char>(dis(gen));
+    std::uint64_t rotateLeft(const std::uint64_t value, const int shift) {
+        return (value << shift) | (value >> (64 - shift));
     }
 
-    // Set the version number (4) in the 7th byte.
-    // (Clear the high nibble and set it to 0100, i.e., 0x40.)
-    uuid[6] = (uuid[6] & 0x0F) | 0x40;
+    /**
+     * xoshiro256** by Blackman and Vigna; seeded once per thread from std::random_device.
+     */
+    class Xoshiro256 {
+    public:
+        Xoshiro256() {
+            std::random_device rd;
+            std::uint64_t seed = (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+            for (auto &word: _state) {
+                word = splitMix64(seed);
+            }
+        }
+
+        std::uint64_t next() {
+            const std::uint64_t result = rotateLeft(_state[1] * 5, 7) * 9;
+            const std::uint64_t t = _state[1] << 17;
+            _state[2] ^= _state[0];
+            _state[3] ^= _state[1];
+            _state[1] ^= _state[2];
+            _state[0] ^= _state[3];
+            _state[2] ^= t;
+            _state[3] = rotateLeft(_state[3], 45);
+            return result;
+        }
+
+    private:
+        std::uint64_t _state[4]{};
+    };
+}
+
+cbit::UUID cbit::UUIDGenerator::generate() {
+    thread_local Xoshiro256 generator;
+
+    UUID uuid{generator.next(), generator.next()};
+
+    // Set the version number (4) in the high nibble of the 7th byte.
+    uuid.high = (uuid.high & ~0x000000000000F000ull) | 0x0000000000004000ull;
 
     // Set the variant in the 9th byte to 10xxxxxx.
-    uuid[8] = (uuid[8] & 0x3F) | 0x80;
-
-    // Format the UUID as a string: 8-4-4-4-12 hex digits.
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-    for (int i = 0; i < 16; i++) {
-        ss << std::setw(2) << static_cast<int>(uuid[i]);
-        // Insert hyphens after the 4th, 6th, 8th, and 10th bytes.
+    uuid.low = (uuid.low & 0x3FFFFFFFFFFFFFFFull) | 0x8000000000000000ull;
+
+    return uuid;
+}
+
+std::string cbit::UUID::toString() const {
+    constexpr char kHexDigits[] = "0123456789abcdef";
+
+    // 8-4-4-4-12 hex digits.
+    std::string result(36, '-');
+    size_t position = 0;
+    for (int i = 0; i < 16; ++i) {
+        const std::uint64_t word = i < 8 ? high : low;
+        const auto byte = static_cast<unsigned int>((word >> ((7 - (i % 8)) * 8)) & 0xFF);
+        result[position++] = kHexDigits[byte >> 4];
+        result[position++] = kHexDigits[byte & 0x0F];
+        // Skip the hyphens after the 4th, 6th, 8th, and 10th bytes.
         if (i == 3 || i == 5 || i == 7 || i == 9) {
-            ss << "-";
+            ++position;
         }
     }
-
-    return ss.str();
-}
\ No newline at end of file
+    return result;
+}
@@ -9,21 +9,55 @@
 #ifndef CBIT_UUIDGENERATOR_H
 #define CBIT_UUIDGENERATOR_H
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
 
 namespace cbit {
+    /**
+     * @struct UUID
+     * @brief  128-bit version 4 UUID stored in binary form.
+     * @details The string form is only produced on demand through toString().
+     */
+    struct UUID {
+        std::uint64_t high = 0;
+        std::uint64_t low = 0;
+
+        /**
+         * Format the UUID as 8-4-4-4-12 lowercase hex digits.
+         * @return UUID string.
+         */
+        [[nodiscard]] std::string toString() const;
+
+        [[nodiscard]] bool isNull() const { return high == 0 && low == 0; }
+
+        bool operator==(const UUID &other) const { return high == other.high && low == other.low; }
+        bool operator!=(const UUID &other) const { return !(*this == other); }
+    };
+
     /**
      * @class UUIDGenerator
      * @brief Generates unique identifiers (UUIDs) for game objects.
+     * @details Each thread owns a xoshiro256** generator seeded once from std::random_device, so generation
+     *          neither reads OS entropy nor allocates.
      */
     class UUIDGenerator {
     public:
         /**
          * Generates a new UUID.
-         * @return newly generated UUID as a string.
+         * @return newly generated UUID.
          */
-        static std::string generate();
+        static UUID generate();
     };
 }
 
+template<>
+struct std::hash<cbit::UUID> {
+    std::size_t operator()(const cbit::UUID &uuid) const noexcept {
+        // Random bits are already uniformly distributed; fold the halves.
+        return static_cast<std::size_t>(uuid.high ^ (uuid.low * 0x9E3779B97F4A7C15ull));
+    }
+};
+
 #endif //CBIT_UUIDGENERATOR_H
@@ -1,3 +1,4 @@
+#include <cstring>
 #include <iostream>
 #include <ostream>
 #include "core/Application.h"
@@ -6,7 +7,7 @@
 #include "scenes/PlayScene.h"
 #include "scenes/TestScene.h"
 
-int main() {
+int main(int argc, char **argv) {
     try {
         const cbit::WindowConfig windowConfig{
             1200,
@@ -19,6 +20,16 @@ int main() {
 
         cbit::Application app(windowConfig);
 
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--render-thread") == 0) {
+                app.setRenderThreadEnabled(true);
+            } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+                app.setInputRecording(argv[++i]);
+            } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+                app.setInputReplay(argv[++i]);
+            }
+        }
+
         app.getSceneManager()->addScene("MenuScene", std::make_shared<MenuScene>());
         app.getSceneManager()->addScene("PlayScene", std::make_shared<PlayScene>());
         app.getSceneManager()->addScene("TestScene", std::make_shared<TestScene>());
@@ -9,17 +9,25 @@
 #include "PlayScene.h"
 #include "core/Input.h"
 #include "ecs/GameObject.h"
+#include "graphics/animation/BakedAnimation.h"
 #include "math/Color.h"
+#include "utilities/Logger.h"
 #include "glm/gtc/matrix_transform.hpp"
 #include "glm/gtc/type_ptr.inl"
 #include "entt/entt.hpp"
+#include <algorithm>
 #include <cmath>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "../systems/DebugTransformSystem.h"
 #include "../systems/GridMovementSystem.h"
 #include "../systems/TurnControlSystem.h"
 
+using namespace cbit::literals;
+
 namespace {
     constexpr int kGridWidth = 8;
     constexpr int kGridHeight = 8;
@@ -29,6 +37,7 @@ namespace {
     constexpr auto kFoxTexturePath = "assets/animations/low-poly-fox/texture.png";
     constexpr auto kFoxClipName = "fox_idle";
     constexpr float kFoxHeightOffset = 0.0f;
+    constexpr float kFoxScale = 0.015f;
     constexpr auto kPlayerMeshPath = "assets/animations/low-poly-character/idle.glb";
     constexpr auto kPlayerIdleClipName = "idle";
     constexpr auto kPlayerWalkingClipName = "walking";
@@ -59,6 +68,73 @@ namespace {
         };
     }
 
+    /**
+     * @brief  Lines the back edges of the board with spectator foxes on a stand of tiles.
+     * @details The spectators share one mesh and one baked animation, so they are skinned on the GPU and drawn in a
+     *          single instanced call; each only carries its own clip time, offset so they do not move in lockstep.
+     */
+    void spawnSpectatorFoxes(cbit::EntityComponentSystem &world) {
+        auto mesh = std::make_shared<cbit::SkinnedMesh>();
+        std::vector<cbit::AnimationClip> clips;
+        if (!mesh->loadFromFile(kFoxMeshPath, &clips) || clips.empty()) {
+            cbit::Logger::log()->warn("No spectator foxes: unable to load {}", kFoxMeshPath);
+            return;
+        }
+
+        std::vector<const cbit::AnimationClip *> bakedClips;
+        for (size_t i = 0; i < std::min(clips.size(), static_cast<size_t>(cbit::kMaxBakedClips)); ++i) {
+            bakedClips.push_back(&clips[i]);
+        }
+        auto animation = std::make_shared<cbit::BakedAnimation>();
+        if (!animation->bake(*mesh, bakedClips)) {
+            cbit::Logger::log()->warn("No spectator foxes: unable to bake the fox animation");
+            return;
+        }
+
+        constexpr float originX = -((kGridWidth - 1) * kTileSize) * 0.5f;
+        constexpr float originZ = -((kGridHeight - 1) * kTileSize) * 0.5f;
+        const float idleDuration = animation->getClips().front().duration;
+
+        // One row behind the far edge along x, one beside it along z; the corner seat is shared.
+        std::vector<std::pair<int, int> > seats;
+        for (int x = -1; x < kGridWidth; ++x) {
+            seats.emplace_back(x, -1);
+        }
+        for (int z = 0; z < kGridHeight; ++z) {
+            seats.emplace_back(-1, z);
+        }
+
+        for (size_t i = 0; i < seats.size(); ++i) {
+            const auto [x, z] = seats[i];
+            const float worldX = originX + static_cast<float>(x) * kTileSize;
+            const float worldZ = originZ + static_cast<float>(z) * kTileSize;
+
+            auto stand = world.createGameObject("Stand_" + std::to_string(x) + "_" + std::to_string(z))
+                    .addComponent<cbit::TransformComponent>()
+                    .addComponent<cbit::CubeComponent>()
+                    .addComponent<cbit::TextureComponent>("assets/textures/default_cube_texture.png");
+            stand.getComponent<cbit::TransformComponent>().position = cbit::Vector3{worldX, 0.0f, worldZ};
+
+            auto fox = world.createGameObject("Spectator_" + std::to_string(i))
+                    .addComponent<cbit::TransformComponent>()
+                    .addComponent<cbit::TextureComponent>(kFoxTexturePath, false)
+                    .addComponent<cbit::ModelOffsetComponent>(cbit::Vector3{0.0f, 0.0f, 0.0f},
+                                                              cbit::Vector3{90.0f, 180.0f, 0.0f},
+                                                              cbit::Vector3{1.0f, 1.0f, 1.0f})
+                    .addComponent<cbit::BakedAnimationComponent>();
+
+            auto &transform = fox.getComponent<cbit::TransformComponent>();
+            transform.position = cbit::Vector3{worldX, 0.5f * kTileHeight + kFoxHeightOffset, worldZ};
+            transform.scale = cbit::Vector3{kFoxScale, kFoxScale, kFoxScale};
+
+            auto &baked = fox.getComponent<cbit::BakedAnimationComponent>();
+            baked.mesh = mesh;
+            baked.animation = animation;
+            baked.clip = 0;
+            baked.time = idleDuration * static_cast<float>(i) / static_cast<float>(seats.size());
+        }
+    }
+
     // bool isGridInBounds(const int x, const int z) {
     //     return x >= 0 && x < kGridWidth && z >= 0 && z < kGridHeight;
     // }
@@ -182,9 +258,17 @@ namespace {
             gridToWorldTop(gridMovement.x, gridMovement.z),
             gridMovement.positionOffset);
         transform.rotation = cbit::Vector3{0.0f, 0.0f, 0.0f};
-        transform.scale = cbit::Vector3{0.015f, 0.015f, 0.015f};
-
-        animator.clips.emplace(kFoxClipName, cbit::AnimationClip(kFoxClipName, kFoxMeshPath));
+        transform.scale = cbit::Vector3{kFoxScale, kFoxScale, kFoxScale};
+
+        // Mesh, skeleton and every clip of the fox come from a single import of the GLB.
+        auto &skinnedMesh = fox.getComponent<cbit::SkinnedMeshComponent>();
+        std::vector<cbit::AnimationClip> clips;
+        skinnedMesh.path = kFoxMeshPath;
+        skinnedMesh.mesh.loadFromFile(kFoxMeshPath, &clips);
+        for (size_t i = 0; i < clips.size(); ++i) {
+            const std::string clipName = i == 0 ? kFoxClipName : clips[i].getName();
+            animator.clips.emplace(clipName, std::move(clips[i]));
+        }
         animator.activeClip = kFoxClipName;
         animator.previousClip.clear();
         animator.loop = true;
@@ -288,7 +372,7 @@ void PlayScene::initialize() {
             .addComponent<cbit::TransformComponent>()
             .addComponent<GridMovementComponent>()
             .addComponent<TurnControlComponent>(TurnControlComponent{kPlayerTurnSlot, "Enemy", true})
-            .addComponent<cbit::SkinnedMeshComponent>(kFoxMeshPath)
+            .addComponent<cbit::SkinnedMeshComponent>()
             .addComponent<cbit::TextureComponent>(kFoxTexturePath, false)
             .addComponent<cbit::ModelOffsetComponent>(cbit::Vector3{0.0f, 0.0f, 0.0f},
                                                       cbit::Vector3{90.0f, 180.0f, 0.0f},
@@ -296,6 +380,7 @@ void PlayScene::initialize() {
             .addComponent<cbit::AnimatorComponent>();
 
     configureAnimatedFox(enemy, 2, 2);
+    spawnSpectatorFoxes(getWorld());
 
     constexpr float axisLength = 0.6f;
     constexpr float axisThickness = 0.04f;
@@ -387,7 +472,7 @@ void PlayScene::update(const float deltaTime) {
 
     Scene::update(deltaTime);
 
-    if (auto player = getWorld().getGameObject("enemy"); player.getEntity() != entt::null) {
+    if (auto player = getWorld().getGameObject("enemy"_tag); player.getEntity() != entt::null) {
         auto &transform = player.getComponent<cbit::TransformComponent>();
 
         if (cbit::Input::isKeyDown(cbit::Keyboard::Up)) {
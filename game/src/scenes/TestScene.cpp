@@ -6,23 +6,26 @@
  * @date    2025-12-21
  */
 #include "TestScene.h"
+#include "core/Input.h"
 #include "glm/gtc/type_ptr.inl"
 
 void TestScene::initialize() {
     _shader.loadShaders("resources/shaders/default.vert", "resources/shaders/default.frag");
     _texture.loadTexture("resources/textures/crate.jpg");
     _robotTexture.loadTexture("resources/textures/robot_diffuse.jpg");
-    if (!_robotMesh.loadObj("resources/models/robot.obj")) {
+    if (!_robotMesh.loadFromFile("resources/models/robot.obj")) {
         cbit::Logger::log()->error("Failed to load robot mesh");
     } else {
         cbit::Logger::log()->info("Robot mesh loaded successfully");
     }
-
-    glfwSetWindowUserPointer(getWindow(), &_isometricCamera);
-    glfwSetScrollCallback(getWindow(), cbit::IsometricCamera::scrollCallback);
 }
 
 void TestScene::update(float deltaTime) {
+    double scrollX, scrollY;
+    cbit::Input::getScrollDelta(scrollX, scrollY);
+    if (scrollY != 0.0) {
+        _isometricCamera.processMouseScroll(static_cast<float>(scrollY));
+    }
     _isometricCamera.updateCamera();
 }
 
@@ -14,6 +14,7 @@
 #include "graphics/meshes/Cube.h"
 #include "graphics/meshes/Sphere.h"
 #include "graphics/renderers/ShaderProgram.h"
+#include "graphics/renderers/Texture.h"
 
 /**
  * @class TestScene
@@ -13,6 +13,7 @@
 #include "glm/gtx/quaternion.hpp"
 #include <iomanip>
 #include <sstream>
+#include <utility>
 
 void DebugTransformSystem::update(entt::registry &registry, float deltaTime) {
     (void)deltaTime;
@@ -60,14 +61,23 @@ void DebugTransformSystem::update(entt::registry &registry, float deltaTime) {
         }
     }
 
+    // Text goes through deferred commands, so this system only reads UITextComponent and can run alongside other
+    // systems that update UI text.
+    auto setText = [&registry](const entt::entity entity, const cbit::UITextComponent &text, std::string updated) {
+        if (text.text != updated) {
+            cbit::ISystem::commands(registry).emplace<cbit::UITextComponent>(
+                entity, cbit::UITextComponent{std::move(updated), text.fontSize, text.color});
+        }
+    };
+
     const auto textView = registry.view<DebugTransformTextComponent, cbit::UITextComponent>();
     for (const auto entity: textView) {
-        auto &debugText = textView.get<DebugTransformTextComponent>(entity);
-        auto &text = textView.get<cbit::UITextComponent>(entity);
+        const auto &debugText = textView.get<DebugTransformTextComponent>(entity);
+        const auto &text = textView.get<cbit::UITextComponent>(entity);
 
         if (debugText.target == entt::null || !registry.valid(debugText.target) ||
             !registry.all_of<cbit::TransformComponent>(debugText.target)) {
-            text.text = "Transform: <missing>";
+            setText(entity, text, "Transform: <missing>");
             continue;
         }
 
@@ -89,6 +99,11 @@ void DebugTransformSystem::update(entt::registry &registry, float deltaTime) {
            << targetTransform.scale.y << ", "
            << targetTransform.scale.z << ")";
 
-        text.text = ss.str();
+        setText(entity, text, ss.str());
     }
 }
+
+void DebugTransformSystem::declareAccess(cbit::SystemAccess &access) const {
+    access.writes<cbit::TransformComponent>()
+            .reads<DebugFollowComponent, DebugTransformTextComponent, cbit::TagComponent, cbit::UITextComponent>();
+}
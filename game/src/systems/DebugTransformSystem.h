@@ -38,6 +38,8 @@ struct DebugTransformTextComponent {
 class DebugTransformSystem final : public cbit::ISystem {
 public:
     void update(entt::registry &registry, float deltaTime) override;
+    void declareAccess(cbit::SystemAccess &access) const override;
+    const char *getName() const override { return "DebugTransformSystem"; }
     void render(entt::registry &registry) override {;
         // No rendering needed for this system
     }
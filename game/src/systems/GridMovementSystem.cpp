@@ -108,8 +108,11 @@ void GridMovementSystem::update(entt::registry &registry, float deltaTime) {
         }
 
         if (animatorComponent && animatorComponent->autoState) {
-            auto setClip = [&](const std::string &name, bool loop) {
+            auto setClip = [&](const std::string &name, bool loop, float fadeDuration) {
                 if (!name.empty() && animatorComponent->clips.find(name) != animatorComponent->clips.end()) {
+                    if (animatorComponent->activeClip != name) {
+                        animatorComponent->crossFadeDuration = fadeDuration;
+                    }
                     animatorComponent->activeClip = name;
                     animatorComponent->loop = loop;
                 }
@@ -118,12 +121,13 @@ void GridMovementSystem::update(entt::registry &registry, float deltaTime) {
             const std::string idleClip = pickClipName(*animatorComponent, {"idle"});
             const std::string moveClip = pickClipName(*animatorComponent, {"walking", "run"});
 
+            // Take-offs need to read immediately; landings and locomotion changes can ease in.
             if (wantsJump) {
-                setClip("jump", false);
+                setClip("jump", false, 0.08f);
             } else if (animatorComponent->activeClip == "jump" && animatorComponent->animator.isFinished()) {
-                setClip(isMoving ? moveClip : idleClip, true);
+                setClip(isMoving ? moveClip : idleClip, true, 0.15f);
             } else if (animatorComponent->activeClip != "jump") {
-                setClip(isMoving ? moveClip : idleClip, true);
+                setClip(isMoving ? moveClip : idleClip, true, 0.25f);
             }
         }
 
@@ -177,3 +181,8 @@ void GridMovementSystem::update(entt::registry &registry, float deltaTime) {
     }
 
 }
+
+void GridMovementSystem::declareAccess(cbit::SystemAccess &access) const {
+    access.writes<GridMovementComponent, cbit::TransformComponent, cbit::AnimatorComponent>()
+            .reads<TurnControlComponent>();
+}
@@ -46,6 +46,8 @@ public:
     }
 
     void update(entt::registry &registry, float deltaTime) override;
+    void declareAccess(cbit::SystemAccess &access) const override;
+    const char *getName() const override { return "GridMovementSystem"; }
 
     void render(entt::registry &registry) override {;
         // No rendering needed for this system
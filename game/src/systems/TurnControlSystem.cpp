@@ -8,10 +8,14 @@
 
 #include "TurnControlSystem.h"
 
+#include "core/FrameArena.h"
 #include "core/Input.h"
 #include "ecs/Components.h"
 
 #include <algorithm>
+#include <memory_resource>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -20,9 +24,10 @@ namespace {
         int slot = 0;
     };
 
-    std::vector<TurnEntry> collectTurnEntries(entt::registry &registry) {
+    std::pmr::vector<TurnEntry> collectTurnEntries(entt::registry &registry) {
         const auto view = registry.view<TurnControlComponent>();
-        std::vector<TurnEntry> entries;
+        std::pmr::vector<TurnEntry> entries(&cbit::FrameArena::local());
+        entries.reserve(view.size());
 
         for (const auto entity: view) {
             const auto &turnControl = view.get<TurnControlComponent>(entity);
@@ -36,7 +41,7 @@ namespace {
         return entries;
     }
 
-    int findActiveIndex(const std::vector<TurnEntry> &entries, entt::registry &registry) {
+    int findActiveIndex(const std::pmr::vector<TurnEntry> &entries, entt::registry &registry) {
         for (int index = 0; index < static_cast<int>(entries.size()); ++index) {
             const auto &turnControl = registry.get<TurnControlComponent>(entries[index].entity);
             if (turnControl.canMove) {
@@ -49,7 +54,7 @@ namespace {
 
     void setActiveIndex(
         entt::registry &registry,
-        const std::vector<TurnEntry> &entries,
+        const std::pmr::vector<TurnEntry> &entries,
         const int activeIndex) {
         if (entries.empty()) {
             return;
@@ -64,7 +69,7 @@ namespace {
         registry.get<TurnControlComponent>(entries[activeIndex].entity).canMove = true;
     }
 
-    std::string getActiveUnitLabel(entt::registry &registry, const std::vector<TurnEntry> &entries) {
+    std::string_view getActiveUnitLabel(entt::registry &registry, const std::pmr::vector<TurnEntry> &entries) {
         if (entries.empty()) {
             return "None";
         }
@@ -86,12 +91,26 @@ namespace {
         return "Unknown";
     }
 
-    void updateTurnStatusText(entt::registry &registry, const std::string &activeUnitLabel) {
+    // The text is replaced through a deferred command, so this system only reads UITextComponent and can run
+    // alongside other systems that update UI text. Unchanged text records nothing.
+    void updateTurnStatusText(entt::registry &registry, cbit::CommandBuffer &commands,
+                              const std::string_view activeUnitLabel) {
         const auto textView = registry.view<TurnStatusTextComponent, cbit::UITextComponent>();
         for (const auto entity: textView) {
             const auto &status = textView.get<TurnStatusTextComponent>(entity);
-            auto &text = textView.get<cbit::UITextComponent>(entity);
-            text.text = status.label + activeUnitLabel;
+            const auto &text = textView.get<cbit::UITextComponent>(entity);
+            const std::string_view current = text.text;
+            if (current.size() == status.label.size() + activeUnitLabel.size() &&
+                current.substr(0, status.label.size()) == status.label &&
+                current.substr(status.label.size()) == activeUnitLabel) {
+                continue;
+            }
+
+            std::string updated;
+            updated.reserve(status.label.size() + activeUnitLabel.size());
+            updated.append(status.label).append(activeUnitLabel);
+            commands.emplace<cbit::UITextComponent>(
+                entity, cbit::UITextComponent{std::move(updated), text.fontSize, text.color});
         }
     }
 }
@@ -101,7 +120,7 @@ void TurnControlSystem::update(entt::registry &registry, float deltaTime) {
 
     auto entries = collectTurnEntries(registry);
     if (entries.empty()) {
-        updateTurnStatusText(registry, "None");
+        updateTurnStatusText(registry, commands(registry), "None");
         return;
     }
 
@@ -121,5 +140,10 @@ void TurnControlSystem::update(entt::registry &registry, float deltaTime) {
         setActiveIndex(registry, entries, activeIndex);
     }
 
-    updateTurnStatusText(registry, getActiveUnitLabel(registry, entries));
+    updateTurnStatusText(registry, commands(registry), getActiveUnitLabel(registry, entries));
+}
+
+void TurnControlSystem::declareAccess(cbit::SystemAccess &access) const {
+    access.writes<TurnControlComponent>()
+            .reads<TurnStatusTextComponent, cbit::TagComponent, cbit::UITextComponent>();
 }
@@ -34,6 +34,8 @@ struct TurnStatusTextComponent {
 class TurnControlSystem final : public cbit::ISystem {
 public:
     void update(entt::registry &registry, float deltaTime) override;
+    void declareAccess(cbit::SystemAccess &access) const override;
+    const char *getName() const override { return "TurnControlSystem"; }
 
     void render(entt::registry &registry) override {
         // No rendering needed for this system.
@@ -0,0 +1,161 @@
+/**
+ * @file    CommandBufferTests.cpp
+ * @brief   Tests for CommandBuffers playback order.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "TestHarness.h"
+#include "core/JobSystem.h"
+#include "ecs/CommandBuffer.h"
+#include "entt/entt.hpp"
+
+namespace {
+    constexpr unsigned int kWorkerCount = 3;
+
+    struct Value {
+        int value = 0;
+    };
+
+    struct Marker {
+    };
+
+    struct Key {
+        std::uint64_t key = 0;
+    };
+}
+
+CBIT_TEST(commandBufferAppliesOneEntityInRecordingOrder) {
+    cbit::JobSystem jobs(kWorkerCount);
+    jobs.makeCurrent();
+    cbit::CommandBuffers buffers(jobs.getThreadCount());
+    entt::registry registry;
+    const entt::entity replaced = registry.create();
+    const entt::entity removed = registry.create();
+    const entt::entity readded = registry.create();
+
+    cbit::CommandBuffer &buffer = buffers.local();
+    buffer.emplace<Value>(replaced, Value{1});
+    buffer.emplace<Value>(replaced, Value{2});
+    buffer.emplace<Value>(removed, Value{3});
+    buffer.remove<Value>(removed);
+    buffer.remove<Value>(readded);
+    buffer.emplace<Value>(readded, Value{4});
+    buffers.playback(registry);
+
+    const Value *replacedValue = registry.try_get<Value>(replaced);
+    const Value *readdedValue = registry.try_get<Value>(readded);
+    CBIT_CHECK(replacedValue && replacedValue->value == 2);
+    CBIT_CHECK(registry.try_get<Value>(removed) == nullptr);
+    CBIT_CHECK(readdedValue && readdedValue->value == 4);
+}
+
+CBIT_TEST(commandBufferTargetsDeferredCreates) {
+    cbit::JobSystem jobs(kWorkerCount);
+    jobs.makeCurrent();
+    cbit::CommandBuffers buffers(jobs.getThreadCount());
+    entt::registry registry;
+
+    cbit::CommandBuffer &buffer = buffers.local();
+    const cbit::CommandEntity created = buffer.create();
+    buffer.emplace<Value>(created, Value{7});
+    buffer.emplace<Marker>(created);
+    CBIT_CHECK(buffer.empty() == false);
+
+    // Nothing happens before playback.
+    CBIT_CHECK(registry.valid(buffers.resolve(created)) == false);
+    buffers.playback(registry);
+
+    const Value *value = nullptr;
+    std::size_t count = 0;
+    for (const entt::entity entity: registry.view<Value, Marker>()) {
+        value = registry.try_get<Value>(entity);
+        ++count;
+    }
+    CBIT_CHECK(count == 1);
+    CBIT_CHECK(value && value->value == 7);
+    CBIT_CHECK(buffers.local().empty());
+}
+
+CBIT_TEST(commandBufferDestroysAfterEveryOtherCommand) {
+    cbit::JobSystem jobs(kWorkerCount);
+    jobs.makeCurrent();
+    cbit::CommandBuffers buffers(jobs.getThreadCount());
+    entt::registry registry;
+    const entt::entity existing = registry.create();
+    const entt::entity survivor = registry.create();
+
+    cbit::CommandBuffer &buffer = buffers.local();
+    buffer.destroy(existing);
+    buffer.emplace<Value>(existing, Value{1});
+    buffer.destroy(existing);
+    const cbit::CommandEntity created = buffer.create();
+    buffer.destroy(created);
+    buffer.emplace<Value>(created, Value{2});
+    buffer.emplace<Value>(survivor, Value{3});
+    buffers.playback(registry);
+
+    CBIT_CHECK(registry.valid(existing) == false);
+    const Value *survivorValue = registry.try_get<Value>(survivor);
+    CBIT_CHECK(survivorValue && survivorValue->value == 3);
+
+    std::size_t values = 0;
+    for ([[maybe_unused]] const entt::entity entity: registry.view<Value>()) {
+        ++values;
+    }
+    CBIT_CHECK(values == 1);
+}
+
+CBIT_TEST(commandBufferOrdersCreatesBySortKey) {
+    // Threads record in whatever order the scheduler runs them; entity ids must follow the sort keys anyway.
+    cbit::JobSystem jobs(kWorkerCount);
+    jobs.makeCurrent();
+    cbit::CommandBuffers buffers(jobs.getThreadCount());
+    entt::registry registry;
+    constexpr std::size_t kCount = 2000;
+
+    jobs.parallelFor(kCount, 8, [&buffers](const std::size_t begin, const std::size_t end, unsigned int) {
+        cbit::CommandBuffer &buffer = buffers.local();
+        for (std::size_t i = end; i > begin; --i) {
+            const std::uint64_t key = kCount - i;
+            buffer.emplace<Key>(buffer.create(key), Key{key});
+        }
+    });
+    buffers.playback(registry);
+
+    std::vector<std::uint64_t> keysById(kCount, UINT64_MAX);
+    bool inRange = true;
+    for (const entt::entity entity: registry.view<Key>()) {
+        const auto id = static_cast<std::size_t>(entt::to_integral(entity));
+        inRange = inRange && id < kCount;
+        if (id < kCount) {
+            keysById[id] = registry.try_get<Key>(entity)->key;
+        }
+    }
+    CBIT_CHECK(inRange);
+
+    bool ordered = true;
+    for (std::size_t id = 0; id < kCount; ++id) {
+        ordered = ordered && keysById[id] == id;
+    }
+    CBIT_CHECK(ordered);
+}
+
+CBIT_TEST(commandBufferClearDropsCommands) {
+    cbit::JobSystem jobs(kWorkerCount);
+    jobs.makeCurrent();
+    cbit::CommandBuffers buffers(jobs.getThreadCount());
+    entt::registry registry;
+    const entt::entity entity = registry.create();
+
+    buffers.local().emplace<Value>(entity, Value{1});
+    buffers.local().destroy(entity);
+    buffers.clear();
+    buffers.playback(registry);
+
+    CBIT_CHECK(registry.valid(entity));
+    CBIT_CHECK(registry.try_get<Value>(entity) == nullptr);
+}
@@ -0,0 +1,178 @@
+/**
+ * @file    CookManifestTests.cpp
+ * @brief   Tests for the asset cooker's CookManifest: file hashing, load and save, and staleness.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+#include "CookManifest.h"
+#include "TestHarness.h"
+#include "utilities/Hash.h"
+
+namespace {
+    std::string writeFile(const std::string &name, const std::string &content) {
+        const std::string path = cbit::test::getScratchPath(name);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << content;
+        return path;
+    }
+
+    // A job that read one source file and wrote one output, both present on disk under fileStem.
+    cbit::CookRecord makeRecord(const std::string &name, const std::string &fileStem, const std::string &content) {
+        cbit::CookRecord record;
+        record.name = name;
+        record.version = 1;
+        const std::string source = writeFile(fileStem + ".src", content);
+        std::uint64_t hash = 0;
+        CBIT_CHECK(cbit::CookManifest::hashFile(source, hash));
+        record.dependencies.emplace_back(source, hash);
+        record.outputs.push_back(writeFile(fileStem + ".out", "cooked " + content));
+        return record;
+    }
+}
+
+CBIT_TEST(cookManifestHashesFileContent) {
+    std::uint64_t first = 0;
+    std::uint64_t same = 0;
+    std::uint64_t other = 0;
+    std::uint64_t empty = 1;
+    CBIT_CHECK(cbit::CookManifest::hashFile(writeFile("a.txt", "content"), first));
+    CBIT_CHECK(cbit::CookManifest::hashFile(writeFile("b.txt", "content"), same));
+    CBIT_CHECK(cbit::CookManifest::hashFile(writeFile("c.txt", "Content"), other));
+    CBIT_CHECK(cbit::CookManifest::hashFile(writeFile("empty.txt", ""), empty));
+
+    CBIT_CHECK(first == same);
+    CBIT_CHECK(first != other);
+    CBIT_CHECK(first == cbit::hashString("content"));
+    CBIT_CHECK(empty == cbit::hashString({}));
+
+    std::uint64_t missing = 0;
+    CBIT_CHECK(!cbit::CookManifest::hashFile(cbit::test::getScratchPath("missing.txt"), missing));
+}
+
+CBIT_TEST(cookManifestSavesAndLoads) {
+    const cbit::CookRecord model = makeRecord("model:assets/fox.glb", "fox", "fox");
+    cbit::CookRecord shaders = makeRecord("shaders", "shaders", "void main() {}");
+    shaders.version = 3;
+    shaders.dependencies.emplace_back(shaders.dependencies.front().first + ".extra", 0xfedcba9876543210ull);
+    shaders.outputs.push_back(writeFile("shaders.second", ""));
+
+    cbit::CookManifest saved;
+    saved.record(model);
+    saved.record(shaders);
+    const std::string path = cbit::test::getScratchPath("cooked/manifest.txt");
+    CBIT_CHECK(saved.save(path));
+    CBIT_CHECK(!std::filesystem::exists(path + ".tmp"));
+
+    cbit::CookManifest loaded;
+    CBIT_CHECK(loaded.load(path));
+    CBIT_CHECK(loaded.getOutputs(model.name) == model.outputs);
+    CBIT_CHECK(loaded.getOutputs(shaders.name) == shaders.outputs);
+    CBIT_CHECK(loaded.isUpToDate(model));
+    CBIT_CHECK(loaded.isUpToDate(shaders));
+
+    // Saving what was loaded reproduces the file.
+    const std::string copyPath = cbit::test::getScratchPath("manifest-copy.txt");
+    CBIT_CHECK(loaded.save(copyPath));
+    std::ifstream original(path, std::ios::binary);
+    std::ifstream copy(copyPath, std::ios::binary);
+    const std::string originalText((std::istreambuf_iterator<char>(original)), std::istreambuf_iterator<char>());
+    const std::string copyText((std::istreambuf_iterator<char>(copy)), std::istreambuf_iterator<char>());
+    CBIT_CHECK(!originalText.empty() && originalText == copyText);
+}
+
+CBIT_TEST(cookManifestRejectsMalformedFiles) {
+    cbit::CookManifest manifest;
+    CBIT_CHECK(manifest.load(cbit::test::getScratchPath("missing-manifest.txt")));
+
+    const cbit::CookRecord job = makeRecord("texture:assets/grass.png", "grass", "grass");
+    const std::string valid = "cbit-cook-manifest\t1\njob\ttexture:assets/grass.png\t1\n"
+                              "dep\t" + job.dependencies.front().first + "\t" + "0\n" +
+                              "out\t" + job.outputs.front() + "\n";
+    CBIT_CHECK(manifest.load(writeFile("valid.txt", valid)));
+    CBIT_CHECK(manifest.getOutputs(job.name) == job.outputs);
+
+    const std::vector<std::string> malformed = {
+        "cbit-cook-manifest\t2\n",
+        "not a manifest\n",
+        valid + "dep\tmissing-hash\n",
+        valid + "dep\tpath\tnot-hex\n",
+        valid + "job\tname\tnot-a-number\n",
+        valid + "unknown\tfield\n",
+        "cbit-cook-manifest\t1\nout\torphan-output\n"
+    };
+    bool allRejected = true;
+    bool allEmptied = true;
+    for (std::size_t i = 0; i < malformed.size(); ++i) {
+        const std::string path = writeFile("malformed" + std::to_string(i) + ".txt", malformed[i]);
+        CBIT_CHECK(manifest.load(writeFile("valid.txt", valid)));
+        allRejected = allRejected && !manifest.load(path);
+        allEmptied = allEmptied && manifest.getOutputs(job.name).empty();
+    }
+    CBIT_CHECK(allRejected);
+    CBIT_CHECK(allEmptied);
+}
+
+CBIT_TEST(cookManifestDetectsStaleJobs) {
+    cbit::CookManifest manifest;
+    const cbit::CookRecord job = makeRecord("model:assets/tree.obj", "tree", "tree");
+    CBIT_CHECK(!manifest.isUpToDate(job));
+    manifest.record(job);
+    CBIT_CHECK(manifest.isUpToDate(job));
+
+    // Outputs in the query are ignored; the recorded ones are what must exist.
+    cbit::CookRecord withoutOutputs = job;
+    withoutOutputs.outputs.clear();
+    CBIT_CHECK(manifest.isUpToDate(withoutOutputs));
+
+    cbit::CookRecord newerVersion = job;
+    ++newerVersion.version;
+    CBIT_CHECK(!manifest.isUpToDate(newerVersion));
+
+    cbit::CookRecord changedSource = job;
+    ++changedSource.dependencies.front().second;
+    CBIT_CHECK(!manifest.isUpToDate(changedSource));
+
+    cbit::CookRecord extraSource = job;
+    extraSource.dependencies.emplace_back(writeFile("tree.mtl", "material"), 0);
+    CBIT_CHECK(!manifest.isUpToDate(extraSource));
+
+    std::filesystem::remove(job.outputs.front());
+    CBIT_CHECK(!manifest.isUpToDate(job));
+
+    cbit::CookRecord nothingWritten = makeRecord("model:assets/empty.obj", "empty", "");
+    nothingWritten.outputs.clear();
+    manifest.record(nothingWritten);
+    CBIT_CHECK(!manifest.isUpToDate(nothingWritten));
+
+    manifest.forget(nothingWritten.name);
+    CBIT_CHECK(manifest.getOutputs(nothingWritten.name).empty());
+}
+
+CBIT_TEST(cookManifestRemovesStaleJobs) {
+    cbit::CookManifest manifest;
+    cbit::CookRecord kept = makeRecord("model:assets/kept.glb", "kept", "kept");
+    cbit::CookRecord removed = makeRecord("model:assets/removed.glb", "removed", "removed");
+    cbit::CookRecord moved = makeRecord("model:assets/moved.glb", "moved", "moved");
+    // The asset changed job, e.g. a static model that gained a skeleton, and still writes the same file.
+    cbit::CookRecord movedAgain = moved;
+    movedAgain.name = "skinned:assets/moved.glb";
+    manifest.record(kept);
+    manifest.record(removed);
+    manifest.record(moved);
+    manifest.record(movedAgain);
+
+    const std::vector<std::string> staleOutputs = manifest.removeStaleJobs({kept.name, movedAgain.name});
+    CBIT_CHECK(staleOutputs == removed.outputs);
+    CBIT_CHECK(manifest.getOutputs(removed.name).empty());
+    CBIT_CHECK(manifest.getOutputs(moved.name).empty());
+    CBIT_CHECK(manifest.getOutputs(kept.name) == kept.outputs);
+    CBIT_CHECK(manifest.getOutputs(movedAgain.name) == moved.outputs);
+}
@@ -0,0 +1,172 @@
+/**
+ * @file    CookedMeshTests.cpp
+ * @brief   Tests for CookedMesh: round trips and rejection of truncated or corrupt files.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "TestHarness.h"
+#include "graphics/meshes/CookedMesh.h"
+
+namespace {
+    const std::vector<cbit::Vertex> kVertices = {
+        {{0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f}},
+        {{0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 1.0f}},
+        {{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 0.0f}},
+        {{1.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f}}
+    };
+    const std::vector<unsigned int> kIndices = {0, 1, 2, 2, 1, 3};
+    const std::vector<unsigned int> kLodIndices = {0, 1, 3};
+
+    std::string writeQuad(const std::string &name) {
+        cbit::CookedMeshSource source;
+        source.vertices = kVertices.data();
+        source.vertexStride = sizeof(cbit::Vertex);
+        source.vertexCount = kVertices.size();
+        source.indices = kIndices.data();
+        source.indexCount = kIndices.size();
+        source.lodIndices = kLodIndices.data();
+        source.lodIndexCount = kLodIndices.size();
+        source.lods = {{0, 6, 0.0f}, {6, 3, 0.01f}};
+        source.boundsMax = glm::vec3(1.0f, 0.0f, 1.0f);
+        cbit::SkinnedSubmesh submesh;
+        submesh.name = "quad";
+        submesh.indexCount = 6;
+        source.submeshes.push_back(submesh);
+
+        const std::string path = cbit::test::getScratchPath(name);
+        CBIT_CHECK(cbit::CookedMesh::write(path, source));
+        return path;
+    }
+
+    std::vector<char> readBytes(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+    void writeBytes(const std::string &path, const std::vector<char> &bytes, const std::size_t size) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(size));
+    }
+
+    template<typename T>
+    T readAt(const std::vector<char> &bytes, const std::uint64_t offset) {
+        T value;
+        std::memcpy(&value, bytes.data() + offset, sizeof(T));
+        return value;
+    }
+
+    // Copy of a valid file with one value overwritten; true if CookedMesh still accepts it.
+    template<typename T>
+    bool opensWithPatch(const std::vector<char> &bytes, const std::uint64_t offset, const T value) {
+        std::vector<char> patched = bytes;
+        std::memcpy(patched.data() + offset, &value, sizeof(T));
+        const std::string path = cbit::test::getScratchPath("patched.cbmesh");
+        writeBytes(path, patched, patched.size());
+        cbit::CookedMesh mesh;
+        return mesh.open(path, sizeof(cbit::Vertex));
+    }
+}
+
+CBIT_TEST(cookedMeshRoundTrips) {
+    const std::string path = writeQuad("quad.cbmesh");
+    cbit::CookedMesh mesh;
+    CBIT_CHECK(mesh.open(path, sizeof(cbit::Vertex)));
+
+    const cbit::CookedMeshHeader &header = mesh.getHeader();
+    CBIT_CHECK(header.vertexCount == kVertices.size());
+    CBIT_CHECK(header.indexCount == kIndices.size());
+    CBIT_CHECK(header.lodIndexCount == kLodIndices.size());
+    CBIT_CHECK(std::memcmp(mesh.getVertices(), kVertices.data(), kVertices.size() * sizeof(cbit::Vertex)) == 0);
+    CBIT_CHECK(std::equal(kIndices.begin(), kIndices.end(), mesh.getIndices()));
+    CBIT_CHECK(std::equal(kLodIndices.begin(), kLodIndices.end(), mesh.getIndices() + kIndices.size()));
+
+    const std::vector<cbit::MeshLod> lods = mesh.readLods();
+    CBIT_CHECK(lods.size() == 2);
+    CBIT_CHECK(lods.size() == 2 && lods[1].indexOffset == 6 && lods[1].indexCount == 3 && lods[1].error == 0.01f);
+    const std::vector<cbit::SkinnedSubmesh> submeshes = mesh.readSubmeshes();
+    CBIT_CHECK(submeshes.size() == 1 && submeshes[0].name == "quad" && submeshes[0].indexCount == 6);
+
+    cbit::TrackedVector<cbit::Vertex, cbit::MemoryCategory::Meshes> vertices;
+    cbit::TrackedVector<glm::vec3, cbit::MemoryCategory::Meshes> positions;
+    cbit::TrackedVector<unsigned int, cbit::MemoryCategory::Meshes> indices;
+    mesh.retainGeometry(cbit::GeometryRetention::KeepPositions, vertices, positions, indices);
+    CBIT_CHECK(vertices.empty());
+    CBIT_CHECK(positions.size() == kVertices.size() && positions[3].x == 1.0f && positions[3].z == 1.0f);
+    CBIT_CHECK(indices.size() == kIndices.size());
+}
+
+CBIT_TEST(cookedMeshRejectsOtherVertexLayouts) {
+    const std::string path = writeQuad("quad.cbmesh");
+    cbit::CookedMesh mesh;
+    CBIT_CHECK(!mesh.open(path, sizeof(cbit::Vertex) + 4));
+    CBIT_CHECK(!mesh.open(cbit::test::getScratchPath("missing.cbmesh"), sizeof(cbit::Vertex)));
+}
+
+CBIT_TEST(cookedMeshRejectsTruncatedFiles) {
+    const std::string path = writeQuad("quad.cbmesh");
+    const std::vector<char> bytes = readBytes(path);
+    CBIT_CHECK(bytes.size() > sizeof(cbit::CookedMeshHeader));
+    if (bytes.size() <= sizeof(cbit::CookedMeshHeader)) {
+        return;
+    }
+
+    // Everything up to the last byte of the string table is needed; only the final padding may go.
+    const auto header = readAt<cbit::CookedMeshHeader>(bytes, 0);
+    const std::uint64_t dataEnd = header.stringOffset + header.stringSize;
+    const std::string truncatedPath = cbit::test::getScratchPath("truncated.cbmesh");
+    bool rejected = true;
+    for (std::size_t size = 0; size < dataEnd; ++size) {
+        writeBytes(truncatedPath, bytes, size);
+        cbit::CookedMesh mesh;
+        rejected = rejected && !mesh.open(truncatedPath, sizeof(cbit::Vertex));
+    }
+    CBIT_CHECK(rejected);
+
+    writeBytes(truncatedPath, bytes, dataEnd);
+    cbit::CookedMesh unpadded;
+    CBIT_CHECK(unpadded.open(truncatedPath, sizeof(cbit::Vertex)));
+}
+
+CBIT_TEST(cookedMeshRejectsCorruptFiles) {
+    const std::vector<char> bytes = readBytes(writeQuad("quad.cbmesh"));
+    CBIT_CHECK(bytes.size() > sizeof(cbit::CookedMeshHeader));
+    if (bytes.size() <= sizeof(cbit::CookedMeshHeader)) {
+        return;
+    }
+    const auto header = readAt<cbit::CookedMeshHeader>(bytes, 0);
+
+    CBIT_CHECK(opensWithPatch<char>(bytes, 0, 'C'));
+    CBIT_CHECK(!opensWithPatch<char>(bytes, 0, 'X'));
+    CBIT_CHECK(!opensWithPatch<std::uint32_t>(bytes, offsetof(cbit::CookedMeshHeader, version),
+                                              cbit::kCookedMeshVersion + 1));
+
+    // Counts and offsets that point past the end of the file or off the section alignment.
+    CBIT_CHECK(!opensWithPatch<std::uint32_t>(bytes, offsetof(cbit::CookedMeshHeader, vertexCount), 1u << 30));
+    CBIT_CHECK(!opensWithPatch<std::uint32_t>(bytes, offsetof(cbit::CookedMeshHeader, indexCount), 0));
+    CBIT_CHECK(!opensWithPatch<std::uint32_t>(bytes, offsetof(cbit::CookedMeshHeader, lodIndexCount), UINT32_MAX));
+    CBIT_CHECK(!opensWithPatch<std::uint64_t>(bytes, offsetof(cbit::CookedMeshHeader, indexOffset),
+                                              header.indexOffset + 4));
+    CBIT_CHECK(!opensWithPatch<std::uint64_t>(bytes, offsetof(cbit::CookedMeshHeader, stringOffset),
+                                              UINT64_MAX - 15));
+    CBIT_CHECK(!opensWithPatch<std::int32_t>(bytes, offsetof(cbit::CookedMeshHeader, rootNodeIndex), 0));
+
+    // An index that does not name a vertex, in level 0 and in a coarser level.
+    CBIT_CHECK(!opensWithPatch<std::uint32_t>(bytes, header.indexOffset + 5 * sizeof(std::uint32_t),
+                                              header.vertexCount));
+    CBIT_CHECK(!opensWithPatch<std::uint32_t>(bytes, header.indexOffset + 8 * sizeof(std::uint32_t), UINT32_MAX));
+
+    // Records are { offset, count, ... }: a level or submesh past the indices, a name past the string table.
+    CBIT_CHECK(!opensWithPatch<std::uint32_t>(bytes, header.lodOffset + 12 + 4, 4));
+    CBIT_CHECK(!opensWithPatch<std::uint32_t>(bytes, header.submeshOffset + 12, 7));
+    CBIT_CHECK(!opensWithPatch<std::uint32_t>(bytes, header.submeshOffset + 4,
+                                              static_cast<std::uint32_t>(header.stringSize + 1)));
+}
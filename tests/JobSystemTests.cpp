@@ -0,0 +1,168 @@
+/**
+ * @file    JobSystemTests.cpp
+ * @brief   Tests for the JobSystem: dependencies, continuations, parallelFor coverage and thread indices.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "TestHarness.h"
+#include "core/JobSystem.h"
+
+namespace {
+    constexpr unsigned int kWorkerCount = 3;
+}
+
+CBIT_TEST(jobSystemRunsDependenciesFirst) {
+    cbit::JobSystem jobs(kWorkerCount);
+    std::atomic<int> clock{0};
+    int first = -1;
+    int second = -1;
+    int third = -1;
+
+    const cbit::JobHandle a = jobs.schedule([&] { first = clock++; });
+    const cbit::JobHandle b = jobs.schedule([&] { second = clock++; }, {a});
+    const cbit::JobHandle c = jobs.then(b, [&] { third = clock++; });
+    jobs.wait(c);
+
+    CBIT_CHECK(jobs.isFinished(a) && jobs.isFinished(b) && jobs.isFinished(c));
+    CBIT_CHECK(first == 0);
+    CBIT_CHECK(second == 1);
+    CBIT_CHECK(third == 2);
+}
+
+CBIT_TEST(jobSystemJoinsManyDependencies) {
+    cbit::JobSystem jobs(kWorkerCount);
+    constexpr int kProducers = 100;
+    std::atomic<int> produced{0};
+    int seenByJoin = -1;
+
+    std::vector<cbit::JobHandle> producers;
+    for (int i = 0; i < kProducers; ++i) {
+        producers.push_back(jobs.schedule([&produced] { produced.fetch_add(1); }));
+    }
+    const cbit::JobHandle join = jobs.schedule([&] { seenByJoin = produced.load(); }, producers.data(),
+                                               producers.size());
+    jobs.wait(join);
+
+    CBIT_CHECK(seenByJoin == kProducers);
+}
+
+CBIT_TEST(jobSystemReleasesManyContinuations) {
+    // More continuations than one job can record: the overflow waits for the dependency at schedule time.
+    cbit::JobSystem jobs(kWorkerCount);
+    constexpr int kContinuations = 64;
+    std::atomic<bool> gateOpen{false};
+    std::atomic<int> ranAfterGate{0};
+    std::atomic<int> ranBeforeGate{0};
+
+    const cbit::JobHandle gate = jobs.schedule([&gateOpen] { gateOpen.store(true); });
+    std::vector<cbit::JobHandle> continuations;
+    for (int i = 0; i < kContinuations; ++i) {
+        continuations.push_back(jobs.then(gate, [&] { (gateOpen.load() ? ranAfterGate : ranBeforeGate)++; }));
+    }
+    for (const cbit::JobHandle &continuation: continuations) {
+        jobs.wait(continuation);
+    }
+
+    CBIT_CHECK(ranAfterGate.load() == kContinuations);
+    CBIT_CHECK(ranBeforeGate.load() == 0);
+}
+
+CBIT_TEST(jobSystemReusesSlotsWithoutConfusingHandles) {
+    cbit::JobSystem jobs(kWorkerCount);
+    const cbit::JobHandle finished = jobs.schedule([] {
+    });
+    jobs.wait(finished);
+
+    // Cycle through the whole pool so the finished job's slot is handed out again.
+    std::atomic<int> ran{0};
+    for (std::size_t i = 0; i < cbit::JobSystem::kMaxJobs * 2; ++i) {
+        jobs.schedule([&ran] { ran.fetch_add(1); });
+    }
+    jobs.wait(jobs.schedule([] {
+    }));
+    while (ran.load() != static_cast<int>(cbit::JobSystem::kMaxJobs * 2)) {
+        std::this_thread::yield();
+    }
+
+    CBIT_CHECK(jobs.isFinished(finished));
+    CBIT_CHECK(jobs.isFinished(cbit::JobHandle{}));
+}
+
+CBIT_TEST(jobSystemParallelForVisitsEveryIndexOnce) {
+    cbit::JobSystem jobs(kWorkerCount);
+    constexpr std::size_t kCount = 10007;
+    std::unique_ptr<std::atomic<int>[]> visits(new std::atomic<int>[kCount]);
+    for (std::size_t i = 0; i < kCount; ++i) {
+        visits[i].store(0);
+    }
+    std::atomic<bool> validThreads{true};
+
+    jobs.parallelFor(kCount, 16, [&](const std::size_t begin, const std::size_t end, const unsigned int thread) {
+        validThreads = validThreads && thread < jobs.getThreadCount();
+        for (std::size_t i = begin; i < end; ++i) {
+            visits[i].fetch_add(1);
+        }
+    });
+
+    bool once = true;
+    for (std::size_t i = 0; i < kCount; ++i) {
+        once = once && visits[i].load() == 1;
+    }
+    CBIT_CHECK(once);
+    CBIT_CHECK(validThreads.load());
+}
+
+CBIT_TEST(jobSystemNestedParallelForCompletes) {
+    cbit::JobSystem jobs(kWorkerCount);
+    constexpr std::size_t kOuter = 32;
+    constexpr std::size_t kInner = 256;
+    std::atomic<std::size_t> total{0};
+
+    jobs.parallelFor(kOuter, 1, [&](const std::size_t begin, const std::size_t end, unsigned int) {
+        for (std::size_t i = begin; i < end; ++i) {
+            jobs.parallelFor(kInner, 8, [&total](const std::size_t innerBegin, const std::size_t innerEnd,
+                                                 unsigned int) {
+                total.fetch_add(innerEnd - innerBegin);
+            });
+        }
+    });
+
+    CBIT_CHECK(total.load() == kOuter * kInner);
+}
+
+CBIT_TEST(jobSystemWithoutWorkersRunsInline) {
+    cbit::JobSystem jobs(0);
+    std::size_t total = 0;
+    jobs.parallelFor(100, 1, [&total](const std::size_t begin, const std::size_t end, unsigned int) {
+        total += end - begin;
+    });
+    bool ran = false;
+    jobs.wait(jobs.schedule([&ran] { ran = true; }));
+
+    CBIT_CHECK(total == 100);
+    CBIT_CHECK(ran);
+}
+
+CBIT_TEST(jobSystemSeparatesMainAndOtherThreads) {
+    cbit::JobSystem jobs(kWorkerCount);
+    jobs.makeCurrent();
+    CBIT_CHECK(jobs.getThreadCount() == kWorkerCount + 2);
+    CBIT_CHECK(cbit::JobSystem::getCurrentThreadIndex() == 0);
+
+    unsigned int otherIndex = 0;
+    std::thread other([&otherIndex] { otherIndex = cbit::JobSystem::getCurrentThreadIndex(); });
+    other.join();
+    CBIT_CHECK(otherIndex == jobs.getThreadCount() - 1);
+
+    std::atomic<bool> workersInRange{true};
+    jobs.parallelFor(1000, 1, [&](std::size_t, std::size_t, const unsigned int thread) {
+        const unsigned int index = cbit::JobSystem::getCurrentThreadIndex();
+        workersInRange = workersInRange && index == thread && index < jobs.getThreadCount() - 1;
+    });
+    CBIT_CHECK(workersInRange.load());
+}
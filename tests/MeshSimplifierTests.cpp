@@ -0,0 +1,259 @@
+/**
+ * @file    MeshSimplifierTests.cpp
+ * @brief   Tests for MeshSimplifier: reduction, error bounds, locked boundaries and the level of detail chain.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+#include <glm/glm.hpp>
+#include "TestHarness.h"
+#include "graphics/meshes/MeshSimplifier.h"
+
+namespace {
+    struct TestMesh {
+        std::vector<glm::vec3> positions;
+        std::vector<unsigned int> indices;
+    };
+
+    /**
+     * @brief  Unit sphere made by subdividing an icosahedron; closed, without seams, counter-clockwise outside.
+     */
+    TestMesh makeIcosphere(const int subdivisions) {
+        const float t = (1.0f + std::sqrt(5.0f)) * 0.5f;
+        TestMesh mesh;
+        mesh.positions = {
+            {-1, t, 0}, {1, t, 0}, {-1, -t, 0}, {1, -t, 0},
+            {0, -1, t}, {0, 1, t}, {0, -1, -t}, {0, 1, -t},
+            {t, 0, -1}, {t, 0, 1}, {-t, 0, -1}, {-t, 0, 1}
+        };
+        for (glm::vec3 &position: mesh.positions) {
+            position = glm::normalize(position);
+        }
+        mesh.indices = {
+            0, 11, 5, 0, 5, 1, 0, 1, 7, 0, 7, 10, 0, 10, 11,
+            1, 5, 9, 5, 11, 4, 11, 10, 2, 10, 7, 6, 7, 1, 8,
+            3, 9, 4, 3, 4, 2, 3, 2, 6, 3, 6, 8, 3, 8, 9,
+            4, 9, 5, 2, 4, 11, 6, 2, 10, 8, 6, 7, 9, 8, 1
+        };
+
+        for (int level = 0; level < subdivisions; ++level) {
+            std::map<std::pair<unsigned int, unsigned int>, unsigned int> midpoints;
+            auto midpoint = [&mesh, &midpoints](const unsigned int a, const unsigned int b) {
+                const auto key = std::minmax(a, b);
+                const auto it = midpoints.find(key);
+                if (it != midpoints.end()) {
+                    return it->second;
+                }
+                const auto index = static_cast<unsigned int>(mesh.positions.size());
+                mesh.positions.push_back(glm::normalize(mesh.positions[a] + mesh.positions[b]));
+                midpoints.emplace(key, index);
+                return index;
+            };
+
+            std::vector<unsigned int> subdivided;
+            for (std::size_t i = 0; i < mesh.indices.size(); i += 3) {
+                const unsigned int a = mesh.indices[i];
+                const unsigned int b = mesh.indices[i + 1];
+                const unsigned int c = mesh.indices[i + 2];
+                const unsigned int ab = midpoint(a, b);
+                const unsigned int bc = midpoint(b, c);
+                const unsigned int ca = midpoint(c, a);
+                subdivided.insert(subdivided.end(), {a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca});
+            }
+            mesh.indices = std::move(subdivided);
+        }
+        return mesh;
+    }
+
+    /**
+     * @brief  Flat square grid of cells x cells quads in the xz plane, facing +y.
+     */
+    TestMesh makeGrid(const unsigned int cells) {
+        TestMesh mesh;
+        for (unsigned int z = 0; z <= cells; ++z) {
+            for (unsigned int x = 0; x <= cells; ++x) {
+                mesh.positions.emplace_back(static_cast<float>(x), 0.0f, static_cast<float>(z));
+            }
+        }
+        for (unsigned int z = 0; z < cells; ++z) {
+            for (unsigned int x = 0; x < cells; ++x) {
+                const unsigned int corner = z * (cells + 1) + x;
+                const unsigned int below = corner + cells + 1;
+                mesh.indices.insert(mesh.indices.end(), {corner, below, corner + 1, corner + 1, below, below + 1});
+            }
+        }
+        return mesh;
+    }
+
+    bool isTriangleList(const std::vector<unsigned int> &indices, const std::size_t vertexCount) {
+        if (indices.size() % 3 != 0) {
+            return false;
+        }
+        for (std::size_t i = 0; i < indices.size(); i += 3) {
+            const unsigned int a = indices[i];
+            const unsigned int b = indices[i + 1];
+            const unsigned int c = indices[i + 2];
+            if (a >= vertexCount || b >= vertexCount || c >= vertexCount || a == b || b == c || c == a) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // A flipped triangle on a convex closed mesh faces the centre.
+    bool facesOutward(const TestMesh &mesh, const std::vector<unsigned int> &indices) {
+        for (std::size_t i = 0; i < indices.size(); i += 3) {
+            const glm::vec3 &a = mesh.positions[indices[i]];
+            const glm::vec3 &b = mesh.positions[indices[i + 1]];
+            const glm::vec3 &c = mesh.positions[indices[i + 2]];
+            if (glm::dot(glm::cross(b - a, c - a), a + b + c) <= 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+CBIT_TEST(meshSimplifierReachesTargetCount) {
+    const TestMesh sphere = makeIcosphere(4);
+    cbit::MeshSimplifier simplifier(sphere.positions.data(), sphere.positions.size(), sizeof(glm::vec3),
+                                    sphere.indices.data(), sphere.indices.size());
+
+    const std::size_t target = sphere.indices.size() / 4;
+    const std::vector<unsigned int> simplified = simplifier.simplify(target, 1.0f);
+
+    CBIT_CHECK(simplified.size() <= target);
+    CBIT_CHECK(simplified.size() >= target - 6);
+    CBIT_CHECK(isTriangleList(simplified, sphere.positions.size()));
+    CBIT_CHECK(facesOutward(sphere, simplified));
+    CBIT_CHECK(simplifier.getError() > 0.0f);
+}
+
+CBIT_TEST(meshSimplifierStopsAtMaxError) {
+    const TestMesh sphere = makeIcosphere(4);
+    cbit::MeshSimplifier simplifier(sphere.positions.data(), sphere.positions.size(), sizeof(glm::vec3),
+                                    sphere.indices.data(), sphere.indices.size());
+
+    constexpr float kMaxError = 0.002f;
+    const std::vector<unsigned int> simplified = simplifier.simplify(0, kMaxError);
+
+    CBIT_CHECK(simplifier.getError() <= kMaxError);
+    CBIT_CHECK(!simplified.empty());
+    CBIT_CHECK(simplified.size() < sphere.indices.size());
+    CBIT_CHECK(isTriangleList(simplified, sphere.positions.size()));
+    CBIT_CHECK(facesOutward(sphere, simplified));
+
+    // Asking again with a larger budget continues from where the first call stopped.
+    const std::vector<unsigned int> coarser = simplifier.simplify(0, 4.0f * kMaxError);
+    CBIT_CHECK(coarser.size() < simplified.size());
+    CBIT_CHECK(simplifier.getError() <= 4.0f * kMaxError);
+}
+
+CBIT_TEST(meshSimplifierKeepsBoundaryAndFlatAreas) {
+    constexpr unsigned int kCells = 16;
+    const TestMesh grid = makeGrid(kCells);
+    cbit::MeshSimplifier simplifier(grid.positions.data(), grid.positions.size(), sizeof(glm::vec3),
+                                    grid.indices.data(), grid.indices.size());
+
+    // Collapses inside a plane cost nothing, so a zero error budget still removes the interior.
+    const std::vector<unsigned int> simplified = simplifier.simplify(0, 0.0f);
+    CBIT_CHECK(simplified.size() < grid.indices.size() / 4);
+    CBIT_CHECK(simplifier.getError() == 0.0f);
+    CBIT_CHECK(isTriangleList(simplified, grid.positions.size()));
+
+    bool upward = true;
+    for (std::size_t i = 0; i < simplified.size(); i += 3) {
+        const glm::vec3 &a = grid.positions[simplified[i]];
+        const glm::vec3 normal = glm::cross(grid.positions[simplified[i + 1]] - a,
+                                            grid.positions[simplified[i + 2]] - a);
+        upward = upward && normal.y > 0.0f;
+    }
+    CBIT_CHECK(upward);
+
+    // Boundary vertices are locked, so the outline survives.
+    std::vector<bool> used(grid.positions.size(), false);
+    for (const unsigned int index: simplified) {
+        used[index] = true;
+    }
+    bool boundaryKept = true;
+    for (std::size_t i = 0; i < grid.positions.size(); ++i) {
+        const glm::vec3 &position = grid.positions[i];
+        const bool onBoundary = position.x == 0.0f || position.z == 0.0f || position.x == kCells ||
+                                position.z == kCells;
+        boundaryKept = boundaryKept && (!onBoundary || used[i]);
+    }
+    CBIT_CHECK(boundaryKept);
+}
+
+CBIT_TEST(meshSimplifierHonoursCollapseFilter) {
+    const TestMesh sphere = makeIcosphere(3);
+    cbit::MeshSimplifier simplifier(sphere.positions.data(), sphere.positions.size(), sizeof(glm::vec3),
+                                    sphere.indices.data(), sphere.indices.size());
+    // Only vertices of the upper half may merge, and only into the upper half.
+    simplifier.setCollapseFilter([&sphere](const unsigned int from, const unsigned int to) {
+        return sphere.positions[from].y > 0.0f && sphere.positions[to].y > 0.0f;
+    });
+
+    const std::vector<unsigned int> simplified = simplifier.simplify(0, 1.0f);
+    std::vector<bool> used(sphere.positions.size(), false);
+    for (const unsigned int index: simplified) {
+        used[index] = true;
+    }
+    bool lowerKept = true;
+    for (std::size_t i = 0; i < sphere.positions.size(); ++i) {
+        lowerKept = lowerKept && (sphere.positions[i].y > 0.0f || used[i]);
+    }
+    CBIT_CHECK(lowerKept);
+    CBIT_CHECK(simplified.size() < sphere.indices.size());
+}
+
+CBIT_TEST(meshSimplifierBuildsLodChain) {
+    const TestMesh sphere = makeIcosphere(4);
+    std::vector<cbit::MeshLod> lods;
+    cbit::TrackedVector<unsigned int, cbit::MemoryCategory::Meshes> lodIndices;
+    cbit::MeshSimplifier::buildLodChain(sphere.positions.data(), sphere.positions.size(), sizeof(glm::vec3),
+                                        sphere.indices.data(), sphere.indices.size(), lods, lodIndices);
+
+    CBIT_CHECK(lods.size() >= 2);
+    CBIT_CHECK(lods.size() <= static_cast<std::size_t>(cbit::kMaxLodLevels));
+    if (lods.empty()) {
+        return;
+    }
+    CBIT_CHECK(lods[0].indexOffset == 0);
+    CBIT_CHECK(lods[0].indexCount == sphere.indices.size());
+    CBIT_CHECK(lods[0].error == 0.0f);
+
+    std::size_t offset = sphere.indices.size();
+    for (std::size_t level = 1; level < lods.size(); ++level) {
+        const cbit::MeshLod &lod = lods[level];
+        CBIT_CHECK(lod.indexOffset == offset);
+        CBIT_CHECK(static_cast<float>(lod.indexCount) <= static_cast<float>(lods[level - 1].indexCount) *
+                   cbit::kLodMinReduction);
+        CBIT_CHECK(lod.error >= lods[level - 1].error);
+        CBIT_CHECK(lod.error <= cbit::kLodMaxError);
+
+        const auto begin = lodIndices.begin() + static_cast<std::ptrdiff_t>(offset - sphere.indices.size());
+        const std::vector<unsigned int> levelIndices(begin, begin + lod.indexCount);
+        CBIT_CHECK(isTriangleList(levelIndices, sphere.positions.size()));
+        CBIT_CHECK(facesOutward(sphere, levelIndices));
+        offset += lod.indexCount;
+    }
+    CBIT_CHECK(offset == sphere.indices.size() + lodIndices.size());
+}
+
+CBIT_TEST(meshSimplifierSkipsSmallMeshes) {
+    const TestMesh sphere = makeIcosphere(1);
+    CBIT_CHECK(sphere.indices.size() < cbit::kMinLodSourceIndices);
+
+    std::vector<cbit::MeshLod> lods;
+    cbit::TrackedVector<unsigned int, cbit::MemoryCategory::Meshes> lodIndices{1, 2, 3};
+    cbit::MeshSimplifier::buildLodChain(sphere.positions.data(), sphere.positions.size(), sizeof(glm::vec3),
+                                        sphere.indices.data(), sphere.indices.size(), lods, lodIndices);
+    CBIT_CHECK(lods.empty());
+    CBIT_CHECK(lodIndices.empty());
+}
@@ -0,0 +1,69 @@
+/**
+ * @file    TestHarness.cpp
+ * @brief   Test runner for the engine tests.
+ * @details Usage: engine_tests [name]... runs the named tests, or every test without arguments.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "TestHarness.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include "utilities/Logger.h"
+
+namespace {
+    const char *sCurrentTest = "";
+    int sFailedChecks = 0;
+
+    std::filesystem::path getScratchRoot() {
+        return std::filesystem::temp_directory_path() / "cbit-engine-tests";
+    }
+}
+
+std::vector<cbit::test::TestCase> &cbit::test::getTests() {
+    static std::vector<TestCase> tests;
+    return tests;
+}
+
+void cbit::test::fail(const char *file, const int line, const std::string &expression) {
+    std::cerr << file << ":" << line << ": " << sCurrentTest << ": check failed: " << expression << std::endl;
+    ++sFailedChecks;
+}
+
+std::string cbit::test::getScratchPath(const std::string &name) {
+    const std::filesystem::path directory = getScratchRoot() / sCurrentTest;
+    std::filesystem::create_directories(directory);
+    return (directory / name).string();
+}
+
+int main(const int argc, char **argv) {
+    cbit::Logger::initialize();
+
+    const std::vector<std::string> filters(argv + 1, argv + argc);
+    int failedTests = 0;
+    int ranTests = 0;
+    for (const cbit::test::TestCase &test: cbit::test::getTests()) {
+        if (!filters.empty() && std::find(filters.begin(), filters.end(), test.name) == filters.end()) {
+            continue;
+        }
+
+        sCurrentTest = test.name;
+        const int failedBefore = sFailedChecks;
+        test.function();
+        ++ranTests;
+        if (sFailedChecks != failedBefore) {
+            ++failedTests;
+            std::cerr << "[FAILED] " << test.name << std::endl;
+        } else {
+            std::cout << "[PASSED] " << test.name << std::endl;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::remove_all(getScratchRoot(), error);
+
+    std::cout << ranTests - failedTests << " of " << ranTests << " tests passed" << std::endl;
+    return failedTests == 0 && ranTests > 0 ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file    TestHarness.h
+ * @brief   Minimal test registration and checks for the engine tests.
+ * @details Tests register themselves with CBIT_TEST and report failures with CBIT_CHECK; a failed check is logged
+ *          and the test keeps running, so one run shows every broken expectation. The runner returns non-zero if
+ *          any check failed, which is what CTest looks at.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_TESTHARNESS_H
+#define CBIT_TESTHARNESS_H
+
+#include <string>
+#include <vector>
+
+namespace cbit::test {
+    using TestFunction = void (*)();
+
+    struct TestCase {
+        const char *name;
+        TestFunction function;
+    };
+
+    /**
+     * Get every registered test, in registration order within a translation unit.
+     */
+    std::vector<TestCase> &getTests();
+
+    /**
+     * Record a failed check of the running test.
+     */
+    void fail(const char *file, int line, const std::string &expression);
+
+    /**
+     * Get a path for a scratch file of the running test, removed again after the run.
+     * @param name File name, unique within the test.
+     */
+    std::string getScratchPath(const std::string &name);
+
+    struct Registrar {
+        Registrar(const char *name, const TestFunction function) {
+            getTests().push_back({name, function});
+        }
+    };
+}
+
+#define CBIT_TEST(name)                                                                                                \
+    static void name();                                                                                                \
+    static const ::cbit::test::Registrar name##Registrar(#name, &name);                                                \
+    static void name()
+
+#define CBIT_CHECK(expression)                                                                                         \
+    do {                                                                                                               \
+        if (!(expression)) {                                                                                           \
+            ::cbit::test::fail(__FILE__, __LINE__, #expression);                                                       \
+        }                                                                                                              \
+    } while (false)
+
+#endif //CBIT_TESTHARNESS_H
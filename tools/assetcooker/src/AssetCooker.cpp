@@ -0,0 +1,273 @@
+/**
+ * @file    AssetCooker.cpp
+ * @brief   Implementation of the AssetCooker class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "AssetCooker.h"
+
+#include <algorithm>
+#include <cctype>
+#include <set>
+#include <utility>
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include "graphics/animation/AnimationClip.h"
+#include "graphics/meshes/CookedMesh.h"
+#include "graphics/meshes/Mesh.h"
+#include "graphics/meshes/SkinnedMesh.h"
+#include "graphics/renderers/CookedTexture.h"
+#include "graphics/renderers/GlyphAtlas.h"
+#include "graphics/renderers/ShaderBundle.h"
+#include "utilities/AssetPaths.h"
+#include "utilities/Logger.h"
+
+namespace {
+    // Bump the version of a job kind when its cooked format or cooking code changes, so every asset of that kind is
+    // cooked again on the next run.
+    constexpr std::uint32_t kModelJobVersion = 1;
+    constexpr std::uint32_t kTextureJobVersion = 1;
+    constexpr std::uint32_t kFontJobVersion = 1;
+    constexpr std::uint32_t kShaderJobVersion = 1;
+
+    constexpr const char *kShaderJobName = "shaders";
+
+    const std::set<std::string> kModelExtensions = {".obj", ".fbx", ".glb", ".gltf"};
+    const std::set<std::string> kTextureExtensions = {".png", ".jpg", ".jpeg", ".tga", ".bmp"};
+    const std::set<std::string> kFontExtensions = {".ttf", ".otf"};
+    const std::set<std::string> kShaderExtensions = {".vert", ".frag", ".geom", ".glsl"};
+
+    // Files read alongside a model, e.g. the buffers of a .gltf. They are hashed with the model when present.
+    const std::vector<std::string> kModelSidecarExtensions = {".bin", ".mtl"};
+
+    std::string lowerExtension(const std::filesystem::path &path) {
+        std::string extension = path.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+                       [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return extension;
+    }
+
+    /**
+     * @brief  Moves a newer source's timestamp onto the outputs of a job that was skipped.
+     * @details The engine falls back to the source when it is newer than its cooked file, so an asset that was
+     *          saved again without changing would otherwise be imported at runtime.
+     */
+    void touchOutputs(const std::vector<std::string> &outputs) {
+        std::error_code error;
+        const auto now = std::filesystem::file_time_type::clock::now();
+        for (const std::string &output: outputs) {
+            std::filesystem::last_write_time(output, now, error);
+        }
+    }
+
+    void removeOutputs(const std::vector<std::string> &outputs) {
+        std::error_code error;
+        for (const std::string &output: outputs) {
+            if (std::filesystem::remove(output, error)) {
+                cbit::Logger::log()->info("Removed {}", output);
+            }
+        }
+    }
+}
+
+cbit::AssetCooker::AssetCooker(std::vector<SourceRoot> roots, std::vector<unsigned int> fontSizes, const bool force)
+    : _roots(std::move(roots)),
+      _fontSizes(std::move(fontSizes)),
+      _force(force) {
+}
+
+bool cbit::AssetCooker::run() {
+    const std::string manifestPath =
+            (std::filesystem::path(AssetPaths::getCookedRoot()) / "manifest.txt").generic_string();
+    if (!_force) {
+        _manifest.load(manifestPath);
+    }
+
+    std::vector<Job> jobs = _collectJobs();
+    std::set<std::string> jobNames;
+    size_t cooked = 0;
+    size_t upToDate = 0;
+    size_t failed = 0;
+    for (Job &job: jobs) {
+        jobNames.insert(job.record.name);
+        if (!_hashDependencies(job)) {
+            Logger::log()->error("Unable to read the inputs of {}", job.record.name);
+            _manifest.forget(job.record.name);
+            ++failed;
+            continue;
+        }
+
+        if (!_force && _manifest.isUpToDate(job.record)) {
+            touchOutputs(_manifest.getOutputs(job.record.name));
+            ++upToDate;
+            continue;
+        }
+
+        if (!_cook(job)) {
+            Logger::log()->error("Failed to cook {}", job.record.name);
+            _manifest.forget(job.record.name);
+            ++failed;
+            continue;
+        }
+
+        // Drop what a previous cook of the same asset wrote but this one did not, e.g. a model that lost its clips.
+        std::vector<std::string> previousOutputs = _manifest.getOutputs(job.record.name);
+        previousOutputs.erase(std::remove_if(previousOutputs.begin(), previousOutputs.end(),
+                                             [&job](const std::string &output) {
+                                                 return std::find(job.record.outputs.begin(),
+                                                                  job.record.outputs.end(), output) !=
+                                                        job.record.outputs.end();
+                                             }), previousOutputs.end());
+        removeOutputs(previousOutputs);
+
+        _manifest.record(job.record);
+        Logger::log()->info("Cooked {}", job.record.name);
+        ++cooked;
+    }
+
+    removeOutputs(_manifest.removeStaleJobs(jobNames));
+    _manifest.save(manifestPath);
+
+    Logger::log()->info("Cooked {} assets, {} up to date, {} failed", cooked, upToDate, failed);
+    return failed == 0;
+}
+
+std::vector<cbit::AssetCooker::Job> cbit::AssetCooker::_collectJobs() const {
+    std::vector<Job> jobs;
+    Job shaderJob{JobKind::Shaders, {kShaderJobName, kShaderJobVersion, {}, {}}, {}, {}, 0, {}};
+
+    for (const SourceRoot &root: _roots) {
+        std::error_code error;
+        std::vector<std::filesystem::path> files;
+        for (const auto &entry: std::filesystem::recursive_directory_iterator(root.directory, error)) {
+            if (entry.is_regular_file(error)) {
+                files.push_back(entry.path());
+            }
+        }
+        if (error) {
+            Logger::log()->error("Unable to list {}: {}", root.directory.string(), error.message());
+        }
+
+        // Sorted so the manifest and the log are stable between runs.
+        std::sort(files.begin(), files.end());
+        for (const std::filesystem::path &file: files) {
+            const std::string extension = lowerExtension(file);
+            const std::string sourcePath = file.generic_string();
+            const std::string logicalPath =
+                    (std::filesystem::path(root.logical) / file.lexically_relative(root.directory)).generic_string();
+
+            if (kShaderExtensions.count(extension)) {
+                shaderJob.shaders.emplace_back(logicalPath, sourcePath);
+                shaderJob.record.dependencies.emplace_back(sourcePath, 0);
+            } else if (kModelExtensions.count(extension)) {
+                Job job{JobKind::Model, {"model:" + logicalPath, kModelJobVersion, {}, {}}, logicalPath, sourcePath,
+                        0, {}};
+                job.record.dependencies.emplace_back(sourcePath, 0);
+                for (const std::string &sidecarExtension: kModelSidecarExtensions) {
+                    std::filesystem::path sidecar = file;
+                    sidecar.replace_extension(sidecarExtension);
+                    if (std::filesystem::is_regular_file(sidecar, error)) {
+                        job.record.dependencies.emplace_back(sidecar.generic_string(), 0);
+                    }
+                }
+                jobs.push_back(std::move(job));
+            } else if (kTextureExtensions.count(extension)) {
+                Job job{JobKind::Texture, {"texture:" + logicalPath, kTextureJobVersion, {}, {}}, logicalPath,
+                        sourcePath, 0, {}};
+                job.record.dependencies.emplace_back(sourcePath, 0);
+                jobs.push_back(std::move(job));
+            } else if (kFontExtensions.count(extension)) {
+                for (const unsigned int fontSize: _fontSizes) {
+                    Job job{JobKind::Font,
+                            {"font:" + logicalPath + "@" + std::to_string(fontSize), kFontJobVersion, {}, {}},
+                            logicalPath, sourcePath, fontSize, {}};
+                    job.record.dependencies.emplace_back(sourcePath, 0);
+                    jobs.push_back(std::move(job));
+                }
+            }
+        }
+    }
+
+    if (!shaderJob.shaders.empty()) {
+        jobs.push_back(std::move(shaderJob));
+    }
+    return jobs;
+}
+
+bool cbit::AssetCooker::_hashDependencies(Job &job) const {
+    for (auto &[path, hash]: job.record.dependencies) {
+        if (!CookManifest::hashFile(path, hash)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool cbit::AssetCooker::_cook(Job &job) const {
+    job.record.outputs.clear();
+    switch (job.kind) {
+        case JobKind::Model:
+            return _cookModel(job);
+        case JobKind::Texture: {
+            const std::string cookedPath = AssetPaths::getCookedPath(job.logicalPath, kCookedTextureExtension);
+            job.record.outputs.push_back(cookedPath);
+            return CookedTexture::cook(job.sourcePath, cookedPath);
+        }
+        case JobKind::Font: {
+            const std::string cookedPath = GlyphAtlas::getCookedPath(job.logicalPath, job.fontSize);
+            job.record.outputs.push_back(cookedPath);
+            GlyphAtlas atlas;
+            return atlas.rasterize(job.sourcePath, job.fontSize) && atlas.save(cookedPath);
+        }
+        case JobKind::Shaders: {
+            const std::string cookedPath = ShaderBundle::getBundlePath();
+            job.record.outputs.push_back(cookedPath);
+            return ShaderBundle::write(cookedPath, job.shaders);
+        }
+    }
+    return false;
+}
+
+bool cbit::AssetCooker::_cookModel(Job &job) const {
+    // A cheap import without post-processing tells which cooked formats the file needs.
+    bool hasMeshes = false;
+    bool hasBones = false;
+    bool hasAnimations = false;
+    {
+        Assimp::Importer importer;
+        const aiScene *scene = importer.ReadFile(job.sourcePath, 0);
+        if (!scene) {
+            Logger::log()->error("Assimp failed to read {}: {}", job.sourcePath, importer.GetErrorString());
+            return false;
+        }
+        hasMeshes = scene->mNumMeshes > 0;
+        hasAnimations = scene->mNumAnimations > 0;
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            hasBones = hasBones || scene->mMeshes[i]->HasBones();
+        }
+    }
+
+    if (hasMeshes && hasBones) {
+        const std::string cookedPath = AssetPaths::getCookedPath(job.logicalPath, kCookedSkinnedMeshExtension);
+        job.record.outputs.push_back(cookedPath);
+        if (!SkinnedMesh().cookFile(job.sourcePath, cookedPath)) {
+            return false;
+        }
+    } else if (hasMeshes) {
+        const std::string cookedPath = AssetPaths::getCookedPath(job.logicalPath, kCookedMeshExtension);
+        job.record.outputs.push_back(cookedPath);
+        if (!Mesh().cookFile(job.sourcePath, cookedPath)) {
+            return false;
+        }
+    }
+
+    if (hasAnimations) {
+        const std::string cookedPath = AssetPaths::getCookedPath(job.logicalPath, kCookedClipExtension);
+        job.record.outputs.push_back(cookedPath);
+        if (!AnimationClip::cookFile(job.sourcePath, cookedPath)) {
+            return false;
+        }
+    }
+    return !job.record.outputs.empty();
+}
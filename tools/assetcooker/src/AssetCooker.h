@@ -0,0 +1,79 @@
+/**
+ * @file    AssetCooker.h
+ * @brief   Header file for the AssetCooker class.
+ * @details Walks the source asset directories and writes the engine-native file of every asset under the cooked
+ *          root: cooked meshes, compressed animation clips, pre-mipmapped textures, glyph atlases and one shader
+ *          bundle. Cooking is incremental; see CookManifest.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_ASSETCOOKER_H
+#define CBIT_ASSETCOOKER_H
+
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "CookManifest.h"
+
+namespace cbit {
+    /**
+     * @struct SourceRoot
+     * @brief  A directory of source assets and the path the engine loads them by.
+     * @details Assets are named by the logical path, e.g. with logical "resources" and directory engine/resources,
+     *          engine/resources/fonts/Amble.ttf is cooked for resources/fonts/Amble.ttf.
+     */
+    struct SourceRoot {
+        std::string logical;
+        std::filesystem::path directory;
+    };
+
+    /**
+     * @class AssetCooker
+     * @brief Offline asset pipeline. Cooked paths are relative to the working directory, like the engine's.
+     */
+    class AssetCooker {
+    public:
+        /**
+         * @param roots Directories to cook.
+         * @param fontSizes Pixel sizes to build glyph atlases at.
+         * @param force Cook every asset, even if the manifest says it is up to date.
+         */
+        AssetCooker(std::vector<SourceRoot> roots, std::vector<unsigned int> fontSizes, bool force);
+
+        /**
+         * Cook every asset that changed since the last run and delete the outputs of removed assets.
+         * @return true if every job succeeded.
+         */
+        bool run();
+
+    private:
+        enum class JobKind {
+            Model,
+            Texture,
+            Font,
+            Shaders
+        };
+
+        struct Job {
+            JobKind kind;
+            CookRecord record;
+            std::string logicalPath;
+            std::string sourcePath;
+            unsigned int fontSize = 0;
+            std::vector<std::pair<std::string, std::string> > shaders; // Logical and source path.
+        };
+
+        [[nodiscard]] std::vector<Job> _collectJobs() const;
+        bool _hashDependencies(Job &job) const;
+        bool _cook(Job &job) const;
+        bool _cookModel(Job &job) const;
+
+        std::vector<SourceRoot> _roots;
+        std::vector<unsigned int> _fontSizes;
+        bool _force;
+        CookManifest _manifest;
+    };
+}
+
+#endif //CBIT_ASSETCOOKER_H
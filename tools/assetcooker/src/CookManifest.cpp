@@ -0,0 +1,155 @@
+/**
+ * @file    CookManifest.cpp
+ * @brief   Implementation of the CookManifest class.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include "CookManifest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+#include "utilities/AtomicFile.h"
+#include "utilities/Hash.h"
+#include "utilities/Logger.h"
+#include "utilities/MappedFile.h"
+
+namespace {
+    constexpr std::string_view kManifestHeader = "cbit-cook-manifest\t1";
+
+    std::vector<std::string> splitFields(const std::string &line) {
+        std::vector<std::string> fields;
+        std::istringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, '\t')) {
+            fields.push_back(field);
+        }
+        return fields;
+    }
+}
+
+bool cbit::CookManifest::hashFile(const std::string &path, std::uint64_t &hash) {
+    MappedFile file;
+    if (file.open(path)) {
+        hash = hashString(std::string_view(reinterpret_cast<const char *>(file.data()), file.size()));
+        return true;
+    }
+
+    // MappedFile does not map empty files.
+    std::error_code error;
+    if (std::filesystem::is_regular_file(path, error) && std::filesystem::file_size(path, error) == 0 && !error) {
+        hash = hashString({});
+        return true;
+    }
+    return false;
+}
+
+bool cbit::CookManifest::load(const std::string &path) {
+    _jobs.clear();
+    std::ifstream file(path);
+    if (!file) {
+        return true;
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || line != kManifestHeader) {
+        Logger::log()->warn("Ignoring cook manifest {} of another version", path);
+        return false;
+    }
+
+    CookRecord *job = nullptr;
+    while (std::getline(file, line)) {
+        const std::vector<std::string> fields = splitFields(line);
+        bool valid = !fields.empty();
+        try {
+            if (valid && fields[0] == "job" && fields.size() == 3) {
+                CookRecord record;
+                record.name = fields[1];
+                record.version = static_cast<std::uint32_t>(std::stoul(fields[2]));
+                job = &(_jobs[record.name] = std::move(record));
+            } else if (valid && fields[0] == "dep" && fields.size() == 3 && job) {
+                job->dependencies.emplace_back(fields[1], std::stoull(fields[2], nullptr, 16));
+            } else if (valid && fields[0] == "out" && fields.size() == 2 && job) {
+                job->outputs.push_back(fields[1]);
+            } else {
+                valid = false;
+            }
+        } catch (const std::exception &) {
+            valid = false;
+        }
+
+        if (!valid) {
+            Logger::log()->warn("Ignoring malformed cook manifest {}", path);
+            _jobs.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool cbit::CookManifest::save(const std::string &path) const {
+    return writeFileAtomically(path, [this](std::ostream &file) {
+        file << kManifestHeader << '\n';
+        for (const auto &[name, job]: _jobs) {
+            file << "job\t" << name << '\t' << job.version << '\n';
+            for (const auto &[dependency, hash]: job.dependencies) {
+                file << "dep\t" << dependency << '\t' << std::hex << hash << std::dec << '\n';
+            }
+            for (const std::string &output: job.outputs) {
+                file << "out\t" << output << '\n';
+            }
+        }
+        return static_cast<bool>(file);
+    });
+}
+
+bool cbit::CookManifest::isUpToDate(const CookRecord &job) const {
+    const auto it = _jobs.find(job.name);
+    if (it == _jobs.end() || it->second.version != job.version || it->second.dependencies != job.dependencies ||
+        it->second.outputs.empty()) {
+        return false;
+    }
+
+    std::error_code error;
+    for (const std::string &output: it->second.outputs) {
+        if (!std::filesystem::is_regular_file(output, error)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::string> cbit::CookManifest::getOutputs(const std::string &name) const {
+    const auto it = _jobs.find(name);
+    return it == _jobs.end() ? std::vector<std::string>() : it->second.outputs;
+}
+
+void cbit::CookManifest::record(const CookRecord &job) {
+    _jobs[job.name] = job;
+}
+
+void cbit::CookManifest::forget(const std::string &name) {
+    _jobs.erase(name);
+}
+
+std::vector<std::string> cbit::CookManifest::removeStaleJobs(const std::set<std::string> &current) {
+    std::set<std::string> staleOutputs;
+    for (auto it = _jobs.begin(); it != _jobs.end();) {
+        if (current.count(it->first) == 0) {
+            staleOutputs.insert(it->second.outputs.begin(), it->second.outputs.end());
+            it = _jobs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // An asset that moved between jobs, e.g. a model that gained a skeleton, may still own the same output.
+    for (const auto &[name, job]: _jobs) {
+        for (const std::string &output: job.outputs) {
+            staleOutputs.erase(output);
+        }
+    }
+    return {staleOutputs.begin(), staleOutputs.end()};
+}
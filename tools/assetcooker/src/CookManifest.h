@@ -0,0 +1,92 @@
+/**
+ * @file    CookManifest.h
+ * @brief   Header file for the CookManifest class.
+ * @details Records, for every cook job, the content hash of each file it read and the files it wrote. A job whose
+ *          inputs hash the same as last time and whose outputs all exist is skipped.
+ *
+ *          The manifest is a tab-separated text file, one record per line:
+ *          @code
+ *          job   <name>  <version>
+ *          dep   <path>  <hash>
+ *          out   <path>
+ *          @endcode
+ *          dep and out lines belong to the job line above them.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#ifndef CBIT_COOKMANIFEST_H
+#define CBIT_COOKMANIFEST_H
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cbit {
+    /**
+     * @struct CookRecord
+     * @brief  Inputs and outputs of one cook job.
+     */
+    struct CookRecord {
+        std::string name;
+        std::uint32_t version = 0; // Bumped when the job's output format or cooking code changes.
+        std::vector<std::pair<std::string, std::uint64_t> > dependencies; // Path and content hash.
+        std::vector<std::string> outputs;
+    };
+
+    /**
+     * @class CookManifest
+     * @brief Dependency manifest of the asset cooker.
+     */
+    class CookManifest {
+    public:
+        /**
+         * Hash the content of a file.
+         * @param path File to hash.
+         * @param hash Receives the 64-bit FNV-1a hash of the file.
+         * @return true if the file could be read.
+         */
+        static bool hashFile(const std::string &path, std::uint64_t &hash);
+
+        /**
+         * Read a manifest. A missing file leaves the manifest empty.
+         * @return false if the file exists but is malformed; the manifest is then empty.
+         */
+        bool load(const std::string &path);
+
+        /**
+         * Write the manifest, replacing the previous file once the new one is complete.
+         */
+        bool save(const std::string &path) const;
+
+        /**
+         * Check if a job can be skipped.
+         * @param job Job with its current version and dependency hashes; outputs are ignored.
+         * @return true if the recorded job has the same version and dependencies and all its outputs exist.
+         */
+        [[nodiscard]] bool isUpToDate(const CookRecord &job) const;
+
+        /**
+         * Get the recorded outputs of a job, or an empty list if it has no record.
+         */
+        [[nodiscard]] std::vector<std::string> getOutputs(const std::string &name) const;
+
+        void record(const CookRecord &job);
+        void forget(const std::string &name);
+
+        /**
+         * Remove the records of jobs that no longer exist.
+         * @param current Names of the jobs of this run.
+         * @return The outputs of the removed jobs that no current job also writes.
+         */
+        std::vector<std::string> removeStaleJobs(const std::set<std::string> &current);
+
+    private:
+        std::map<std::string, CookRecord> _jobs;
+    };
+}
+
+#endif //CBIT_COOKMANIFEST_H
@@ -0,0 +1,65 @@
+/**
+ * @file    main.cpp
+ * @brief   Entry point of the asset cooker.
+ * @details Usage: assetcooker [--force] [--font-size N]... [logical=directory]...
+ *
+ *          Run from the directory the game runs from, so the cooked root matches the engine's. Without roots, assets
+ *          and resources in the working directory are cooked. Glyph atlases are built at the engine's default font
+ *          size unless --font-size is given.
+ * @author  Nur Akmal bin Jalil
+ * @date    2026-10-18
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "AssetCooker.h"
+#include "graphics/renderers/TextRenderer.h"
+#include "utilities/Logger.h"
+
+namespace {
+    bool parseFontSize(const char *text, unsigned int &fontSize) {
+        char *end = nullptr;
+        const unsigned long value = std::strtoul(text, &end, 10);
+        if (end == text || *end != '\0' || value == 0 || value > 1024) {
+            return false;
+        }
+        fontSize = static_cast<unsigned int>(value);
+        return true;
+    }
+}
+
+int main(int argc, char **argv) {
+    cbit::Logger::initialize();
+
+    bool force = false;
+    std::vector<unsigned int> fontSizes;
+    std::vector<cbit::SourceRoot> roots;
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        if (argument == "--force") {
+            force = true;
+        } else if (unsigned int fontSize = 0; argument == "--font-size" && i + 1 < argc &&
+                                                 parseFontSize(argv[i + 1], fontSize)) {
+            fontSizes.push_back(fontSize);
+            ++i;
+        } else if (const size_t separator = argument.find('='); separator != std::string::npos && separator > 0) {
+            roots.push_back({argument.substr(0, separator), argument.substr(separator + 1)});
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--force] [--font-size N]... [logical=directory]..." << std::endl;
+            return 2;
+        }
+    }
+
+    if (roots.empty()) {
+        roots = {{"assets", "assets"}, {"resources", "resources"}};
+    }
+    if (fontSizes.empty()) {
+        fontSizes.push_back(cbit::kDefaultFontSize);
+    }
+
+    cbit::AssetCooker cooker(std::move(roots), std::move(fontSizes), force);
+    return cooker.run() ? 0 : 1;
+}